@@ -3,13 +3,24 @@
 #include <DHT.h>
 
 #define UI_SENSOR_UPDATE_INTERVAL_MS 2000
-#define SENSOR_PUBLISH_INTERVAL_MS 10000
+#define SENSOR_HEARTBEAT_MS 60000             // longest silence on the sensor topic
+#define SENSOR_MIN_PUBLISH_INTERVAL_MS 1000   // floor for deadband-triggered reports
+#define DIAGNOSTICS_INTERVAL_MS 60000
+#define SENSOR_TRACE 0  // 1: stream raw sensor samples (binary, see trace.h) on Serial for replay
+#define UI_BENCH 0  // 1: run the LVGL frame-time benchmark (ui_bench.h) once at boot and print it on Serial
+#define LVGL_PSRAM_MIN_BYTES 2048  // LVGL blocks this large, allocated outside a frame, go to PSRAM (memory_tiers.h)
+#define TEXT_PAGER_MAX_BYTES 4096  // longest email summary / quote kept for the paged view (text_pager.h)
 
 #define I2C_SDA_PIN 17
 #define I2C_SCL_PIN 18
 
 #define BATTERY_LEVEL_PIN 4
 #define BATTERY_CHARGER_PIN 5
+#define BATTERY_DIVIDER_RATIO 2.0f   // VBAT = pin voltage * ratio
+#define BATTERY_CAPACITY_MAH 1000.0f // rated; discharges calibrate the load model within +-20 %
+#define BATTERY_CHARGE_MA 500.0f     // charger CC setting
+#define BATTERY_BASE_LOAD_MA 90.0f   // MCU + display
+#define BATTERY_WIFI_LOAD_MA 70.0f   // extra while the radio is associated
 
 #define TOUCH_LEFT_PIN 16
 #define TOUCH_RIGHT_PIN 15
@@ -21,6 +32,9 @@
 #define DHT_TYPE DHT22
 
 #define ILLUMINATION_SENSOR_ADDRESS 0x5C
+#define PRESSURE_SENSOR_ADDRESS 0x77
+#define RTC_ADDRESS 0x68
+#define RTC_EEPROM_ADDRESS 0x57
 #define THB_SENSOR_ADDRESS 0x76
 
 // Online NTC Time Server
@@ -30,6 +44,10 @@
 
 #define SCREEN_W 128
 #define SCREEN_H 160
+// Address-window granularity of the panel: redrawn areas are rounded out to
+// multiples of these (columns, rows). The ST7735 takes any window.
+#define SCREEN_AREA_ALIGN_X 1
+#define SCREEN_AREA_ALIGN_Y 1
 
 #define WIFI_SSID "DarkZeus4G"
 #define WIFI_PASS "dzeus2002"
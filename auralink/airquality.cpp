@@ -2,7 +2,11 @@
 #include "airquality.h"
 #include "danger.h"
 #include "lv_functions.h"
+#include "memory_tiers.h"
+#include "num_label.h"
+#include "trace.h"
 
+#include <Preferences.h>
 #include <TFT_eSPI.h>
 #include <lvgl.h>
 #include <ui.h>
@@ -10,6 +14,62 @@
 
 AirQuality airQuality(20);
 
+// Heater settling: at least MIN, done once Rs moves < 2 %/min, at most MAX
+// 10 Hz during a gas event, 0.5 Hz in a steady room
+static const AdaptiveSampler::Params AIRQUALITY_SAMPLING = {100, 2000, 20.0f, 10.0f};
+
+static const uint32_t WARMUP_MIN_MS = 3UL * 60UL * 1000UL;
+static const uint32_t WARMUP_MAX_MS = 15UL * 60UL * 1000UL;
+static const float    WARMUP_STABLE = 0.02f;
+
+static const uint32_t MINUTE_MS     = 60UL * 1000UL;
+static const uint32_t DAY_MS        = 24UL * 60UL * MINUTE_MS;
+static const uint32_t SAVE_EVERY_MS = 60UL * MINUTE_MS;  // checkpoint today's max hourly
+static const uint16_t MIN_MINUTES   = 60;                // of data before today counts toward R0
+
+// MQ135 datasheet Rs(t, rh) / Rs(20 °C, 33 %RH) fit
+static const float COR_A = 0.00035f;
+static const float COR_B = 0.02718f;
+static const float COR_C = 1.39538f;
+static const float COR_D = 0.0018f;
+
+// AQI = 100 * (Rs/R0)^-1.6, tabulated over ratio 0.25..8.25 in 1/32 steps.
+// Below the range the score is already clamped to 500.
+static const float   CURVE_MIN   = 0.25f;
+static const float   CURVE_SCALE = 32.0f;
+static const size_t  CURVE_SIZE  = 257;
+static float curve[CURVE_SIZE];
+static bool  curveReady = false;
+
+static void buildCurve() {
+    for (size_t i = 0; i < CURVE_SIZE; ++i) {
+        float ratio = CURVE_MIN + (float)i / CURVE_SCALE;
+        float score = 100.0f * powf(1.0f / ratio, 1.6f);
+        curve[i] = (score > 500.0f) ? 500.0f : score;
+    }
+    curveReady = true;
+}
+
+static float lookupCurve(float ratio) {
+    float pos = (ratio - CURVE_MIN) * CURVE_SCALE;
+    if (pos <= 0.0f) return 500.0f;
+    if (pos >= (float)(CURVE_SIZE - 1)) return curve[CURVE_SIZE - 1];
+    size_t i = (size_t)pos;
+    float frac = pos - (float)i;
+    return curve[i] + (curve[i + 1] - curve[i]) * frac;
+}
+
+// NVS layout; bump version when it changes
+struct AirQualityBaseline {
+    uint16_t version;
+    uint8_t  dayIdx;
+    uint8_t  dayCount;
+    float    days[AirQuality::kBaselineDays];
+    float    todayMax;
+    uint16_t todayMinutes;
+};
+static const uint16_t BASELINE_VERSION = 1;
+
 void updateAirQualityUI(bool force) {
     static uint32_t lastUpdate = 0;
     uint32_t now = millis();
@@ -18,23 +78,29 @@ void updateAirQualityUI(bool force) {
 
     float imm = airQuality.readImmediate();
     float avg = airQuality.average();
-    ColorOpacity co = getDangerColorAirQuality(avg);
+    bool warming = airQuality.warmingUp();
 
-    LV_SAFE(ui_AirQuality, lv_label_set_text_fmt(ui_AirQuality, "%.0f", avg));
+    // While the heater settles the value is shown dimmed and not colour-coded
+    ColorOpacity co = warming ? ColorOpacity{lv_color_hex(0x000000), 0} : getDangerColorAirQuality(avg);
 
-    LV_SAFE(ui_AirQualityContainer, lv_obj_set_style_bg_color(ui_AirQualityContainer, co.color, LV_PART_MAIN));
-    LV_SAFE(ui_AirQualityContainer, lv_obj_set_style_bg_opa(ui_AirQualityContainer, co.opacity, LV_PART_MAIN));
+    LV_SAFE(ui_AirQuality, numLabelSetFloat(ui_AirQuality, avg, 0));
+    const lv_opa_t textOpa = warming ? LV_OPA_50 : LV_OPA_COVER;
+    LV_SAFE(ui_AirQuality, if (lv_obj_get_style_text_opa(ui_AirQuality, LV_PART_MAIN) != textOpa)
+                               lv_obj_set_style_text_opa(ui_AirQuality, textOpa, LV_PART_MAIN));
 
-    Serial.printf("[AIRQUALITY]: imm=%.0f avg=%.0f\n", imm, avg);
+    LV_SAFE(ui_AirQualityContainer, setDangerTile(ui_AirQualityContainer, co));
+
+    Serial.printf("[AIRQUALITY]: imm=%.0f avg=%.0f r0=%.1f days=%u%s\n", imm, avg, airQuality.r0(),
+                  airQuality.baselineDays(), warming ? " (warming up)" : "");
 }
 
-AirQuality::AirQuality(size_t window) : _window(window) {
-  _buf = (_window > 0) ? new float[_window]() : nullptr;
+AirQuality::AirQuality(size_t window) : _sampler("airquality", AIRQUALITY_SAMPLING), _window(window) {
+  _buf = (_window > 0) ? (float*)memCalloc(MemTier::Psram, _window, sizeof(float)) : nullptr;
   reset();
 }
 
 AirQuality::~AirQuality() {
-  delete[] _buf;
+  memFree(_buf);
   _buf = nullptr;
 }
 
@@ -43,16 +109,34 @@ void AirQuality::begin(uint8_t pin, float RLOAD_kOhm, float RZERO_kOhm, float vi
   _RLOAD = RLOAD_kOhm;  // kΩ
   _RZERO = RZERO_kOhm;  // kΩ (set after calibration)
   _vin   = vin_volts;   // e.g., 3.3f if the sensing network runs at 3.3 V
+  _r0    = _RZERO;
 
   analogSetPinAttenuation(_pin, ADC_11db); // maximize usable range near 3.3 V
+
+  if (!curveReady) buildCurve();
+
+  uint32_t now = millis();
+  _warmingUp    = true;
+  _beginAt      = now;
+  _prevMinuteRs = NAN;
+  _minuteSum    = 0.0;
+  _minuteCount  = 0;
+  _minuteStart  = now;
+  _dayStart     = now;
+  _lastSave     = now;
+
+  loadBaseline();
+  updateR0();
+}
+
+void AirQuality::setAmbient(float tempC, float humidityPct) {
+  _tempC = tempC;
+  _rh    = humidityPct;
 }
 
 void AirQuality::read() {
-  // Debounce (your 20 ms), but also ensure we take exactly ONE authoritative sample.
-  static uint32_t lastRead = 0;
   uint32_t now = millis();
-  if (now - lastRead < 20) return;
-  lastRead = now;
+  if (!_sampler.due(now)) return;
 
   // ESP32 ADC settle: discard first sample from a high-Z node
   (void)analogRead(_pin);
@@ -61,13 +145,17 @@ void AirQuality::read() {
   uint16_t raw1 = analogRead(_pin);
   uint16_t raw2 = analogRead(_pin);
   uint16_t raw  = (raw1 + raw2) / 2;  // small average for stability
+  sensorTrace.adc(_pin, raw);
 
   float imm = calculateImmediate(raw);
 
   _lastRaw = raw;
   _lastImm = imm;
 
+  // Samples taken at the slow rate would hold the average back for minutes
+  if (_sampler.update(imm, now)) reset();
   add(imm);
+  trackMinute(_lastRs, now);
 
   // Debug: one line, single sample
   // Serial.printf("[AIRQUALITY] raw:%u  AQI:%.0f\n", _lastRaw, _lastImm);
@@ -83,7 +171,7 @@ void AirQuality::reset() {
 }
 
 // Convert a single ADC reading to an AQI score (0..500) via Rs/R0
-float AirQuality::calculateImmediate(uint16_t raw_adc) const {
+float AirQuality::calculateImmediate(uint16_t raw_adc) {
   // ADC (0..4095) -> voltage at A0 (direct, no divider)
   float vAdc = (raw_adc / 4095.0f) * 3.3f;
 
@@ -92,23 +180,115 @@ float AirQuality::calculateImmediate(uint16_t raw_adc) const {
   if (vOut < 0.01f)         vOut = 0.01f;
   if (vOut > _vin - 0.01f)  vOut = _vin - 0.01f;
 
-  // Rs = (Vin/Vout - 1) * Rload
-  float Rs = ((_vin / vOut) - 1.0f) * _RLOAD; // kΩ
+  // Rs = (Vin/Vout - 1) * Rload, referred to 20 °C / 33 %RH
+  float Rs = ((_vin / vOut) - 1.0f) * _RLOAD / compensation(); // kΩ
   if (Rs < 0.001f) Rs = 0.001f;
+  _lastRs = Rs;
 
   // Ratio vs R0 (≈1.0 in clean air). Lower ratio => worse air.
-  float ratio = Rs / _RZERO;
+  return lookupCurve(Rs / _r0);
+}
 
-  // Map ratio to a simple AQI-like score (tunable curve)
-  const float gamma = 1.6f;   // curvature: higher -> more aggressive rise
-  const float base  = 100.0f; // baseline near clean air
-  float inv = 1.0f / fmaxf(0.05f, ratio);     // avoid div/0
-  float score = base * powf(inv, gamma);
+// Rs drift factor for the current ambient; 1.0 when no reading is available
+float AirQuality::compensation() const {
+  if (isnan(_tempC) || isnan(_rh)) return 1.0f;
+  float f = COR_A * _tempC * _tempC - COR_B * _tempC + COR_C - (_rh - 33.0f) * COR_D;
+  return constrain(f, 0.5f, 1.5f);
+}
+
+// Rs is averaged per minute; the minute means drive both the warm-up check
+// and the daily clean-air maximum that R0 is learned from.
+void AirQuality::trackMinute(float rs, uint32_t now) {
+  _minuteSum += rs;
+  _minuteCount++;
+  if (now - _minuteStart < MINUTE_MS) return;
+
+  float mean = (float)(_minuteSum / _minuteCount);
+  _minuteSum = 0.0;
+  _minuteCount = 0;
+  _minuteStart = now;
+
+  if (_warmingUp) {
+    uint32_t elapsed = now - _beginAt;
+    bool stable = !isnan(_prevMinuteRs) && fabsf(mean - _prevMinuteRs) < WARMUP_STABLE * _prevMinuteRs;
+    _prevMinuteRs = mean;
+    if ((elapsed >= WARMUP_MIN_MS && stable) || elapsed >= WARMUP_MAX_MS) {
+      _warmingUp = false;
+      Serial.printf("[AIRQUALITY] warm-up done after %lus (Rs=%.1fk)\n", (unsigned long)(elapsed / 1000), mean);
+    }
+    return;
+  }
+
+  if (mean > _todayMax) _todayMax = mean;
+  if (_todayMinutes < 0xFFFF) _todayMinutes++;
+
+  if (now - _dayStart >= DAY_MS) {
+    // Close the day; a short day (e.g. mostly warm-up) is not trusted
+    if (_todayMinutes >= MIN_MINUTES) {
+      _days[_dayIdx] = _todayMax;
+      _dayIdx = (_dayIdx + 1) % kBaselineDays;
+      if (_dayCount < kBaselineDays) _dayCount++;
+    }
+    _todayMax = 0.0f;
+    _todayMinutes = 0;
+    _dayStart = now;
+    updateR0();
+    saveBaseline();
+    _lastSave = now;
+  } else {
+    updateR0();
+    if (now - _lastSave >= SAVE_EVERY_MS) {
+      saveBaseline();
+      _lastSave = now;
+    }
+  }
+}
+
+// R0 is the cleanest (highest) daily Rs over the kept days, today included
+// once it has enough data. Values far from the configured R0 mean a broken
+// sensor rather than clean air, so the result is bounded around it.
+void AirQuality::updateR0() {
+  float best = 0.0f;
+  for (uint8_t i = 0; i < _dayCount; ++i) {
+    if (_days[i] > best) best = _days[i];
+  }
+  if (_todayMinutes >= MIN_MINUTES && _todayMax > best) best = _todayMax;
+
+  _r0 = (best > 0.0f) ? constrain(best, _RZERO * 0.25f, _RZERO * 4.0f) : _RZERO;
+}
+
+void AirQuality::loadBaseline() {
+  Preferences prefs;
+  if (!prefs.begin("airquality", true)) return;
+
+  AirQualityBaseline b;
+  size_t n = prefs.getBytes("baseline", &b, sizeof(b));
+  prefs.end();
+  if (n != sizeof(b) || b.version != BASELINE_VERSION || b.dayCount > kBaselineDays || b.dayIdx >= kBaselineDays) {
+    return;
+  }
+
+  memcpy(_days, b.days, sizeof(_days));
+  _dayIdx = b.dayIdx;
+  _dayCount = b.dayCount;
+  _todayMax = b.todayMax;
+  _todayMinutes = b.todayMinutes;
+  Serial.printf("[AIRQUALITY] baseline restored: %u day(s)\n", _dayCount);
+}
 
-  if (score < 0.0f)   score = 0.0f;
-  if (score > 500.0f) score = 500.0f;
+void AirQuality::saveBaseline() {
+  AirQualityBaseline b;
+  b.version = BASELINE_VERSION;
+  b.dayIdx = _dayIdx;
+  b.dayCount = _dayCount;
+  memcpy(b.days, _days, sizeof(b.days));
+  b.todayMax = _todayMax;
+  b.todayMinutes = _todayMinutes;
 
-  return score;
+  Preferences prefs;
+  if (!prefs.begin("airquality", false)) return;
+  prefs.putBytes("baseline", &b, sizeof(b));
+  prefs.end();
 }
 
 float AirQuality::readImmediate() const {
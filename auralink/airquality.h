@@ -1,17 +1,29 @@
 #pragma once
 #include <Arduino.h>
 
+#include "sampler.h"
+
 void updateAirQualityUI(bool force = false);
 
+// MQ135 air-quality engine. Rs is corrected for temperature/humidity, R0 is
+// learned from the cleanest air seen over the last few days (kept in NVS)
+// and Rs/R0 is mapped to an AQI-like score through a precomputed curve.
 class AirQuality {
 public:
+  static constexpr uint8_t kBaselineDays = 7;  // days of clean-air maxima kept
+
   AirQuality(size_t window);
   ~AirQuality();
 
   // NEW: include sensor supply vin (e.g., 3.3 or 5.0). No divider here (direct A0).
+  // RZERO_kOhm is the fallback R0 until a baseline has been learned.
   void begin(uint8_t pin, float RLOAD_kOhm, float RZERO_kOhm, float vin_volts);
 
-  // Take one sample and push into the moving average
+  // Ambient conditions for the Rs correction (NAN: no correction)
+  void setAmbient(float tempC, float humidityPct);
+
+  // Take one sample and push into the moving average (when the adaptive
+  // sampling policy says one is due)
   void read();
 
   // Instantaneous AQI from the last sample (no new ADC read)
@@ -20,17 +32,52 @@ public:
   // Moving average AQI over the window
   float average() const;
 
+  // True until the heater has settled; readings are unreliable meanwhile
+  bool  warmingUp() const { return _warmingUp; }
+  // R0 currently in use (kΩ) and how many full days back it
+  float r0() const { return _r0; }
+  uint8_t baselineDays() const { return _dayCount; }
+  const AdaptiveSampler& sampler() const { return _sampler; }
+
   void reset();
 
 private:
-  float calculateImmediate(uint16_t raw_adc) const;
+  float calculateImmediate(uint16_t raw_adc);
+  float compensation() const;
+  void  trackMinute(float rs, uint32_t now);
+  void  updateR0();
+  void  loadBaseline();
+  void  saveBaseline();
   void  add(float v);
 
   // --- config/state ---
   uint8_t _pin = 36;
   float   _RLOAD = 10.0f;   // kΩ (your 10k pulldown)
-  float   _RZERO = 76.63f;  // kΩ (calibrate in clean air: R0 = Rs)
+  float   _RZERO = 76.63f;  // kΩ fallback R0 (calibrate in clean air: R0 = Rs)
   float   _vin   = 3.3f;    // sensor supply for Rs formula
+  float   _r0    = 76.63f;  // kΩ R0 in use
+
+  // ambient for compensation
+  float   _tempC = NAN;
+  float   _rh    = NAN;
+
+  // warm-up
+  bool     _warmingUp = true;
+  uint32_t _beginAt = 0;
+  float    _prevMinuteRs = NAN;
+
+  // baseline: per-minute mean Rs, daily max of those, ring of past days
+  double   _minuteSum = 0.0;
+  uint32_t _minuteCount = 0;
+  uint32_t _minuteStart = 0;
+  uint32_t _dayStart = 0;
+  uint32_t _lastSave = 0;
+  float    _todayMax = 0.0f;
+  uint16_t _todayMinutes = 0;
+  float    _days[kBaselineDays] = {};
+  uint8_t  _dayIdx = 0, _dayCount = 0;
+
+  AdaptiveSampler _sampler;
 
   // ring buffer
   float*  _buf = nullptr;
@@ -39,6 +86,7 @@ private:
 
   // cache last instantaneous
   uint16_t _lastRaw = 0;
+  float    _lastRs = NAN;
   float    _lastImm = NAN;
 };
-extern AirQuality airQuality;  // moving average over 10 samples
\ No newline at end of file
+extern AirQuality airQuality;  // moving average over 10 samples
@@ -7,22 +7,35 @@
 #include "User_Setup.h"
 #include "airquality.h"
 #include "battery.h"
+#include "danger.h"
 #include "display.h"
+#include "diagnostics.h"
 #include "display_manager.h"
+#include "i2c_bus.h"
 #include "illumination.h"
+#include "memory_tiers.h"
 #include "mqtt.h"
 #include "pressure.h"
+#include "publisher.h"
+#include "text_pager.h"
 #include "thermohygrometer.h"
 //#include "thb.h"
 #include "uv.h"
 #include "time_source.h"
+#include "trace.h"
+#include "ui_bench.h"
 #include "update_ui.h"
 #include "wifi_connector.h"
 
 Display display;
 
-DisplayManager::Params dmParams;
-DisplayManager displayManager(TOUCH_LEFT_PIN, TOUCH_RIGHT_PIN, dmParams);
+// Screens slide underneath the shared notification bar on the top layer
+static DisplayManager::Params displayManagerParams() {
+  DisplayManager::Params p;
+  p.screen_y = UI_COMP_NOTIFICATIONBAR_HEIGHT;
+  return p;
+}
+DisplayManager displayManager(TOUCH_LEFT_PIN, TOUCH_RIGHT_PIN, displayManagerParams());
 
 extern lv_obj_t* ui_SensorData;
 extern lv_obj_t* ui_DailyQuote;
@@ -36,6 +49,8 @@ WiFiClient net;
 
 MqttClient mqtt;
 
+ReportPublisher publisher({SENSOR_HEARTBEAT_MS, SENSOR_MIN_PUBLISH_INTERVAL_MS});
+
 UV uvSensor(20);
 
 void onMqttMessage(const String& topic, const uint8_t* payload, size_t len) {
@@ -43,7 +58,7 @@ void onMqttMessage(const String& topic, const uint8_t* payload, size_t len) {
   Serial.printf("[MQTT] %s => %.*s\n", topic.c_str(), (int)len, (const char*)payload);
 
   // Payload is json
-  DynamicJsonDocument doc(512);
+  JsonDocument doc(jsonAllocator());
   DeserializationError error = deserializeJson(doc, payload, len);
   if (error) {
     Serial.printf("[MQTT] JSON parse error: %s\n", error.c_str());
@@ -73,13 +88,51 @@ void onMqttMessage(const String& topic, const uint8_t* payload, size_t len) {
   }
 }
 
-void onMqttPublish(const String& topic, const uint8_t* payload, size_t len, bool retain) {
+// False when the client refused the message (socket write failed, or it
+// doesn't fit MqttClient::Params::bufferSize)
+bool onMqttPublish(const String& topic, const uint8_t* payload, size_t len, bool retain) {
+  bool ok;
   if (len == 0) {
-    mqtt.publish(MQTT_TOPIC_STATUS, payload, retain);
+    ok = mqtt.publish(MQTT_TOPIC_STATUS, payload, retain);
   } else {
-    mqtt.publish(MQTT_TOPIC_SENSOR, payload, len, retain);
+    ok = mqtt.publish(MQTT_TOPIC_SENSOR, payload, len, retain);
   }
-  updateMqttUI(false, mqtt.connected(), false, true);
+  updateMqttUI(false, mqtt.connected(), false, ok);
+  return ok;
+}
+
+// Sensor report fields: deadbands filter noise, danger bands publish at once
+void addPublisherFields() {
+  using Format = ReportPublisher::Format;
+
+  publisher.addField("battery_percent", [] { return (float)battery.percent(); }, 1.0f, 0.0f, nullptr, Format::Int);
+  publisher.addField("battery_tte_min", [] {
+    int32_t tte = battery.timeToEmptyMin();
+    return tte >= 0 ? (float)tte : NAN;
+  }, 5.0f, 0.1f, nullptr, Format::Int);
+  publisher.addField("illumination_lux", [] { return illuminationMeter.average(); }, 1.0f, 0.1f,
+                     getDangerLevelIllumination);
+  publisher.addField("temperature_c", [] { return thermohygrometer.average().temperature; }, 0.2f, 0.0f,
+                     getDangerLevelTemperature);
+  publisher.addField("humidity_percent", [] { return thermohygrometer.average().humidity; }, 1.0f, 0.0f,
+                     getDangerLevelHumidity);
+  // Warm-up readings are dimmed on screen; they can't raise an alert either
+  publisher.addField("air_quality_aqi", [] { return airQuality.average(); }, 5.0f, 0.05f,
+                     [](float aqi) { return airQuality.warmingUp() ? (uint8_t)0 : getDangerLevelAirQuality(aqi); },
+                     Format::Int);
+  publisher.addField("air_quality_warmup", [] { return airQuality.warmingUp() ? 1.0f : 0.0f; }, 0.0f, 0.0f, nullptr,
+                     Format::Bool);
+  publisher.addField("pressure_pa", [] {
+    float hpa = pressureSensor.averagePressure();
+    return hpa > 0.0f ? hpa * 100.0f : NAN;
+  }, 20.0f, 0.0f,
+                     [](float pa) { return getDangerLevelPressure(pa / 100.0f); });
+  publisher.addField("uv_index", [] { return uvSensor.average(); }, 0.3f, 0.0f, getDangerLevelUVIndex);
+
+  publisher.onReady([] { return mqtt.connected(); });
+  publisher.onPublish([](const uint8_t* payload, size_t len) {
+    return onMqttPublish(MQTT_TOPIC_SENSOR, payload, len, /*retain=*/false);
+  });
 }
 
 void subscribeMqttTopics() {
@@ -122,17 +175,28 @@ void setup() {
   Serial.println(LVGL_Arduino);
   Serial.println("[LVGL] I am LVGL_Arduino");
 
+#if SENSOR_TRACE
+  sensorTrace.begin(Serial);
+#endif
+
   if (!display.begin(SCREEN_W, SCREEN_H, /*rotation*/ 2)) {
     Serial.println("[DISPLAY] init failed");
     while (true) delay(1000);
   }
 
   ui_init();
+  installNumericLabels();
+  installTextPagers();
 
   gScreens[0] = ui_SensorData;
   gScreens[1] = ui_DailyQuote;
   gScreens[2] = ui_EmailSummary;
   displayManager.begin(gScreens, gScreenCount);
+  displayManager.setPageHandler(textPagerStepOn);  // the buttons page through long text first
+
+#if UI_BENCH
+  UiBench().run(display.lvDisplay(), displayManager, Serial);
+#endif
 
   wifi.begin(WIFI_SSID, WIFI_PASS);
   updateWifiUI(true, wifi.isConnected(), wifi.rssi());
@@ -174,14 +238,16 @@ void setup() {
   chargerLevel = digitalRead(BATTERY_CHARGER_PIN);
   manageChargingState();
   attachInterrupt(digitalPinToInterrupt(BATTERY_CHARGER_PIN), charger_isr, CHANGE);
+  battery.begin();
   battery.read();
   updateBatteryUI(true);
 
-  Wire.begin(I2C_SDA_PIN, I2C_SCL_PIN);
-  Wire.setClock(100000);
-  Wire.setTimeout(20);
+  // Probes the attached devices and picks 100/400 kHz before any driver starts
+  if (!i2cBus.begin(I2C_SDA_PIN, I2C_SCL_PIN)) {
+    Serial.println("[I2C] no devices answered — check wiring/pull-ups.");
+  }
 
-  timeSource.begin(&Wire, GMT_OFFSET_SEC, NTP_SERVER);
+  timeSource.begin(i2cBus.wire(), GMT_OFFSET_SEC, NTP_SERVER);
   if (wifi.isConnected()) {
     Serial.println("[TIMESOURCE] Network connected; syncing time from NTP.");
     timeSource.syncCurrentTime();
@@ -190,7 +256,7 @@ void setup() {
   }
   updateTimeSourceUI(true);
 
-  if (!illuminationMeter.begin(ILLUMINATION_SENSOR_ADDRESS, &Wire)) {
+  if (!illuminationMeter.begin(ILLUMINATION_SENSOR_ADDRESS, i2cBus.wire())) {
     Serial.println("[ILLUMINATION] init failed — check wiring/address.");
   }
 
@@ -210,6 +276,8 @@ void setup() {
 
   uvSensor.begin(UV_SENSOR_PIN);
 
+  addPublisherFields();
+
 
   Serial.println("[SYSTEM] Setup done");
 }
@@ -217,6 +285,21 @@ void setup() {
 void loop() {
   displayManager.loop();
 
+  // All I2C traffic for this iteration goes out back-to-back
+  static uint32_t lastRtcRead = 0;
+  if (millis() - lastRtcRead >= 1000) {
+    lastRtcRead = millis();
+    i2cBus.submit(RTC_ADDRESS, [](void*) { return timeSource.read(); });
+  }
+  // Sensors are only polled when their adaptive sampling policy asks for it
+  if (illuminationMeter.due()) {
+    i2cBus.submit(ILLUMINATION_SENSOR_ADDRESS, [](void*) { return illuminationMeter.read(); });
+  }
+  if (pressureSensor.due()) {
+    i2cBus.submit(PRESSURE_SENSOR_ADDRESS, [](void*) { return pressureSensor.read(); });
+  }
+  i2cBus.service();
+
   if (wifi.isConnected()) {
     timeSource.syncCurrentTime();
   }
@@ -231,16 +314,18 @@ void loop() {
     manageChargingState();
   }
 
+  battery.setLoadMa(BATTERY_BASE_LOAD_MA + (wifi.isConnected() ? BATTERY_WIFI_LOAD_MA : 0.0f));
   battery.read();
   updateBatteryUI(false);
 
-  illuminationMeter.read();
   updateIlluminationUI(false);
 
+  // MQ135 Rs drifts strongly with temperature and humidity
+  TemperatureHumidity ambient = thermohygrometer.average();
+  airQuality.setAmbient(ambient.temperature, ambient.humidity);
   airQuality.read();
   updateAirQualityUI(false);
 
-  pressureSensor.read();
   updatePressureUI(false);
 
   thermohygrometer.read();
@@ -252,24 +337,11 @@ void loop() {
   uvSensor.read();
   updateUVIndexUI(uvSensor, false);
 
-  static uint32_t last = 0;
-  if (millis() - last > SENSOR_PUBLISH_INTERVAL_MS && mqtt.connected()) {
-    last = millis();
+  publisher.loop();
 
-    StaticJsonDocument<256> doc;
-    doc["battery_percent"] = battery.percent();
-    doc["illumination_lux"] = illuminationMeter.average();
-    doc["temperature_c"] = pressureSensor.average();
-    doc["humidity_percent"] = thermohygrometer.average().humidity;
-    doc["air_quality_aqi"] = airQuality.average();
-    doc["pressure_pa"] = thermohygrometer.average().pressure;
-
-    char buf[256];
-    size_t n = serializeJson(doc, buf, sizeof(buf));
-
-    onMqttPublish(MQTT_TOPIC_SENSOR, (const uint8_t*)buf, n, /*retain=*/false);
-  }
+  updateDiagnostics(false);
 
-  display.loop();
-  delay(5);
+  // Don't oversleep a UI timer that is due sooner than the usual 5 ms
+  uint32_t uiIdleMs = display.loop();
+  delay(uiIdleMs < 5 ? uiIdleMs : 5);
 }
\ No newline at end of file
@@ -1,16 +1,38 @@
 #include "battery.h"
 
+#include <Preferences.h>
 #include <TFT_eSPI.h>
 #include <lvgl.h>
 #include <ui.h>
 
 #include "User_Setup.h"
 #include "lv_functions.h"
+#include "num_label.h"
+#include "trace.h"
 
 volatile bool chargerEvent = false;
 volatile bool chargerLevel = false;
 
-Battery battery(2000);
+// 5 Hz while the charger is plugged/unplugged or the load steps, 0.2 Hz otherwise
+static const AdaptiveSampler::Params BATTERY_SAMPLING = {200, 5000, 0.05f, 0.04f};
+
+static Battery::Params batteryParams() {
+    Battery::Params p;
+    p.dividerRatio = BATTERY_DIVIDER_RATIO;
+    p.nominalMah = BATTERY_CAPACITY_MAH;
+    p.chargeMa = BATTERY_CHARGE_MA;
+    return p;
+}
+
+Battery battery(batteryParams());
+
+// NVS layout; bump version when it changes
+struct BatteryCalibration {
+    uint16_t version;
+    uint16_t learnCount;
+    float capacityMah;
+};
+static const uint16_t CALIBRATION_VERSION = 2;  // 2: load-model calibration, +-learnClamp
 
 void manageChargingState() {
     // Read the state with interrupt protection
@@ -19,6 +41,7 @@ void manageChargingState() {
     chargerEvent = false;
     interrupts();
 
+    sensorTrace.digital(BATTERY_CHARGER_PIN, lvl);
     battery.setCharging(lvl);
     bool charging = battery.isCharging();
 
@@ -27,69 +50,38 @@ void manageChargingState() {
 
     const uint32_t flag = LV_OBJ_FLAG_HIDDEN;
 
-    // SD bar
-    LV_SAFE_DO(LV_CHILD(ui_SDNotificationBar, UI_COMP_NOTIFICATIONBAR_BATTERYCONTAINER_CHARGINGICON), { charging ? lv_obj_clear_flag(_o, flag) : lv_obj_add_flag(_o, flag); });
-    // DQ bar
-    LV_SAFE_DO(LV_CHILD(ui_DQNotificationBar, UI_COMP_NOTIFICATIONBAR_BATTERYCONTAINER_CHARGINGICON), { charging ? lv_obj_clear_flag(_o, flag) : lv_obj_add_flag(_o, flag); });
-    // ES bar
-    LV_SAFE_DO(LV_CHILD(ui_ESNotificationBar, UI_COMP_NOTIFICATIONBAR_BATTERYCONTAINER_CHARGINGICON), { charging ? lv_obj_clear_flag(_o, flag) : lv_obj_add_flag(_o, flag); });
+    LV_SAFE_DO(LV_CHILD(ui_NotificationBar, UI_COMP_NOTIFICATIONBAR_BATTERYCONTAINER_CHARGINGICON), { charging ? lv_obj_clear_flag(_o, flag) : lv_obj_add_flag(_o, flag); });
 
     Serial.println(charging ? "[BATTERY] Showing charging icon" : "[BATTERY] Hiding charging icon");
 }
 
-void updateBatteryUI(bool force) {
-    static uint32_t lastUpdate = 0;
-    uint32_t now = millis();
-    // 300 ms debounce (comment said 30s; code is 300 ms)
-    if ((now - lastUpdate) < 300 && !force) return;
-    lastUpdate = now;
-
-    float a = battery.average();  // averaged 0..4095
-    int reading_ciel = 2500;
-    int reading_floor = 1750;
-
-    if (battery.isCharging()) {
-        reading_ciel = 2520;
-        reading_floor = 1770;
-    }
-
-    float v = battery.voltage(3.0f, 4.2f, reading_floor, reading_ciel);
-    int p = battery.percent(3.0f, 4.2f, reading_floor, reading_ciel);
-
+void showBatteryUI(int p) {
     lv_color_t c = (p <= 20)   ? lv_color_hex(0xC60047)
                    : (p <= 50) ? lv_color_hex(0xFFF500)
                                : lv_color_hex(0x2095F6);
 
-    // --- Battery bars (3 places) ---
-    // SD
-    LV_SAFE_DO(LV_CHILD(ui_SDNotificationBar, UI_COMP_NOTIFICATIONBAR_BATTERYCONTAINER_BATTERY), {
+    LV_SAFE_DO(LV_CHILD(ui_NotificationBar, UI_COMP_NOTIFICATIONBAR_BATTERYCONTAINER_BATTERY), {
         lv_obj_set_style_bg_color(_o, c, LV_PART_INDICATOR | LV_STATE_DEFAULT);
         lv_obj_set_style_bg_opa(_o, LV_OPA_COVER, LV_PART_INDICATOR | LV_STATE_DEFAULT);
         lv_obj_set_style_bg_grad_dir(_o, LV_GRAD_DIR_NONE, LV_PART_INDICATOR | LV_STATE_DEFAULT);
         lv_bar_set_value(_o, p, LV_ANIM_ON);
     });
 
-    // DQ
-    LV_SAFE_DO(LV_CHILD(ui_DQNotificationBar, UI_COMP_NOTIFICATIONBAR_BATTERYCONTAINER_BATTERY), {
-        lv_obj_set_style_bg_color(_o, c, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-        lv_obj_set_style_bg_opa(_o, LV_OPA_COVER, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-        lv_obj_set_style_bg_grad_dir(_o, LV_GRAD_DIR_NONE, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-        lv_bar_set_value(_o, p, LV_ANIM_ON);
-    });
+    LV_SAFE_DO(LV_CHILD(ui_NotificationBar, UI_COMP_NOTIFICATIONBAR_BATTERYCONTAINER_BATTERYTEXT), { numLabelSetInt(_o, p, "%"); });
+}
 
-    // ES
-    LV_SAFE_DO(LV_CHILD(ui_ESNotificationBar, UI_COMP_NOTIFICATIONBAR_BATTERYCONTAINER_BATTERY), {
-        lv_obj_set_style_bg_color(_o, c, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-        lv_obj_set_style_bg_opa(_o, LV_OPA_COVER, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-        lv_obj_set_style_bg_grad_dir(_o, LV_GRAD_DIR_NONE, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-        lv_bar_set_value(_o, p, LV_ANIM_ON);
-    });
+void updateBatteryUI(bool force) {
+    static uint32_t lastUpdate = 0;
+    uint32_t now = millis();
+    // 300 ms debounce (comment said 30s; code is 300 ms)
+    if ((now - lastUpdate) < 300 && !force) return;
+    lastUpdate = now;
 
-    LV_SAFE_DO(LV_CHILD(ui_SDNotificationBar, UI_COMP_NOTIFICATIONBAR_BATTERYCONTAINER_BATTERYTEXT), { lv_label_set_text_fmt(_o, "%d%%", p); });
-    LV_SAFE_DO(LV_CHILD(ui_DQNotificationBar, UI_COMP_NOTIFICATIONBAR_BATTERYCONTAINER_BATTERYTEXT), {lv_label_set_text_fmt(_o, "%d%%", p);});
-    LV_SAFE_DO(LV_CHILD(ui_ESNotificationBar, UI_COMP_NOTIFICATIONBAR_BATTERYCONTAINER_BATTERYTEXT), {lv_label_set_text_fmt(_o, "%d%%", p);});
+    int p = battery.percent();
+    showBatteryUI(p);
 
-    Serial.printf("[BATTERY]: raw=%.1f V=%.2fV %d%%\n", a, v, p);
+    Serial.printf("[BATTERY]: V=%.2fV ocv=%.2fV %d%% cap=%.0fmAh tte=%ldmin\n", battery.voltage(),
+                  battery.openCircuitVoltage(), p, battery.capacityMah(), (long)battery.timeToEmptyMin());
 }
 
 void IRAM_ATTR charger_isr() {
@@ -101,86 +93,172 @@ void IRAM_ATTR charger_isr() {
     chargerEvent = true;
 }
 
-Battery::Battery(size_t windowSize)
-    : _window(windowSize) {
-    _buf = (_window > 0) ? new uint16_t[_window] : nullptr;
-    reset();
+Battery::Battery() : Battery(Params{}) {}
+
+Battery::Battery(const Params& p) : _p(p), _sampler("battery", BATTERY_SAMPLING) {
+    _capacityMah = _p.nominalMah;
 }
 
-Battery::~Battery() {
-    delete[] _buf;
-    _buf = nullptr;
+void Battery::begin() {
+    loadCalibration();
+    reset();
 }
 
 void Battery::reset() {
-    _idx = 0;
-    _count = 0;
-    _sum = 0;
-    if (_buf && _window) {
-        for (size_t i = 0; i < _window; ++i) _buf[i] = 0;
+    _seeded = false;
+    _lastSample = 0;
+    _learning = false;
+    _drawnMah = 0.0f;
+}
+
+void Battery::setCharging(bool isCharging) {
+    if (isCharging == _isCharging) return;
+    _isCharging = isCharging;
+    if (!_seeded) return;
+
+    float socV = socFromOcv(openCircuitVoltage());
+    if (isCharging) {
+        // A discharge ends here; use it if it covered enough of the curve
+        learnCapacity(socV);
+        _learning = false;
+    } else if (socV >= 0.95f) {
+        // Unplugged near full: a trusted starting point for the next estimate
+        _learning = true;
+        _anchorSoc = socV;
+        _drawnMah = 0.0f;
     }
 }
 
 void Battery::read() {
-    uint16_t v = analogRead(BATTERY_LEVEL_PIN);
-    add(v);
+    uint32_t now = millis();
+    if (_seeded && !_sampler.due(now)) return;
+    uint32_t dt = now - _lastSample;
+    _lastSample = now;
+
+    // Calibrated pin voltage (eFuse Vref / two-point characteristics)
+    uint32_t mv = analogReadMilliVolts(BATTERY_LEVEL_PIN);
+    sensorTrace.millivolts(BATTERY_LEVEL_PIN, (uint16_t)mv);
+    float v = mv * _p.dividerRatio / 1000.0f;
+    _sampler.update(v, now);
+
+    if (!_seeded) {
+        _vFilt = v;
+        _soc = socFromOcv(openCircuitVoltage());
+        _seeded = true;
+        return;
+    }
+
+    float a = (float)dt / (float)(_p.filterTauMs + dt);
+    _vFilt += a * (v - _vFilt);
+
+    // Coulomb-style integration from the modelled current (+ into the cell)
+    float currentMa = _isCharging ? (_p.chargeMa - _loadMa) : -_loadMa;
+    float deltaMah = currentMa * (float)dt / 3600000.0f;
+    _soc += deltaMah / _capacityMah;
+
+    // The integration drifts; the OCV estimate is noisy but unbiased. The pull
+    // is per unit of time, so it doesn't change with the sampling rate.
+    float socV = socFromOcv(openCircuitVoltage());
+    _soc += (1.0f - expf(-(float)dt / (float)_p.ocvTauMs)) * (socV - _soc);
+    _soc = constrain(_soc, 0.0f, 1.0f);
+
+    if (_learning && !_isCharging) {
+        _drawnMah -= deltaMah;
+        if (_anchorSoc - socV >= 2.0f * _p.learnSpan) {
+            // Long discharge: take the estimate and keep going from here
+            learnCapacity(socV);
+            _learning = true;
+            _anchorSoc = socV;
+            _drawnMah = 0.0f;
+        }
+    }
 }
 
-float Battery::average() const {
-    return (_count ? static_cast<float>(_sum) / static_cast<float>(_count) : 0.0f);
+float Battery::openCircuitVoltage() const {
+    // Terminal voltage sags by I*R under load and rises by I*R while charging
+    float currentMa = _isCharging ? (_p.chargeMa - _loadMa) : -_loadMa;
+    return _vFilt - currentMa * _p.internalOhm / 1000.0f;
 }
 
-float Battery::voltage(float v_min, float v_max,
-                       uint16_t raw_min, uint16_t raw_max) const {
-    if (_count == 0 || raw_max <= raw_min) return v_min;
-    float raw = average();
-    // clamp to calibration span
-    if (raw < raw_min) raw = raw_min;
-    if (raw > raw_max) raw = raw_max;
-    // linear map raw_min..raw_max -> v_min..v_max
-    float t = (raw - raw_min) / float(raw_max - raw_min);
-    return v_min + t * (v_max - v_min);
+int Battery::percent() const {
+    if (!_seeded) return 0;
+    int p = (int)(_soc * 100.0f + 0.5f);
+    return p < 0 ? 0 : (p > 100 ? 100 : p);
 }
 
-int Battery::percent(float v_min, float v_max,
-                     uint16_t raw_min, uint16_t raw_max) const {
-    // get VBAT from avg
-    float v = voltage(v_min, v_max, raw_min, raw_max);
+int32_t Battery::timeToEmptyMin() const {
+    if (!_seeded || _isCharging || _loadMa <= 0.0f) return -1;
+    return (int32_t)(remainingMah() / _loadMa * 60.0f);
+}
 
-    // piecewise Li-ion curve (approximate, tweak as needed)
-    // points: {voltage, percent}
+float Battery::socFromOcv(float v) const {
+    // piecewise Li-ion OCV curve (approximate, tweak as needed)
+    // points: {voltage, state of charge}
     static const struct {
         float v;
-        int p;
+        float soc;
     } lut[] = {
-        {3.00f, 0}, {3.20f, 5}, {3.50f, 20}, {3.70f, 40}, {3.85f, 60}, {4.00f, 80}, {4.10f, 90}, {4.20f, 100}};
-    if (v <= lut[0].v) return 0;
-    if (v >= lut[7].v) return 100;
+        {3.00f, 0.00f}, {3.20f, 0.05f}, {3.50f, 0.20f}, {3.70f, 0.40f},
+        {3.85f, 0.60f}, {4.00f, 0.80f}, {4.10f, 0.90f}, {4.20f, 1.00f}};
+    const int n = sizeof(lut) / sizeof(lut[0]);
+    if (v <= lut[0].v) return 0.0f;
+    if (v >= lut[n - 1].v) return 1.0f;
 
     // find segment and interpolate
-    for (int i = 0; i < 7; ++i) {
+    for (int i = 0; i < n - 1; ++i) {
         if (v <= lut[i + 1].v) {
             float t = (v - lut[i].v) / (lut[i + 1].v - lut[i].v);
-            int p = int(lut[i].p + t * (lut[i + 1].p - lut[i].p) + 0.5f);
-            return p < 0 ? 0 : (p > 100 ? 100 : p);
+            return lut[i].soc + t * (lut[i + 1].soc - lut[i].soc);
         }
     }
-    return 0;  // unreachable
-}
-
-void Battery::add(uint16_t v) {
-    if (!_buf || _window == 0) return;
-
-    if (_count < _window) {
-        _sum += v;
-        _buf[_idx++] = v;
-        _count++;
-        if (_idx == _window) _idx = 0;
-    } else {
-        // window full: subtract outgoing, add incoming
-        _sum -= _buf[_idx];
-        _sum += v;
-        _buf[_idx++] = v;
-        if (_idx == _window) _idx = 0;
-    }
+    return 0.0f;  // unreachable
+}
+
+void Battery::learnCapacity(float socNow) {
+    if (!_learning) return;
+    float span = _anchorSoc - socNow;
+    if (span < _p.learnSpan || _drawnMah <= 0.0f) return;
+
+    // _drawnMah comes from the modelled load, so this measures how far that
+    // model is off as much as the cell; the clamp keeps a bad load guess from
+    // running away. Blend rather than replace: one estimate still carries the
+    // OCV error.
+    float estimate = _drawnMah / span;
+    float learned = _capacityMah + 0.25f * (estimate - _capacityMah);
+    float lo = _p.nominalMah * (1.0f - _p.learnClamp);
+    float hi = _p.nominalMah * (1.0f + _p.learnClamp);
+    _capacityMah = constrain(learned, lo, hi);
+    if (_learnCount < 0xFFFF) _learnCount++;
+
+    Serial.printf("[BATTERY] load-model capacity estimate %.0fmAh over %.0f%% -> %.0fmAh\n", estimate, span * 100.0f,
+                  _capacityMah);
+    saveCalibration();
+}
+
+void Battery::loadCalibration() {
+    Preferences prefs;
+    if (!prefs.begin("battery", true)) return;
+
+    BatteryCalibration c;
+    size_t n = prefs.getBytes("calibration", &c, sizeof(c));
+    prefs.end();
+    if (n != sizeof(c) || c.version != CALIBRATION_VERSION) return;
+    if (c.capacityMah < _p.nominalMah * (1.0f - _p.learnClamp) || c.capacityMah > _p.nominalMah * (1.0f + _p.learnClamp))
+        return;
+
+    _capacityMah = c.capacityMah;
+    _learnCount = c.learnCount;
+    Serial.printf("[BATTERY] learned capacity restored: %.0fmAh (%u estimates)\n", _capacityMah, _learnCount);
+}
+
+void Battery::saveCalibration() {
+    BatteryCalibration c;
+    c.version = CALIBRATION_VERSION;
+    c.learnCount = _learnCount;
+    c.capacityMah = _capacityMah;
+
+    Preferences prefs;
+    if (!prefs.begin("battery", false)) return;
+    prefs.putBytes("calibration", &c, sizeof(c));
+    prefs.end();
 }
@@ -4,39 +4,85 @@
 #include <lvgl.h>
 #include <ui.h>
 
+#include "sampler.h"
+
 extern volatile bool chargerEvent;
 extern volatile bool chargerLevel;
 
 void IRAM_ATTR charger_isr();
 void manageChargingState();
 void updateBatteryUI(bool force = false);
+// Writes a charge level to the battery bars and labels (no sampling, no log)
+void showBatteryUI(int percent);
 
+// Fuel gauge. The pin is read in calibrated millivolts (eFuse ADC
+// characteristics), filtered with an EMA, corrected for I*R sag under the
+// estimated load and mapped to state of charge through the Li-ion OCV curve.
+// Between those voltage estimates charge is integrated from the load/charge
+// current. There is no current sense: that current is the modelled load
+// (setLoadMa), so the capacity "learned" from discharges is the load model's
+// mAh per unit of OCV SoC drop. It calibrates the model, not the cell, and is
+// kept in NVS within learnClamp of the rated capacity.
 class Battery {
    public:
-    explicit Battery(size_t windowSize);
-    ~Battery();
+    struct Params {
+        float    dividerRatio   = 2.0f;     // VBAT / ADC pin voltage
+        float    nominalMah     = 1000.0f;  // rated capacity; starting point for learning
+        float    internalOhm    = 0.15f;    // cell + protection + wiring, for sag compensation
+        float    chargeMa       = 500.0f;   // charger constant-current setting
+        uint32_t filterTauMs    = 4000;     // EMA time constant on the terminal voltage
+        uint32_t ocvTauMs       = 50000;    // time constant pulling the integrated SoC toward the OCV SoC
+        float    learnSpan      = 0.4f;     // SoC drop needed before a capacity estimate is trusted
+        float    learnClamp     = 0.2f;     // learned capacity stays within +-this of nominalMah
+    };
 
-    float average() const;
-    void reset();
+    Battery();
+    explicit Battery(const Params& p);
+    ~Battery() = default;
+
+    // Restores the learned capacity from NVS
+    void begin();
+    // Adaptive-rate sample + charge integration; cheap to call every loop
     void read();
-    size_t count() const { return _count; }
-    size_t capacity() const { return _window; }
-    float voltage(float v_min = 3.0f, float v_max = 4.2f,
-                  uint16_t raw_min = 300, uint16_t raw_max = 2320) const;
-    int percent(float v_min = 3.0f, float v_max = 4.2f, uint16_t raw_min = 300,
-                uint16_t raw_max = 2320) const;
-    void setCharging(bool isCharging) { _isCharging = isCharging; }
+
+    void setCharging(bool isCharging);
     bool isCharging() const { return _isCharging; }
+    // Estimated system draw from the battery (mA), for sag and integration
+    void setLoadMa(float mA) { _loadMa = mA; }
+
+    float voltage() const { return _vFilt; }            // filtered terminal voltage
+    float openCircuitVoltage() const;                   // sag-compensated
+    int   percent() const;
+    // Rated capacity corrected by the load-model calibration
+    float capacityMah() const { return _capacityMah; }
+    float remainingMah() const { return _soc * _capacityMah; }
+    // Minutes until empty at the current load; -1 while charging or unknown
+    int32_t timeToEmptyMin() const;
+    const AdaptiveSampler& sampler() const { return _sampler; }
+
+    void reset();
 
    private:
-    uint16_t* _buf = nullptr;
-    size_t _window = 0;  // window size (N)
-    size_t _idx = 0;     // next write index
-    size_t _count = 0;   // how many valid samples in buffer
-    uint32_t _sum = 0;   // running sum of current window
-    bool _isCharging = false;
-
-    void add(uint16_t v);
+    Params   _p;
+    AdaptiveSampler _sampler;
+    bool     _isCharging = false;
+    bool     _seeded = false;
+    uint32_t _lastSample = 0;
+    float    _loadMa = 0.0f;
+    float    _vFilt = 0.0f;
+    float    _soc = 0.0f;            // 0..1, integrated and OCV-corrected
+    float    _capacityMah = 0.0f;
+
+    // capacity learning: charge drawn since a trusted SoC anchor
+    bool     _learning = false;
+    float    _anchorSoc = 0.0f;
+    float    _drawnMah = 0.0f;
+    uint16_t _learnCount = 0;
+
+    float socFromOcv(float v) const;
+    void  learnCapacity(float socNow);
+    void  loadCalibration();
+    void  saveCalibration();
 };
 
-extern Battery battery;
\ No newline at end of file
+extern Battery battery;
@@ -1,86 +1,105 @@
 // if normal, return transparent color
 // if warning, return yellow with medium opacity
 // if danger, return red with medium opacity
+//
+// Each sensor has one band table. Bands are checked in order and the first
+// one containing the value wins; the last band catches everything else
+// (including NaN). The UI colouring and the publisher's danger levels both
+// read these tables, so a colour change and an alert always coincide.
 
-#pragma once
 #include "danger.h"
 
-ColorOpacity getDangerColorAirQuality(float aqi){
-    if (aqi <= 50.0f) {
-        return {lv_color_hex(0x00E400), 0}; // Normal
-    } else if (aqi <= 100.0f) {
-        return {lv_color_hex(0xFFFF00), 80}; // Moderate
-    } else if (aqi <= 150.0f) {
-        return {lv_color_hex(0xFFA500), 80}; // Unhealthy for Sensitive Groups
-    } else if (aqi <= 200.0f) {
-        return {lv_color_hex(0xFF0000), 80}; // Unhealthy
-    } else if (aqi <= 300.0f) {
-        return {lv_color_hex(0x800080), 80}; // Very Unhealthy
-    } else {
-        return {lv_color_hex(0x800000), 80}; // Hazardous
-    }
-}
+#include <math.h>
 
-ColorOpacity getDangerColorIllumination(float lux){
-    if (lux >= 300.0f) {
-        return {lv_color_hex(0x000000), 0};  // Normal
-    } else if (lux >= 100.0f) {
-        return {lv_color_hex(0xFFFF00), 80};  // Warning
-    } else {
-        return {lv_color_hex(0xFF0000), 80};  // Danger
-    }
-}
+struct DangerBand {
+    float lo;
+    float hi;
+    uint32_t color;
+    uint8_t opacity;  // 0-255
+};
 
-ColorOpacity getDangerColorHumidity(float rh){
-    if (rh >= 30.0f && rh <= 60.0f) {
-        return {lv_color_hex(0x000000), 0};  // Normal
-    } else if ((rh >= 20.0f && rh < 30.0f) || (rh > 60.0f && rh <= 70.0f)) {
-        return {lv_color_hex(0xFFFF00), 80};  // Warning
-    } else {
-        return {lv_color_hex(0xFF0000), 80};  // Danger
-    }
-}
+#define DANGER_BANDS(t) (t), (uint8_t)(sizeof(t) / sizeof((t)[0]))
 
-ColorOpacity getDangerColorTemperature(float celsius){
-    if (celsius >= 20.0f && celsius <= 25.0f) {
-        return {lv_color_hex(0x000000), 0};  // Normal
-    } else if ((celsius >= 15.0f && celsius < 20.0f) || (celsius > 25.0f && celsius <= 30.0f)) {
-        return {lv_color_hex(0xFFFF00), 80}; // Warning
-    } else {
-        return {lv_color_hex(0xFF0000), 80}; // Danger
-    }
-}
+static const DangerBand AIR_QUALITY_BANDS[] = {
+    {-INFINITY, 50.0f, 0x00E400, 0},    // Normal
+    {-INFINITY, 100.0f, 0xFFFF00, 80},  // Moderate
+    {-INFINITY, 150.0f, 0xFFA500, 80},  // Unhealthy for Sensitive Groups
+    {-INFINITY, 200.0f, 0xFF0000, 80},  // Unhealthy
+    {-INFINITY, 300.0f, 0x800080, 80},  // Very Unhealthy
+    {-INFINITY, INFINITY, 0x800000, 80},  // Hazardous
+};
+
+static const DangerBand ILLUMINATION_BANDS[] = {
+    {300.0f, INFINITY, 0x000000, 0},      // Normal
+    {100.0f, INFINITY, 0xFFFF00, 80},     // Warning
+    {-INFINITY, INFINITY, 0xFF0000, 80},  // Danger
+};
 
-ColorOpacity getDangerColorPressure(float hpa){
-    if (hpa >= 1013.0f && hpa <= 1020.0f) {
-        return {lv_color_hex(0x000000), 0}; // Normal
-    } else if ((hpa >= 1000.0f && hpa < 1013.0f) || (hpa > 1020.0f && hpa <= 1030.0f)) {
-        return {lv_color_hex(0xFFFF00), 80}; // Warning
-    } else {
-        return {lv_color_hex(0xFF0000), 80}; // Danger
+static const DangerBand HUMIDITY_BANDS[] = {
+    {30.0f, 60.0f, 0x000000, 0},          // Normal
+    {20.0f, 70.0f, 0xFFFF00, 80},         // Warning
+    {-INFINITY, INFINITY, 0xFF0000, 80},  // Danger
+};
+
+static const DangerBand TEMPERATURE_BANDS[] = {
+    {20.0f, 25.0f, 0x000000, 0},          // Normal
+    {15.0f, 30.0f, 0xFFFF00, 80},         // Warning
+    {-INFINITY, INFINITY, 0xFF0000, 80},  // Danger
+};
+
+static const DangerBand PRESSURE_BANDS[] = {
+    {1013.0f, 1020.0f, 0x000000, 0},      // Normal
+    {1000.0f, 1030.0f, 0xFFFF00, 80},     // Warning
+    {-INFINITY, INFINITY, 0xFF0000, 80},  // Danger
+};
+
+static const DangerBand LOUDNESS_BANDS[] = {
+    {-INFINITY, 70.0f, 0x000000, 0},      // Normal
+    {-INFINITY, 85.0f, 0xFFFF00, 80},     // Warning
+    {-INFINITY, INFINITY, 0xFF0000, 80},  // Danger
+};
+
+static const DangerBand UV_INDEX_BANDS[] = {
+    {-INFINITY, 2.0f, 0x000000, 0},       // Normal
+    {-INFINITY, 5.0f, 0xFFFF00, 80},      // Moderate
+    {-INFINITY, 7.0f, 0xFFA500, 80},      // High
+    {-INFINITY, 10.0f, 0xFF0000, 80},     // Very High
+    {-INFINITY, INFINITY, 0x800080, 80},  // Extreme
+};
+
+static uint8_t dangerLevel(const DangerBand* bands, uint8_t count, float v) {
+    for (uint8_t i = 0; i + 1 < count; ++i) {
+        if (v >= bands[i].lo && v <= bands[i].hi) return i;
     }
+    return count - 1;
 }
 
-ColorOpacity getDangerColorLoudness(float db){
-    if (db <= 70.0f) {
-        return {lv_color_hex(0x000000), 0}; // Normal
-    } else if (db <= 85.0f) {
-        return {lv_color_hex(0xFFFF00), 80}; // Warning
-    } else {
-        return {lv_color_hex(0xFF0000), 80}; // Danger
-    }
+static ColorOpacity dangerColor(const DangerBand* bands, uint8_t count, float v) {
+    const DangerBand& b = bands[dangerLevel(bands, count, v)];
+    return {lv_color_hex(b.color), b.opacity};
 }
 
-ColorOpacity getDangerColorUVIndex(float uvi){
-    if (uvi <= 2.0f) {
-        return {lv_color_hex(0x000000), 0}; // Normal
-    } else if (uvi <= 5.0f) {
-        return {lv_color_hex(0xFFFF00), 80}; // Moderate
-    } else if (uvi <= 7.0f) {
-        return {lv_color_hex(0xFFA500), 80}; // High
-    } else if (uvi <= 10.0f) {
-        return {lv_color_hex(0xFF0000), 80}; // Very High
-    } else {
-        return {lv_color_hex(0x800080), 80}; // Extreme
-    }
+uint8_t getDangerLevelAirQuality(float aqi) { return dangerLevel(DANGER_BANDS(AIR_QUALITY_BANDS), aqi); }
+uint8_t getDangerLevelIllumination(float lux) { return dangerLevel(DANGER_BANDS(ILLUMINATION_BANDS), lux); }
+uint8_t getDangerLevelHumidity(float rh) { return dangerLevel(DANGER_BANDS(HUMIDITY_BANDS), rh); }
+uint8_t getDangerLevelTemperature(float celsius) { return dangerLevel(DANGER_BANDS(TEMPERATURE_BANDS), celsius); }
+uint8_t getDangerLevelPressure(float hpa) { return dangerLevel(DANGER_BANDS(PRESSURE_BANDS), hpa); }
+uint8_t getDangerLevelLoudness(float db) { return dangerLevel(DANGER_BANDS(LOUDNESS_BANDS), db); }
+uint8_t getDangerLevelUVIndex(float uvi) { return dangerLevel(DANGER_BANDS(UV_INDEX_BANDS), uvi); }
+
+ColorOpacity getDangerColorAirQuality(float aqi) { return dangerColor(DANGER_BANDS(AIR_QUALITY_BANDS), aqi); }
+ColorOpacity getDangerColorIllumination(float lux) { return dangerColor(DANGER_BANDS(ILLUMINATION_BANDS), lux); }
+ColorOpacity getDangerColorHumidity(float rh) { return dangerColor(DANGER_BANDS(HUMIDITY_BANDS), rh); }
+ColorOpacity getDangerColorTemperature(float celsius) { return dangerColor(DANGER_BANDS(TEMPERATURE_BANDS), celsius); }
+ColorOpacity getDangerColorPressure(float hpa) { return dangerColor(DANGER_BANDS(PRESSURE_BANDS), hpa); }
+ColorOpacity getDangerColorLoudness(float db) { return dangerColor(DANGER_BANDS(LOUDNESS_BANDS), db); }
+ColorOpacity getDangerColorUVIndex(float uvi) { return dangerColor(DANGER_BANDS(UV_INDEX_BANDS), uvi); }
+
+void setDangerTile(lv_obj_t* tile, ColorOpacity co) {
+  if (lv_obj_get_style_bg_color(tile, LV_PART_MAIN).full != co.color.full) {
+    lv_obj_set_style_bg_color(tile, co.color, LV_PART_MAIN | LV_STATE_DEFAULT);
+  }
+  if (lv_obj_get_style_bg_opa(tile, LV_PART_MAIN) != co.opacity) {
+    lv_obj_set_style_bg_opa(tile, co.opacity, LV_PART_MAIN | LV_STATE_DEFAULT);
+  }
 }
@@ -15,10 +15,25 @@ struct ColorOpacity {
   uint8_t opacity;  // 0-255
 };
 
+// Band index for a reading: 0 = normal, higher = worse. Shares the tables
+// behind the colours below.
+uint8_t getDangerLevelAirQuality(float aqi);
+uint8_t getDangerLevelIllumination(float lux);
+uint8_t getDangerLevelHumidity(float rh);
+uint8_t getDangerLevelTemperature(float celsius);
+uint8_t getDangerLevelPressure(float hpa);
+uint8_t getDangerLevelLoudness(float db);
+uint8_t getDangerLevelUVIndex(float uvi);
+
 ColorOpacity getDangerColorAirQuality(float aqi);
 ColorOpacity getDangerColorIllumination(float lux);
 ColorOpacity getDangerColorHumidity(float rh);
 ColorOpacity getDangerColorTemperature(float celsius);
 ColorOpacity getDangerColorPressure(float hpa);
 ColorOpacity getDangerColorLoudness(float db);
-ColorOpacity getDangerColorUVIndex(float uvi);
\ No newline at end of file
+ColorOpacity getDangerColorUVIndex(float uvi);
+
+// Colours a sensor tile's background. Does nothing when the tile already has
+// this colour and opacity, so an update within the same band doesn't redraw
+// the whole tile.
+void setDangerTile(lv_obj_t* tile, ColorOpacity co);
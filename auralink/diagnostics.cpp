@@ -0,0 +1,27 @@
+#include "diagnostics.h"
+
+#include "User_Setup.h"
+#include "memory_tiers.h"
+#include "sampler.h"
+
+void updateDiagnostics(bool force) {
+    static uint32_t lastUpdate = 0;
+    uint32_t now = millis();
+    if ((now - lastUpdate) < DIAGNOSTICS_INTERVAL_MS && !force) return;
+    lastUpdate = now;
+
+    for (uint8_t i = 0; i < AdaptiveSampler::count(); ++i) {
+        const AdaptiveSampler* s = AdaptiveSampler::at(i);
+        Serial.printf("[DIAG] %-16s %7lums %6.2fHz samples=%lu misses=%lu%s\n", s->name(),
+                      (unsigned long)s->intervalMs(), s->rateHz(), (unsigned long)s->samples(),
+                      (unsigned long)s->misses(), s->active() ? " (active)" : "");
+    }
+    for (uint8_t i = 0; i < kMemTierCount; ++i) {
+        const MemTier t = (MemTier)i;
+        const MemTierStats& m = memTierStats(t);
+        Serial.printf("[DIAG] mem %-8s used=%lu peak=%lu allocs=%lu fallbacks=%lu failed=%lu free=%lu largest=%lu\n",
+                      memTierName(t), (unsigned long)m.inUse, (unsigned long)m.peak, (unsigned long)m.allocs,
+                      (unsigned long)m.fallbacks, (unsigned long)m.failures, (unsigned long)memTierFree(t),
+                      (unsigned long)memTierLargestFree(t));
+    }
+}
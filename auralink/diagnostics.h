@@ -0,0 +1,6 @@
+#pragma once
+#include <Arduino.h>
+
+// Periodic "[DIAG]" report on Serial: live sampling rate of every sensor and
+// the usage and high-water mark of each memory tier
+void updateDiagnostics(bool force = false);
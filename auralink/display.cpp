@@ -2,6 +2,9 @@
 
 #include <Arduino.h>
 
+#include "User_Setup.h"
+#include "memory_tiers.h"
+
 bool Display::begin(uint16_t w, uint16_t h, uint8_t rotation) {
   _w = w; _h = h;
   _tft = TFT_eSPI(_w, _h);   // re-construct with dimensions
@@ -15,11 +18,7 @@ bool Display::begin(uint16_t w, uint16_t h, uint8_t rotation) {
 
   // allocate a modest LVGL draw buffer (1/10th of screen)
   size_t buf_px = (_w * _h) / 10;
-  _buf1 = (lv_color_t*) heap_caps_malloc(buf_px * sizeof(lv_color_t), MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
-  if (!_buf1) {
-    // fallback to regular heap
-    _buf1 = (lv_color_t*) malloc(buf_px * sizeof(lv_color_t));
-  }
+  _buf1 = (lv_color_t*) memAlloc(MemTier::Dma, buf_px * sizeof(lv_color_t));
   if (!_buf1) return false;
 
   lv_disp_draw_buf_init(&_draw_buf, _buf1, nullptr, buf_px);
@@ -30,6 +29,9 @@ bool Display::begin(uint16_t w, uint16_t h, uint8_t rotation) {
   _disp_drv.ver_res = _h;
   _disp_drv.draw_buf = &_draw_buf;
   _disp_drv.flush_cb = &Display::_flush_cb;
+#if SCREEN_AREA_ALIGN_X > 1 || SCREEN_AREA_ALIGN_Y > 1
+  _disp_drv.rounder_cb = &Display::_rounder_cb;
+#endif
   _disp_drv.user_data = this;            // pass instance to callback
   _lv_disp = lv_disp_drv_register(&_disp_drv);
 
@@ -54,12 +56,23 @@ void Display::_flush(const lv_area_t* area, lv_color_t* color_p) {
 
   _tft.startWrite();
   _tft.setAddrWindow(area->x1, area->y1, w, h);
-  _tft.pushColors((uint16_t*)&color_p->full, w * h, true);
+  // LVGL renders in the panel's byte order (LV_COLOR_16_SWAP), so this is a plain copy
+  _tft.pushPixels(color_p, w * h);
   _tft.endWrite();
 
   lv_disp_flush_ready(&_disp_drv);
 }
 
+// Rounds an invalidated area out to the panel's address-window granularity.
+// LVGL joins areas after rounding, so joined areas stay aligned too.
+/* static */ void Display::_rounder_cb(lv_disp_drv_t* disp, lv_area_t* area) {
+  constexpr lv_coord_t ax = SCREEN_AREA_ALIGN_X, ay = SCREEN_AREA_ALIGN_Y;
+  area->x1 -= area->x1 % ax;
+  area->y1 -= area->y1 % ay;
+  area->x2 = LV_MIN(area->x2 + ax - 1 - area->x2 % ax, disp->hor_res - 1);
+  area->y2 = LV_MIN(area->y2 + ay - 1 - area->y2 % ay, disp->ver_res - 1);
+}
+
 /* static */ void Display::_touch_read_cb(lv_indev_drv_t* indev, lv_indev_data_t* data) {
   // No TFT touch; keep LVGL happy with "not pressed"
   data->state = LV_INDEV_STATE_REL;
@@ -9,18 +9,20 @@ class Display {
     // rotation: 0..3 like TFT_eSPI
     bool begin(uint16_t w, uint16_t h, uint8_t rotation = 0);
 
-    // call every loop iteration
-    inline void loop() { lv_timer_handler(); }
+    // call every loop iteration; returns the ms until LVGL's next timer is due
+    inline uint32_t loop() { return lv_timer_handler(); }
 
     // Accessors
     inline lv_disp_t* lvDisplay() const { return _lv_disp; }
     inline uint16_t width() const { return _w; }
     inline uint16_t height() const { return _h; }
+    inline TFT_eSPI& tft() { return _tft; }
 
    private:
     // LVGL callbacks (static thunks -> instance)
     static void _flush_cb(lv_disp_drv_t* disp, const lv_area_t* area,
                           lv_color_t* color_p);
+    static void _rounder_cb(lv_disp_drv_t* disp, lv_area_t* area);
     static void _touch_read_cb(lv_indev_drv_t* indev, lv_indev_data_t* data);
 
     // Instance methods
@@ -28,7 +30,7 @@ class Display {
 
     // Members
     uint16_t _w = 0, _h = 0;
-    TFT_eSPI _tft{_w, _h};  // TFT_eSPI can accept (w,h) ctor
+    TFT_eSPI _tft{(int16_t)_w, (int16_t)_h};  // TFT_eSPI can accept (w,h) ctor
     lv_disp_t* _lv_disp = nullptr;
 
     lv_color_t* _buf1 = nullptr;
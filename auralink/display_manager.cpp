@@ -2,6 +2,8 @@
 
 #include <Arduino.h>
 
+#include "memory_tiers.h"
+
 DisplayManager* DisplayManager::_self = nullptr;
 
 DisplayManager::DisplayManager(int leftPin, int rightPin)
@@ -42,6 +44,8 @@ void DisplayManager::begin(lv_obj_t** screens, uint8_t screen_count) {
 
   // Load the first non-null screen
   lv_scr_load(_screens[_idx]);
+  for (uint8_t i = 0; i < _count; ++i) if (_screens[i]) lv_obj_set_y(_screens[i], _p.screen_y);
+  if (_p.snapshot_slides) _initSlides();
 
   if (_p.set_pinmode) {
     pinMode(_left.pin,  _p.pinmode ? _p.pinmode : INPUT_PULLDOWN);
@@ -82,6 +86,16 @@ void DisplayManager::setActive(uint8_t idx) {
   _resetTimer();
 }
 
+void DisplayManager::setAutoRotate(bool on) {
+  if (!_timer) return;
+  if (on) {
+    lv_timer_reset(_timer);
+    lv_timer_resume(_timer);
+  } else {
+    lv_timer_pause(_timer);
+  }
+}
+
 void DisplayManager::_rotate_cb(lv_timer_t* /*t*/) {
   if (_self) _self->_rotate();
 }
@@ -103,10 +117,100 @@ void DisplayManager::_load(uint8_t idx, lv_scr_load_anim_t anim) {
     Serial.printf("[DisplayManager] ERROR: _load(%u) null screen; skipped.\n", idx);
     return;
   }
+  if (_sliding) _finishSlide();
+  if (_stage && (anim == LV_SCR_LOAD_ANIM_MOVE_LEFT || anim == LV_SCR_LOAD_ANIM_MOVE_RIGHT) && _slide(idx, anim)) {
+    _idx = idx;
+    return;
+  }
   lv_scr_load_anim(_screens[idx], anim, _p.anim_time_ms, 0, false);
+  // lv_scr_load_anim() puts both screens back at (0,0); the slide only moves
+  // them horizontally, so the area under the top-layer bar is never redrawn.
+  // The incoming screen is not laid out until the animation starts; do it
+  // now so its first frame does not invalidate its stale (0,0) area.
+  lv_obj_set_y(_screens[idx], _p.screen_y);
+  lv_obj_set_y(lv_scr_act(), _p.screen_y);
+  lv_obj_update_layout(_screens[idx]);
   _idx = idx;
 }
 
+void DisplayManager::_initSlides() {
+  uint32_t need = 0;
+  for (uint8_t i = 0; i < _count; ++i) {
+    if (_screens[i]) need = max(need, lv_snapshot_buf_size_needed(_screens[i], LV_IMG_CF_TRUE_COLOR));
+  }
+  for (auto& buf : _snapBuf) buf = (uint8_t*)memAlloc(MemTier::Psram, need);
+  if (!_snapBuf[0] || !_snapBuf[1]) {
+    Serial.printf("[DisplayManager] WARN: no memory for 2x%lu B of snapshots; slides render live.\n",
+                  (unsigned long)need);
+    for (auto& buf : _snapBuf) { memFree(buf); buf = nullptr; }
+    return;
+  }
+  _snapSize = need;
+
+  // A screen of its own holding the two images, so the real screens are
+  // left untouched while the slide runs
+  _stage = lv_obj_create(NULL);
+  lv_obj_remove_style_all(_stage);
+  lv_obj_clear_flag(_stage, LV_OBJ_FLAG_SCROLLABLE);
+  for (auto& img : _img) img = lv_img_create(_stage);
+  Serial.printf("[DisplayManager] snapshot slides: 2x%lu B\n", (unsigned long)need);
+}
+
+static void _anim_x(void* obj, int32_t v) {
+  lv_obj_set_x((lv_obj_t*)obj, v);
+}
+
+bool DisplayManager::_slide(uint8_t idx, lv_scr_load_anim_t anim) {
+  lv_obj_t* from = lv_scr_act();
+  lv_obj_t* to   = _screens[idx];
+  lv_disp_t* d   = lv_obj_get_disp(to);
+  // Same screen, or a fade still running: leave it to lv_scr_load_anim()
+  if (from == to || d->scr_to_load) return false;
+
+  lv_obj_update_layout(to);
+  if (lv_snapshot_take_to_buf(from, LV_IMG_CF_TRUE_COLOR, &_snap[0], _snapBuf[0], _snapSize) != LV_RES_OK ||
+      lv_snapshot_take_to_buf(to, LV_IMG_CF_TRUE_COLOR, &_snap[1], _snapBuf[1], _snapSize) != LV_RES_OK) {
+    Serial.println("[DisplayManager] WARN: snapshot failed; sliding live.");
+    return false;
+  }
+
+  // Same start/end values and timing as lv_scr_load_anim() moves the screens
+  const lv_coord_t w = lv_disp_get_hor_res(d);
+  const lv_coord_t out = (anim == LV_SCR_LOAD_ANIM_MOVE_LEFT) ? -w : w;
+  for (uint8_t i = 0; i < 2; ++i) {
+    lv_img_set_src(_img[i], &_snap[i]);
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, _img[i]);
+    lv_anim_set_exec_cb(&a, _anim_x);
+    lv_anim_set_values(&a, i ? -out : 0, i ? 0 : out);
+    lv_anim_set_time(&a, _p.anim_time_ms);
+    if (i) lv_anim_set_ready_cb(&a, &_slide_ready_cb);
+    lv_obj_set_x(_img[i], a.start_value);
+    lv_anim_start(&a);
+  }
+
+  // lv_scr_load() puts both screens at (0,0); put them back below the bar
+  lv_scr_load(_stage);
+  lv_obj_set_y(_stage, _p.screen_y);
+  lv_obj_set_y(from, _p.screen_y);
+  _sliding = true;
+  return true;
+}
+
+void DisplayManager::_finishSlide() {
+  if (!_sliding) return;
+  _sliding = false;
+  for (auto* img : _img) lv_anim_del(img, nullptr);
+  lv_scr_load(_screens[_idx]);
+  lv_obj_set_y(_screens[_idx], _p.screen_y);
+  lv_obj_set_y(_stage, _p.screen_y);
+}
+
+void DisplayManager::_slide_ready_cb(lv_anim_t* /*a*/) {
+  if (_self) _self->_finishSlide();
+}
+
 bool DisplayManager::_pollBtn(Btn& b) {
   uint32_t now = millis();
   int raw = digitalRead(b.pin);
@@ -123,6 +227,13 @@ bool DisplayManager::_pollBtn(Btn& b) {
 }
 
 void DisplayManager::_readButtons() {
-  if (_pollBtn(_left))  prev();
-  if (_pollBtn(_right)) next();
+  if (_pollBtn(_left)  && !_turnPage(-1)) prev();
+  if (_pollBtn(_right) && !_turnPage(+1)) next();
+}
+
+bool DisplayManager::_turnPage(int8_t dir) {
+  if (!_pageFn || !_screens || _sliding) return false;
+  if (!_pageFn(_screens[_idx], dir)) return false;
+  _resetTimer();  // a full rotation interval to read the new page
+  return true;
 }
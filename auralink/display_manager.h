@@ -10,6 +10,8 @@ public:
     bool     active_high        = true;
     bool     set_pinmode        = true;
     uint8_t  pinmode            = 0x0;
+    lv_coord_t screen_y         = 0;     // screens sit this far down, below a bar on lv_layer_top()
+    bool     snapshot_slides    = true;  // slide two cached bitmaps instead of re-rendering both screens per frame
   };
 
   DisplayManager(int leftPin, int rightPin);
@@ -22,6 +24,14 @@ public:
   void next();
   void prev();
   void setActive(uint8_t idx);
+  uint8_t active() const { return _idx; }
+  // Pause/resume the automatic rotation timer (buttons keep working)
+  void setAutoRotate(bool on);
+
+  // Given the active screen and -1/+1, turns a page within it and returns
+  // true, or returns false to let the button change screens
+  using PageFn = bool (*)(lv_obj_t* screen, int8_t dir);
+  void setPageHandler(PageFn fn) { _pageFn = fn; }
 
 private:
   struct Btn {
@@ -34,14 +44,29 @@ private:
   void _rotate();
   void _resetTimer();
   void _load(uint8_t idx, lv_scr_load_anim_t anim);
+  // Snapshot slides: both screens are rendered once into _snap and only the
+  // two images on _stage move; the real screen is loaded when they stop.
+  void _initSlides();
+  bool _slide(uint8_t idx, lv_scr_load_anim_t anim);
+  void _finishSlide();
+  static void _slide_ready_cb(lv_anim_t* a);
   bool _pollBtn(Btn& b);
   void _readButtons();
+  bool _turnPage(int8_t dir);
 
   lv_obj_t** _screens = nullptr;
   uint8_t    _count   = 0;
   uint8_t    _idx     = 0;
 
   lv_timer_t* _timer  = nullptr;
+  PageFn      _pageFn = nullptr;
+
+  lv_obj_t*    _stage   = nullptr;        // null when snapshot slides are off or out of memory
+  lv_obj_t*    _img[2]  = {};             // outgoing, incoming
+  lv_img_dsc_t _snap[2] = {};
+  uint8_t*     _snapBuf[2] = {};
+  uint32_t     _snapSize = 0;
+  bool         _sliding = false;
 
   Btn     _left, _right;
   Params  _p;
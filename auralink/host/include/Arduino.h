@@ -0,0 +1,146 @@
+// Host (Linux) stand-in for the ESP32 Arduino core. Covers the subset of the
+// API used by the AuraLink firmware and its vendored libraries. Time, GPIO and
+// ADC are backed by the simulator in sim.h.
+#pragma once
+
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef ARDUINO
+#define ARDUINO 10819
+#endif
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT             0x01
+#define OUTPUT            0x03
+#define PULLUP            0x04
+#define INPUT_PULLUP      0x05
+#define PULLDOWN          0x08
+#define INPUT_PULLDOWN    0x09
+#define OPEN_DRAIN        0x10
+#define OUTPUT_OPEN_DRAIN 0x13
+
+#define RISING  0x01
+#define FALLING 0x02
+#define CHANGE  0x03
+
+#define IRAM_ATTR
+#define PROGMEM
+#define PGM_P const char*
+#define PSTR(s) (s)
+#define pgm_read_byte(addr)  (*(const unsigned char*)(addr))
+#define pgm_read_byte_near(addr) pgm_read_byte(addr)
+#define pgm_read_word(addr)  (*(const unsigned short*)(addr))
+#define pgm_read_dword(addr) (*(const unsigned long*)(addr))
+#define strlen_P strlen
+#define strcpy_P strcpy
+#define memcpy_P memcpy
+
+#define MALLOC_CAP_EXEC     (1 << 0)
+#define MALLOC_CAP_32BIT    (1 << 1)
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_DEFAULT  (1 << 12)
+
+typedef enum {
+  ADC_0db,
+  ADC_2_5db,
+  ADC_6db,
+  ADC_11db,
+} adc_attenuation_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield(void);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+uint16_t analogRead(uint8_t pin);
+uint32_t analogReadMilliVolts(uint8_t pin);
+void analogReadResolution(uint8_t bits);
+void analogSetPinAttenuation(uint8_t pin, adc_attenuation_t attenuation);
+
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode);
+void detachInterrupt(uint8_t pin);
+void noInterrupts(void);
+void interrupts(void);
+
+void* heap_caps_malloc(size_t size, uint32_t caps);
+void* heap_caps_calloc(size_t n, size_t size, uint32_t caps);
+void* heap_caps_realloc(void* ptr, size_t size, uint32_t caps);
+void heap_caps_free(void* ptr);
+size_t heap_caps_get_free_size(uint32_t caps);
+size_t heap_caps_get_largest_free_block(uint32_t caps);
+
+#if !defined(__GLIBC__) || __GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38)
+size_t strlcpy(char* dst, const char* src, size_t size);  // newlib has it, older glibc does not
+#endif
+
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char* server1);
+bool getLocalTime(struct tm* info, uint32_t ms);
+
+#ifdef __cplusplus
+}  // extern "C"
+
+#include <algorithm>
+#include <cmath>
+
+#include "HardwareSerial.h"
+#include "Print.h"
+#include "Stream.h"
+#include "WString.h"
+
+typedef bool boolean;
+typedef uint8_t byte;
+typedef unsigned int word;
+
+using std::isfinite;
+using std::isinf;
+using std::isnan;
+using std::max;
+using std::min;
+
+#define digitalPinToInterrupt(p) (p)
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define _BV(bit) (1UL << (bit))
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+class EspClass {
+ public:
+  uint64_t getEfuseMac();
+  uint32_t getFreeHeap();
+  uint32_t getHeapSize();
+  uint32_t getMinFreeHeap();
+  uint32_t getPsramSize();
+  uint32_t getFreePsram();
+  // Host CPU time in nanoseconds, presented as a 1000 MHz cycle counter so
+  // cycle-based measurements read real time even on the virtual clock
+  uint32_t getCycleCount();
+  uint32_t getCpuFreqMHz() { return 1000; }
+  void restart();
+};
+
+extern EspClass ESP;
+
+#endif  // __cplusplus
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Arduino.h"
+
+class IPAddress : public Printable {
+ public:
+  IPAddress() : IPAddress(0, 0, 0, 0) {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _b{a, b, c, d} {}
+  IPAddress(uint32_t addr) { memcpy(_b, &addr, 4); }
+  IPAddress(const uint8_t* addr) { memcpy(_b, addr, 4); }
+
+  bool fromString(const char* s);
+  String toString() const;
+
+  operator uint32_t() const { uint32_t v; memcpy(&v, _b, 4); return v; }
+  bool operator==(const IPAddress& o) const { return memcmp(_b, o._b, 4) == 0; }
+  bool operator!=(const IPAddress& o) const { return !(*this == o); }
+  uint8_t operator[](int i) const { return _b[i]; }
+  uint8_t& operator[](int i) { return _b[i]; }
+
+  size_t printTo(Print& p) const override;
+
+ private:
+  uint8_t _b[4];
+};
@@ -0,0 +1,29 @@
+// Host stand-in for the ESP32 Preferences (NVS) library. Namespaces live in
+// memory for the lifetime of the process.
+#pragma once
+
+#include <Arduino.h>
+
+class Preferences {
+ public:
+  bool begin(const char* name, bool readOnly = false, const char* partition = nullptr);
+  void end();
+
+  bool clear();
+  bool remove(const char* key);
+  bool isKey(const char* key);
+
+  size_t putBytes(const char* key, const void* value, size_t len);
+  size_t getBytes(const char* key, void* buf, size_t maxLen);
+  size_t getBytesLength(const char* key);
+
+  size_t putUInt(const char* key, uint32_t value);
+  uint32_t getUInt(const char* key, uint32_t defaultValue = 0);
+  size_t putFloat(const char* key, float value);
+  float getFloat(const char* key, float defaultValue = NAN);
+
+ private:
+  String _ns;
+  bool _open = false;
+  bool _readOnly = false;
+};
@@ -0,0 +1,9 @@
+#pragma once
+
+class Print;
+
+class Printable {
+ public:
+  virtual ~Printable() = default;
+  virtual size_t printTo(Print& p) const = 0;
+};
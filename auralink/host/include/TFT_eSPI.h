@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Arduino.h"
+
+// Headless ST7735 stand-in. Pixels pushed through the address window land in
+// an in-memory RGB565 framebuffer that tests and benchmarks can inspect.
+class TFT_eSPI {
+ public:
+  TFT_eSPI(int16_t w = 128, int16_t h = 160);
+
+  void init() { begin(); }
+  void begin();
+  void setRotation(uint8_t r);
+  uint8_t getRotation() const { return _rotation; }
+  int16_t width() const { return _w; }
+  int16_t height() const { return _h; }
+
+  void startWrite() {}
+  void endWrite() {}
+  void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h);
+  // swap: pixels are little-endian RGB565 and must be byte-swapped for the panel
+  void pushColors(uint16_t* data, uint32_t len, bool swap = true);
+  void pushPixels(const void* data, uint32_t len);
+  void fillScreen(uint32_t color);
+
+  // Framebuffer in panel (big-endian RGB565) byte order
+  const uint16_t* framebuffer() const { return _fb; }
+  uint32_t pixelsPushed() const { return _pushed; }
+  uint32_t flushes() const { return _flushes; }
+
+ private:
+  static constexpr int kMaxPixels = 160 * 160;
+
+  int16_t  _w, _h;
+  uint8_t  _rotation = 0;
+  int32_t  _wx = 0, _wy = 0, _ww = 0, _wh = 0;
+  uint32_t _cursor = 0;
+  uint32_t _pushed = 0;
+  uint32_t _flushes = 0;
+  uint16_t _fb[kMaxPixels];
+
+  void _put(uint16_t panelPixel);
+};
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+class __FlashStringHelper;
+
+// Arduino String on top of std::string
+class String {
+ public:
+  String() = default;
+  String(const char* s) : _s(s ? s : "") {}
+  String(const char* s, size_t n) : _s(s ? s : "", s ? n : 0) {}
+  String(const __FlashStringHelper* s) : String(reinterpret_cast<const char*>(s)) {}
+  String(const std::string& s) : _s(s) {}
+  explicit String(char c) : _s(1, c) {}
+  explicit String(unsigned char n, unsigned char base = 10);
+  explicit String(int n, unsigned char base = 10);
+  explicit String(unsigned int n, unsigned char base = 10);
+  explicit String(long n, unsigned char base = 10);
+  explicit String(unsigned long n, unsigned char base = 10);
+  explicit String(long long n, unsigned char base = 10);
+  explicit String(unsigned long long n, unsigned char base = 10);
+  explicit String(float n, unsigned int decimals = 2);
+  explicit String(double n, unsigned int decimals = 2);
+
+  const char* c_str() const { return _s.c_str(); }
+  unsigned int length() const { return (unsigned int)_s.size(); }
+  bool isEmpty() const { return _s.empty(); }
+  bool reserve(unsigned int size) { _s.reserve(size); return true; }
+  void clear() { _s.clear(); }
+
+  bool concat(const String& s) { _s += s._s; return true; }
+  bool concat(const char* s) { if (s) _s += s; return s != nullptr; }
+  bool concat(const char* s, unsigned int n) { if (s) _s.append(s, n); return s != nullptr; }
+  bool concat(char c) { _s += c; return true; }
+  template <typename T>
+  bool concat(T v) { return concat(String(v)); }
+
+  template <typename T>
+  String& operator+=(const T& v) { concat(v); return *this; }
+
+  bool equals(const String& s) const { return _s == s._s; }
+  bool equals(const char* s) const { return s && _s == s; }
+  bool operator==(const String& s) const { return equals(s); }
+  bool operator==(const char* s) const { return equals(s); }
+  bool operator!=(const String& s) const { return !equals(s); }
+  bool operator!=(const char* s) const { return !equals(s); }
+  bool operator<(const String& s) const { return _s < s._s; }
+  int compareTo(const String& s) const { return _s.compare(s._s); }
+
+  char charAt(unsigned int i) const { return i < _s.size() ? _s[i] : 0; }
+  char operator[](unsigned int i) const { return charAt(i); }
+  char& operator[](unsigned int i) { return _s[i]; }
+
+  int indexOf(char c, unsigned int from = 0) const;
+  int indexOf(const String& s, unsigned int from = 0) const;
+  int lastIndexOf(char c) const;
+  String substring(unsigned int from) const;
+  String substring(unsigned int from, unsigned int to) const;
+  bool startsWith(const String& s) const { return _s.compare(0, s._s.size(), s._s) == 0; }
+  bool endsWith(const String& s) const;
+  void trim();
+  void toLowerCase();
+  void toUpperCase();
+  void replace(const String& from, const String& to);
+  void remove(unsigned int index, unsigned int count = (unsigned int)-1);
+
+  long toInt() const;
+  float toFloat() const;
+  double toDouble() const;
+
+  const std::string& str() const { return _s; }
+
+ private:
+  std::string _s;
+};
+
+class StringSumHelper : public String {
+ public:
+  using String::String;
+  StringSumHelper(const String& s) : String(s) {}
+};
+
+inline StringSumHelper operator+(const String& a, const String& b) {
+  StringSumHelper r(a);
+  r.concat(b);
+  return r;
+}
+inline StringSumHelper operator+(const String& a, const char* b) {
+  StringSumHelper r(a);
+  r.concat(b);
+  return r;
+}
+inline StringSumHelper operator+(const char* a, const String& b) {
+  StringSumHelper r(a);
+  r.concat(b);
+  return r;
+}
+inline StringSumHelper operator+(const String& a, char b) {
+  StringSumHelper r(a);
+  r.concat(b);
+  return r;
+}
+template <typename T>
+inline StringSumHelper operator+(const String& a, T b) {
+  StringSumHelper r(a);
+  r.concat(String(b));
+  return r;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Arduino.h"
+#include "Client.h"
+#include "IPAddress.h"
+
+typedef enum {
+  WL_NO_SHIELD = 255,
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_SCAN_COMPLETED = 2,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED = 6,
+} wl_status_t;
+
+typedef enum {
+  WIFI_OFF = 0,
+  WIFI_STA = 1,
+  WIFI_AP = 2,
+  WIFI_AP_STA = 3,
+} wifi_mode_t;
+
+// Station interface. The host is always "connected" once begin() has been
+// called unless the simulator takes the link down (sim::setWifiUp).
+class WiFiClass {
+ public:
+  wl_status_t status();
+  bool mode(wifi_mode_t m) { _mode = m; return true; }
+  void persistent(bool) {}
+  bool setHostname(const char* name);
+  const char* getHostname() const { return _hostname.c_str(); }
+  bool setAutoReconnect(bool v) { _autoReconnect = v; return true; }
+  wl_status_t begin(const char* ssid, const char* pass = nullptr);
+  bool disconnect(bool wifiOff = false, bool eraseAp = false);
+  IPAddress localIP();
+  int8_t RSSI();
+  String macAddress();
+
+ private:
+  wifi_mode_t _mode = WIFI_OFF;
+  String _hostname = "AuraLink";
+  bool _autoReconnect = true;
+  bool _begun = false;
+};
+
+extern WiFiClass WiFi;
+
+// Plain TCP client on a POSIX socket, so MqttClient can talk to a local broker
+class WiFiClient : public Client {
+ public:
+  WiFiClient() = default;
+  ~WiFiClient() override;
+  WiFiClient(const WiFiClient&) = delete;
+  WiFiClient& operator=(const WiFiClient&) = delete;
+
+  int connect(IPAddress ip, uint16_t port) override;
+  int connect(const char* host, uint16_t port) override;
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* buf, size_t size) override;
+  using Print::write;
+  int available() override;
+  int read() override;
+  int read(uint8_t* buf, size_t size) override;
+  int peek() override;
+  void flush() override {}
+  void stop() override;
+  uint8_t connected() override;
+  operator bool() override { return connected(); }
+
+ private:
+  int _fd = -1;
+  int _peeked = -1;
+};
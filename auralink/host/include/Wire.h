@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Arduino.h"
+
+#define I2C_BUFFER_LENGTH 128
+
+// I2C controller. Transactions are routed to the simulated devices
+// registered with sim::attachI2C().
+class TwoWire : public Stream {
+ public:
+  explicit TwoWire(uint8_t bus) : _bus(bus) {}
+
+  bool begin();
+  bool begin(int sda, int scl, uint32_t frequency = 0);
+  bool end();
+
+  bool setClock(uint32_t frequency);
+  uint32_t getClock() const { return _clock; }
+  void setTimeOut(uint16_t ms) { setTimeout(ms); }
+  uint16_t getTimeOut() const { return (uint16_t)getTimeout(); }
+
+  void beginTransmission(uint8_t address);
+  void beginTransmission(int address) { beginTransmission((uint8_t)address); }
+  uint8_t endTransmission(bool sendStop = true);
+  uint8_t endTransmission(uint8_t sendStop) { return endTransmission(sendStop != 0); }
+
+  size_t requestFrom(uint8_t address, size_t size, bool sendStop = true);
+  uint8_t requestFrom(uint8_t address, uint8_t size, uint8_t sendStop) { return (uint8_t)requestFrom(address, (size_t)size, sendStop != 0); }
+  uint8_t requestFrom(uint8_t address, uint8_t size) { return (uint8_t)requestFrom(address, (size_t)size, true); }
+  uint8_t requestFrom(int address, int size) { return (uint8_t)requestFrom((uint8_t)address, (size_t)size, true); }
+  uint8_t requestFrom(int address, int size, int sendStop) { return (uint8_t)requestFrom((uint8_t)address, (size_t)size, sendStop != 0); }
+
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* data, size_t len) override;
+  using Print::write;
+
+  int available() override;
+  int read() override;
+  int peek() override;
+  void flush() override {}
+
+ private:
+  uint8_t  _bus;
+  bool     _begun = false;
+  uint32_t _clock = 100000;
+
+  uint8_t  _txAddr = 0;
+  uint8_t  _txBuf[I2C_BUFFER_LENGTH];
+  size_t   _txLen = 0;
+  bool     _inTx = false;
+
+  uint8_t  _rxBuf[I2C_BUFFER_LENGTH];
+  size_t   _rxLen = 0;
+  size_t   _rxIdx = 0;
+};
+
+extern TwoWire Wire;
+extern TwoWire Wire1;
@@ -0,0 +1,89 @@
+// Simulated hardware behind the host Arduino shim.
+//
+// Everything the firmware reads from the outside world goes through here:
+// the clock, GPIO levels, ADC counts, I2C devices and the DHT22. Defaults
+// model a quiet indoor room; tests and benchmarks plug in their own sources.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <functional>
+
+namespace sim {
+
+// ---- clock ----
+// Real: millis()/micros() follow the host monotonic clock and delay() sleeps.
+// Virtual: time only moves through delay()/advance(), so long runs replay
+// faster than real time and are deterministic.
+enum class ClockMode { Real, Virtual };
+void setClockMode(ClockMode m);
+ClockMode clockMode();
+void advanceMicros(uint64_t us);
+uint64_t nowMicros();
+
+// ---- room model ----
+struct Environment {
+  float temperatureC = 23.0f;
+  float humidityPct  = 45.0f;
+  float pressureHpa  = 1013.25f;
+  float lux          = 320.0f;
+  float uvIndex      = 0.5f;
+  float mq135Volts   = 0.55f;  // voltage across the MQ135 load resistor
+  float batteryVolts = 3.95f;  // cell voltage before the board divider
+  bool  charging     = false;
+};
+
+// Called before every sensor access so a scenario can evolve the room
+using EnvironmentModel = std::function<void(uint64_t nowUs, Environment& env)>;
+void setEnvironmentModel(EnvironmentModel model);
+Environment& environment();
+
+// ---- GPIO / ADC ----
+using AnalogSource = std::function<uint16_t(uint64_t nowUs)>;
+void setAnalogSource(uint8_t pin, AnalogSource src);  // 12-bit counts
+void setDigitalLevel(uint8_t pin, int level);          // drives an input pin
+int  digitalLevel(uint8_t pin);
+void fireInterrupt(uint8_t pin);
+
+// ---- I2C ----
+class I2CDevice {
+ public:
+  virtual ~I2CDevice() = default;
+  // Data written by the controller; false = NACK
+  virtual bool onWrite(const uint8_t* data, size_t len) = 0;
+  // Fill up to len bytes for a read; returns the number of bytes supplied
+  virtual size_t onRead(uint8_t* data, size_t len) = 0;
+};
+
+void attachI2C(uint8_t addr, I2CDevice* dev);
+void detachI2C(uint8_t addr);
+I2CDevice* i2cDevice(uint8_t addr);
+uint32_t i2cTransactions();
+void setI2CStuck(bool stuck);  // hold SDA low until the bus is clocked free
+void setI2CPins(int sda, int scl);  // called by TwoWire::begin()
+
+// ---- replay ----
+// Exact raw values from a recorded trace; they take precedence over the room
+// model until cleared. The BMP180 has no override: its registers are solved
+// from environment() pressure/temperature.
+void setBh1750Raw(int32_t raw);          // -1: back to the room model
+void setDhtFrame(const uint8_t* frame);  // 5 bytes; nullptr: back to the room model
+int32_t bh1750Raw();
+const uint8_t* dhtFrame();
+
+// ---- network ----
+void setWifiUp(bool up);
+bool wifiUp();
+
+// Installs the default board: BH1750 (0x5C), BMP180 (0x77), DS3231 (0x68)
+// and analog sources driven by environment() on the given pins.
+struct BoardPins {
+  uint8_t mq135;
+  uint8_t uv;
+  uint8_t battery;
+  uint8_t charger;
+};
+void installDefaultBoard(const BoardPins& pins);
+
+}  // namespace sim
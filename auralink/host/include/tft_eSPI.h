@@ -0,0 +1,2 @@
+#pragma once
+#include "TFT_eSPI.h"
@@ -0,0 +1,120 @@
+#include <Arduino.h>
+#include <malloc.h>
+#include <sim.h>
+
+#include <chrono>
+#include <random>
+#include <thread>
+
+EspClass ESP;
+
+namespace sim {
+
+static ClockMode gClockMode = ClockMode::Real;
+static uint64_t gVirtualUs = 0;
+static const auto gStart = std::chrono::steady_clock::now();
+
+void setClockMode(ClockMode m) {
+  if (m == ClockMode::Virtual && gClockMode == ClockMode::Real) gVirtualUs = nowMicros();
+  gClockMode = m;
+}
+
+ClockMode clockMode() { return gClockMode; }
+
+void advanceMicros(uint64_t us) {
+  if (gClockMode == ClockMode::Virtual) {
+    gVirtualUs += us;
+  } else {
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+  }
+}
+
+uint64_t nowMicros() {
+  if (gClockMode == ClockMode::Virtual) return gVirtualUs;
+  return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - gStart)
+      .count();
+}
+
+}  // namespace sim
+
+extern "C" {
+
+unsigned long millis(void) { return (unsigned long)(uint32_t)(sim::nowMicros() / 1000); }
+unsigned long micros(void) { return (unsigned long)(uint32_t)sim::nowMicros(); }
+void delay(uint32_t ms) { sim::advanceMicros((uint64_t)ms * 1000); }
+void delayMicroseconds(uint32_t us) { sim::advanceMicros(us); }
+void yield(void) {}
+
+void noInterrupts(void) {}
+void interrupts(void) {}
+
+void* heap_caps_malloc(size_t size, uint32_t caps) {
+  (void)caps;
+  return malloc(size);
+}
+
+void* heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+  (void)caps;
+  return calloc(n, size);
+}
+
+void* heap_caps_realloc(void* ptr, size_t size, uint32_t caps) {
+  (void)caps;
+  return realloc(ptr, size);
+}
+
+void heap_caps_free(void* ptr) { free(ptr); }
+
+size_t heap_caps_get_free_size(uint32_t caps) {
+  // Report the ESP32-S3 budgets so diagnostics print plausible numbers
+  return (caps & MALLOC_CAP_SPIRAM) ? 8u * 1024u * 1024u : 320u * 1024u;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps) { return heap_caps_get_free_size(caps); }
+
+#if !defined(__GLIBC__) || __GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38)
+size_t strlcpy(char* dst, const char* src, size_t size) {
+  size_t len = strlen(src);
+  if (size) {
+    size_t n = len < size - 1 ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return len;
+}
+#endif
+
+static long gGmtOffset = 0;
+
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char* server1) {
+  (void)server1;
+  gGmtOffset = gmtOffset_sec + daylightOffset_sec;
+}
+
+bool getLocalTime(struct tm* info, uint32_t ms) {
+  (void)ms;
+  time_t now = time(nullptr) + gGmtOffset;
+  gmtime_r(&now, info);
+  return true;
+}
+
+}  // extern "C"
+
+static std::mt19937 gRng(1);
+
+long random(long max) { return max > 0 ? (long)(gRng() % (unsigned long)max) : 0; }
+long random(long min, long max) { return max > min ? min + random(max - min) : min; }
+void randomSeed(unsigned long seed) { gRng.seed((uint32_t)seed); }
+
+uint64_t EspClass::getEfuseMac() { return 0x0000A1B2C3D4E5F6ULL; }
+uint32_t EspClass::getFreeHeap() { return (uint32_t)heap_caps_get_free_size(MALLOC_CAP_INTERNAL); }
+uint32_t EspClass::getHeapSize() { return 320u * 1024u; }
+uint32_t EspClass::getMinFreeHeap() { return getFreeHeap(); }
+uint32_t EspClass::getPsramSize() { return 8u * 1024u * 1024u; }
+uint32_t EspClass::getFreePsram() { return (uint32_t)heap_caps_get_free_size(MALLOC_CAP_SPIRAM); }
+uint32_t EspClass::getCycleCount() {
+  return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                        sim::gStart)
+      .count();
+}
+void EspClass::restart() { exit(0); }
@@ -0,0 +1,431 @@
+// Software blend kernels (lv_draw_sw_blend.c): runs the normal-mode fill with
+// opacity, once through the one pixel loop and once with
+// LV_DRAW_SW_BLEND_SWAR's two pixels per word loop, on the same random inputs
+// (odd widths and offsets, every opacity, flat and noisy backgrounds).
+//
+//   auralink_blendbench [--check] [--rounds N]
+//
+// With no action it prints the host throughput of every case both ways.
+// --check compares the destination buffers instead and exits 1 on the first
+// pixel that differs. It also draws random rounded rectangles with borders,
+// clipped and unclipped, with and without the corner mask cache
+// (LV_RECT_MASK_CACHE_SIZE), random text with and without the glyph raster
+// cache (LV_GLYPH_CACHE_SIZE), and the SquareLine icons zoomed, rotated and
+// recoloured with and without the transform cache
+// (LV_IMG_TRANSFORM_CACHE_SIZE), and compares those the same way.
+#include <Arduino.h>
+#include <draw/sw/lv_draw_sw.h>
+#include <sim.h>
+#include <ui.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "User_Setup.h"
+#include "display.h"
+
+namespace {
+
+constexpr lv_coord_t kBufW = 160;  // one full-width draw buffer
+constexpr lv_coord_t kBufH = 40;
+
+enum class Dest { Flat, Noise };
+
+struct Case {
+  const char* name;
+  Dest dest;
+};
+
+const Case kCases[] = {
+    {"fill opa/flat", Dest::Flat},
+    {"fill opa/noise", Dest::Noise},
+};
+
+std::mt19937 gRng(0x5eed);
+
+lv_color_t randomColor() {
+  lv_color_t c;
+  c.full = (uint16_t)gRng();
+  return c;
+}
+
+// Mostly a few flat colours, like the screens' backgrounds and panels
+void fillDest(std::vector<lv_color_t>& buf, Dest dest) {
+  if (dest == Dest::Noise) {
+    for (lv_color_t& c : buf) c = randomColor();
+    return;
+  }
+  lv_color_t c = lv_color_black();
+  for (size_t i = 0; i < buf.size(); ++i) {
+    if (gRng() % 97 == 0) c = gRng() % 2 ? lv_color_black() : randomColor();
+    buf[i] = c;
+  }
+}
+
+struct Input {
+  lv_area_t area;  // in buffer coordinates
+  lv_color_t color;
+  lv_opa_t opa;
+};
+
+Input randomInput() {
+  Input in;
+  lv_coord_t w = 1 + gRng() % kBufW;
+  lv_coord_t h = 1 + gRng() % kBufH;
+  in.area.x1 = gRng() % (kBufW - w + 1);
+  in.area.y1 = gRng() % (kBufH - h + 1);
+  in.area.x2 = in.area.x1 + w - 1;
+  in.area.y2 = in.area.y1 + h - 1;
+  in.color = randomColor();
+  in.opa = (lv_opa_t)(gRng() % LV_OPA_MAX);
+  return in;
+}
+
+void blend(lv_draw_ctx_t* ctx, std::vector<lv_color_t>& buf, const Input& in) {
+  ctx->buf = buf.data();
+  lv_draw_sw_blend_dsc_t dsc;
+  lv_memset_00(&dsc, sizeof(dsc));
+  dsc.blend_area = &in.area;
+  dsc.color = in.color;
+  dsc.opa = in.opa;
+  dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+  lv_draw_sw_blend_basic(ctx, &dsc);
+}
+
+// Blends `rounds` random inputs both ways; false on the first difference
+bool check(lv_draw_ctx_t* ctx, const Case& c, int rounds) {
+  std::vector<lv_color_t> ref(kBufW * kBufH), out(kBufW * kBufH);
+  for (int r = 0; r < rounds; ++r) {
+    Input in = randomInput();
+    fillDest(ref, c.dest);
+    out = ref;
+    lv_draw_sw_blend_enable_swar(false);
+    blend(ctx, ref, in);
+    lv_draw_sw_blend_enable_swar(true);
+    blend(ctx, out, in);
+    for (size_t i = 0; i < ref.size(); ++i) {
+      if (ref[i].full != out[i].full) {
+        fprintf(stderr, "[BLENDBENCH] %s: pixel (%d,%d) is %04x, not %04x (area %d,%d %dx%d, opa %u)\n", c.name,
+                (int)(i % kBufW), (int)(i / kBufW), out[i].full, ref[i].full, (int)in.area.x1, (int)in.area.y1,
+                (int)lv_area_get_width(&in.area), (int)lv_area_get_height(&in.area), (unsigned)in.opa);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Draws random rounded rectangles with the corner mask cache and without;
+// false on the first difference
+bool checkRects(lv_draw_ctx_t* ctx, int rounds) {
+  std::vector<lv_color_t> ref(kBufW * kBufH), out(kBufW * kBufH);
+  const lv_area_t* bufArea = ctx->buf_area;
+  for (int r = 0; r < rounds; ++r) {
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_color = randomColor();
+    dsc.bg_opa = gRng() % 2 ? (lv_opa_t)LV_OPA_COVER : (lv_opa_t)gRng();
+    dsc.border_color = randomColor();
+    dsc.border_opa = gRng() % 2 ? (lv_opa_t)LV_OPA_COVER : (lv_opa_t)gRng();
+    // A few shapes over and over, so most draws hit the cache
+    const lv_coord_t radii[] = {1, 4, 9, LV_RADIUS_CIRCLE};
+    dsc.radius = radii[gRng() % 4];
+    dsc.border_width = gRng() % 4;
+    dsc.border_side = gRng() % 2 ? (lv_border_side_t)LV_BORDER_SIDE_FULL : (lv_border_side_t)(gRng() % 16);
+    lv_coord_t w = gRng() % 2 ? 64 : 21;
+    lv_coord_t h = gRng() % 2 ? 36 : 8;
+    lv_area_t coords;
+    coords.x1 = (lv_coord_t)(gRng() % (kBufW + w)) - w / 2;
+    coords.y1 = (lv_coord_t)(gRng() % (kBufH + h)) - h / 2;
+    coords.x2 = coords.x1 + w - 1;
+    coords.y2 = coords.y1 + h - 1;
+    lv_area_t clip = *bufArea;
+    if (gRng() % 2) {
+      clip.x1 = gRng() % kBufW;
+      clip.y1 = gRng() % kBufH;
+      clip.x2 = clip.x1 + gRng() % (kBufW - clip.x1);
+      clip.y2 = clip.y1 + gRng() % (kBufH - clip.y1);
+    }
+    ctx->clip_area = &clip;
+
+    fillDest(ref, Dest::Flat);
+    out = ref;
+    lv_draw_sw_rect_enable_mask_cache(false);
+    ctx->buf = ref.data();
+    lv_draw_rect(ctx, &dsc, &coords);
+    lv_draw_sw_rect_enable_mask_cache(true);
+    ctx->buf = out.data();
+    lv_draw_rect(ctx, &dsc, &coords);
+    ctx->clip_area = bufArea;
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+      if (ref[i].full != out[i].full) {
+        fprintf(stderr, "[BLENDBENCH] rect: pixel (%d,%d) is %04x, not %04x (%dx%d at %d,%d, radius %d, border %d)\n",
+                (int)(i % kBufW), (int)(i / kBufW), out[i].full, ref[i].full, (int)w, (int)h, (int)coords.x1,
+                (int)coords.y1, (int)dsc.radius, (int)dsc.border_width);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Draws random text, some of it clipped or under a rounded mask, with the
+// glyph raster cache and without; false on the first difference
+bool checkText(lv_draw_ctx_t* ctx, int rounds) {
+  static const lv_font_t* const kFonts[] = {
+#if LV_FONT_MONTSERRAT_8
+      &lv_font_montserrat_8,
+#endif
+#if LV_FONT_MONTSERRAT_10
+      &lv_font_montserrat_10,
+#endif
+#if LV_FONT_MONTSERRAT_12
+      &lv_font_montserrat_12,
+#endif
+#if LV_FONT_MONTSERRAT_14
+      &lv_font_montserrat_14,
+#endif
+  };
+  static const char* const kTexts[] = {"Hello, AuraLink!", "23.5\xc2\xb0" "C 41%", "UV 3 AQI 112",
+                                       "The quick brown fox jumps over the lazy dog"};
+  std::vector<lv_color_t> ref(kBufW * kBufH), out(kBufW * kBufH);
+  const lv_area_t* bufArea = ctx->buf_area;
+  for (int r = 0; r < rounds; ++r) {
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    dsc.font = kFonts[gRng() % (sizeof(kFonts) / sizeof(kFonts[0]))];
+    dsc.color = randomColor();
+    dsc.opa = gRng() % 2 ? (lv_opa_t)LV_OPA_COVER : (lv_opa_t)gRng();
+    const char* text = kTexts[gRng() % 4];
+    lv_area_t coords;
+    coords.x1 = (lv_coord_t)(gRng() % kBufW) - 20;
+    coords.y1 = (lv_coord_t)(gRng() % kBufH) - 8;
+    coords.x2 = coords.x1 + 100 + gRng() % 60;
+    coords.y2 = coords.y1 + 40;
+    lv_area_t clip = *bufArea;
+    if (gRng() % 2) {
+      clip.x1 = gRng() % kBufW;
+      clip.y1 = gRng() % kBufH;
+      clip.x2 = clip.x1 + gRng() % (kBufW - clip.x1);
+      clip.y2 = clip.y1 + gRng() % (kBufH - clip.y1);
+    }
+    ctx->clip_area = &clip;
+    lv_draw_mask_radius_param_t radius;
+    int16_t maskId = LV_MASK_ID_INV;
+    if (gRng() % 4 == 0) {
+      lv_area_t round = {(lv_coord_t)(gRng() % 40), (lv_coord_t)(gRng() % 10), (lv_coord_t)(80 + gRng() % 80),
+                         (lv_coord_t)(20 + gRng() % 20)};
+      lv_draw_mask_radius_init(&radius, &round, 12, false);
+      maskId = lv_draw_mask_add(&radius, nullptr);
+    }
+
+    fillDest(ref, Dest::Flat);
+    out = ref;
+    lv_draw_sw_letter_enable_cache(false);
+    ctx->buf = ref.data();
+    lv_draw_label(ctx, &dsc, &coords, text, nullptr);
+    lv_draw_sw_letter_enable_cache(true);
+    ctx->buf = out.data();
+    lv_draw_label(ctx, &dsc, &coords, text, nullptr);
+    lv_draw_label(ctx, &dsc, &coords, text, nullptr);  // once more from a warm cache, over itself
+    ctx->buf = ref.data();
+    lv_draw_sw_letter_enable_cache(false);
+    lv_draw_label(ctx, &dsc, &coords, text, nullptr);
+    lv_draw_sw_letter_enable_cache(true);
+    ctx->clip_area = bufArea;
+    if (maskId != LV_MASK_ID_INV) {
+      lv_draw_mask_remove_id(maskId);
+      lv_draw_mask_free_param(&radius);
+    }
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+      if (ref[i].full != out[i].full) {
+        fprintf(stderr, "[BLENDBENCH] text: pixel (%d,%d) is %04x, not %04x (\"%s\" at %d,%d, opa %u)\n",
+                (int)(i % kBufW), (int)(i / kBufW), out[i].full, ref[i].full, text, (int)coords.x1, (int)coords.y1,
+                (unsigned)dsc.opa);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Draws the SquareLine icons at random zoom, angle, pivot, recolour and
+// opacity, some clipped or under a rounded mask, three times over themselves
+// with the transform cache and without: the second draw renders the cached
+// image, the third is blended from it unless it's clipped to other columns;
+// false on the first difference
+bool checkImages(lv_draw_ctx_t* ctx, int rounds) {
+  static const lv_img_dsc_t* const kIcons[] = {&ui_img_aq_png,       &ui_img_temperature_png, &ui_img_pressure_png,
+                                               &ui_img_rh_png,       &ui_img_light_png,       &ui_img_uv_png};
+  std::vector<lv_color_t> ref(kBufW * kBufH), out(kBufW * kBufH);
+  const lv_area_t* bufArea = ctx->buf_area;
+  for (int r = 0; r < rounds; ++r) {
+    const lv_img_dsc_t* icon = kIcons[gRng() % (sizeof(kIcons) / sizeof(kIcons[0]))];
+    lv_draw_img_dsc_t dsc;
+    lv_draw_img_dsc_init(&dsc);
+    dsc.zoom = (uint16_t)(64 + gRng() % 320);
+    dsc.angle = gRng() % 2 ? 0 : (int16_t)(gRng() % 3600);
+    dsc.pivot.x = gRng() % 2 ? icon->header.w / 2 : (lv_coord_t)(gRng() % icon->header.w);
+    dsc.pivot.y = gRng() % 2 ? icon->header.h / 2 : (lv_coord_t)(gRng() % icon->header.h);
+    if (gRng() % 2) {
+      dsc.recolor = randomColor();
+      dsc.recolor_opa = (lv_opa_t)gRng();
+    }
+    dsc.opa = gRng() % 2 ? (lv_opa_t)LV_OPA_COVER : (lv_opa_t)gRng();
+    dsc.antialias = gRng() % 4 != 0;
+    lv_area_t coords;
+    coords.x1 = (lv_coord_t)(gRng() % kBufW) - icon->header.w / 2;
+    coords.y1 = (lv_coord_t)(gRng() % kBufH) - icon->header.h / 2;
+    coords.x2 = coords.x1 + icon->header.w - 1;
+    coords.y2 = coords.y1 + icon->header.h - 1;
+    lv_area_t clip = *bufArea;
+    if (gRng() % 2) {
+      clip.x1 = gRng() % kBufW;
+      clip.y1 = gRng() % kBufH;
+      clip.x2 = clip.x1 + gRng() % (kBufW - clip.x1);
+      clip.y2 = clip.y1 + gRng() % (kBufH - clip.y1);
+    }
+    lv_area_t clips[3] = {clip, clip, clip};
+    if (gRng() % 2) {
+      // The last draw within the first two, fewer rows or fewer columns
+      lv_area_t& last = clips[2];
+      if (gRng() % 2) {
+        last.y1 += gRng() % (lv_area_get_height(&clip) / 2 + 1);
+      } else {
+        last.x1 += gRng() % (lv_area_get_width(&clip) / 2 + 1);
+      }
+    }
+    lv_draw_mask_radius_param_t radius;
+    int16_t maskId = LV_MASK_ID_INV;
+    if (gRng() % 4 == 0) {
+      lv_area_t round = {(lv_coord_t)(gRng() % 40), (lv_coord_t)(gRng() % 10), (lv_coord_t)(80 + gRng() % 80),
+                         (lv_coord_t)(20 + gRng() % 20)};
+      lv_draw_mask_radius_init(&radius, &round, 12, false);
+      maskId = lv_draw_mask_add(&radius, nullptr);
+    }
+
+    fillDest(ref, Dest::Noise);
+    out = ref;
+    lv_draw_img_enable_transform_cache(false);
+    ctx->buf = ref.data();
+    for (const lv_area_t& c : clips) {
+      ctx->clip_area = &c;
+      lv_draw_img(ctx, &dsc, &coords, icon);
+    }
+    lv_draw_img_enable_transform_cache(true);
+    ctx->buf = out.data();
+    for (const lv_area_t& c : clips) {
+      ctx->clip_area = &c;
+      lv_draw_img(ctx, &dsc, &coords, icon);
+    }
+    ctx->clip_area = bufArea;
+    if (maskId != LV_MASK_ID_INV) {
+      lv_draw_mask_remove_id(maskId);
+      lv_draw_mask_free_param(&radius);
+    }
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+      if (ref[i].full != out[i].full) {
+        fprintf(stderr,
+                "[BLENDBENCH] images: pixel (%d,%d) is %04x, not %04x (%dx%d icon at %d,%d, zoom %u, angle %d, "
+                "recolor opa %u, opa %u)\n",
+                (int)(i % kBufW), (int)(i / kBufW), out[i].full, ref[i].full, (int)icon->header.w,
+                (int)icon->header.h, (int)coords.x1, (int)coords.y1, (unsigned)dsc.zoom, (int)dsc.angle,
+                (unsigned)dsc.recolor_opa, (unsigned)dsc.opa);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Host throughput of full-buffer blends, in megapixels per second. Each blend
+// counts with its fastest time out of a few passes over the same inputs.
+double throughput(lv_draw_ctx_t* ctx, const Case& c, int rounds, bool swar) {
+  std::vector<lv_color_t> buf(kBufW * kBufH);
+  std::vector<uint32_t> best(rounds, UINT32_MAX);
+  std::mt19937 rng = gRng;  // the same inputs both ways
+  lv_draw_sw_blend_enable_swar(swar);
+  for (int pass = 0; pass < 7; ++pass) {
+    gRng = rng;
+    for (int r = 0; r < rounds; ++r) {
+      Input in = randomInput();
+      in.area = {0, 0, kBufW - 1, kBufH - 1};
+      fillDest(buf, c.dest);
+      uint32_t t0 = ESP.getCycleCount();
+      blend(ctx, buf, in);
+      best[r] = std::min(best[r], ESP.getCycleCount() - t0);
+    }
+  }
+  gRng = rng;
+  lv_draw_sw_blend_enable_swar(true);
+  uint64_t cyc = 0;
+  for (uint32_t b : best) cyc += b;
+  return cyc ? (double)buf.size() * rounds * ESP.getCpuFreqMHz() / cyc : 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  bool checkOnly = false;
+  int rounds = 0;
+  bool usage = false;
+  for (int i = 1; i < argc && !usage; ++i) {
+    if (!strcmp(argv[i], "--check")) {
+      checkOnly = true;
+    } else if (!strcmp(argv[i], "--rounds") && i + 1 < argc) {
+      rounds = atoi(argv[++i]);
+      usage = rounds <= 0;
+    } else {
+      usage = true;
+    }
+  }
+  if (usage) {
+    fprintf(stderr, "usage: %s [--check] [--rounds N]\n", argv[0]);
+    return 2;
+  }
+  if (!rounds) rounds = checkOnly ? 2000 : 500;
+
+  sim::setClockMode(sim::ClockMode::Virtual);
+  static Display display;
+  if (!display.begin(SCREEN_W, SCREEN_H, /*rotation*/ 2)) return 1;
+
+  // Blend straight into a buffer of our own, as if it were the display's
+  lv_area_t bufArea = {0, 0, kBufW - 1, kBufH - 1};
+  lv_draw_ctx_t ctx;
+  lv_memset_00(&ctx, sizeof(ctx));
+  ctx.buf_area = &bufArea;
+  ctx.clip_area = &bufArea;
+  _lv_refr_set_disp_refreshing(display.lvDisplay());
+
+  // The same buffer as a software draw context, for whole rectangles
+  static lv_draw_sw_ctx_t sw;
+  lv_draw_sw_init_ctx(display.lvDisplay()->driver, &sw.base_draw);
+  sw.base_draw.buf_area = &bufArea;
+  sw.base_draw.clip_area = &bufArea;
+
+  if (checkOnly) {
+    for (const Case& c : kCases) {
+      if (!check(&ctx, c, rounds)) return 1;
+      printf("[BLENDBENCH] %-20s %d blends identical\n", c.name, rounds);
+    }
+    if (!checkRects(&sw.base_draw, rounds)) return 1;
+    printf("[BLENDBENCH] %-20s %d draws identical\n", "rect mask cache", rounds);
+    if (!checkText(&sw.base_draw, rounds)) return 1;
+    printf("[BLENDBENCH] %-20s %d labels identical\n", "glyph cache", rounds);
+    if (!checkImages(&sw.base_draw, rounds)) return 1;
+    printf("[BLENDBENCH] %-20s %d images identical\n", "transform cache", rounds);
+    return 0;
+  }
+
+  printf("[BLENDBENCH] %-20s %10s %10s %7s   Mpx/s on the host\n", "case", "1 px", "2 px", "gain");
+  for (const Case& c : kCases) {
+    double ref = throughput(&ctx, c, rounds, false);
+    double swar = throughput(&ctx, c, rounds, true);
+    printf("[BLENDBENCH] %-20s %10.1f %10.1f %6.2fx\n", c.name, ref, swar, ref > 0 ? swar / ref : 0);
+  }
+  return 0;
+}
@@ -0,0 +1,326 @@
+// Pixel-exact render check: draws a fixed scene on each real screen, plus a
+// frame halfway through a fade, one halfway through a slide and the second
+// page of a long quote, and compares a hash of the headless panel's
+// framebuffer, in the bytes the ST7735 receives, against known-good values.
+// Any change to the draw pipeline, the colour format or the assets that
+// alters a single pixel fails it. It also checks that the built-in fonts'
+// glyph tables (LV_FONT_FMT_TXT_LUT) give every letter pair the same glyph,
+// advance and bitmap as searching the font does, that the event code masks
+// (LV_OBJ_EVENT_MASK) run the same callbacks as scanning them, and that the
+// numeric readouts, redrawing only their changed characters, leave the panel
+// as a full redraw would.
+//
+//   auralink_golden [--print] [--dump PREFIX]
+//
+// --print lists the hashes for pasting into kGolden after an intended visual
+// change; --dump writes each frame as raw panel bytes to PREFIX<name>.bin.
+#include <Arduino.h>
+#include <sim.h>
+#include <ui.h>
+
+#include <random>
+#include <vector>
+
+#include "User_Setup.h"
+#include "battery.h"
+#include "danger.h"
+#include "display.h"
+#include "display_manager.h"
+#include "mqtt.h"
+#include "num_label.h"
+#include "text_pager.h"
+#include "update_ui.h"
+#include "wifi_connector.h"
+
+namespace {
+
+struct Golden {
+  const char* name;
+  uint64_t hash;
+};
+
+// Numeric readouts drawn by num_label (tabular digits), in panel byte order
+const Golden kGolden[] = {
+    {"sensors", 0xb9967d12578fd448ull},
+    {"quote", 0x403418cda95d7df9ull},
+    {"email", 0x4f0c917a1c24f780ull},
+    {"fade", 0x1533557176baf370ull},
+    {"slide", 0x991a161196f538ffull},
+    {"pages", 0x191acad06567a6baull},
+};
+constexpr int kFrames = sizeof(kGolden) / sizeof(kGolden[0]);
+
+const char kLongQuote[] =
+    "Quote:\nThe best way to predict the future is to invent it. Most of what we call management "
+    "consists of making it difficult for people to get their work done. Simplicity is prerequisite "
+    "for reliability. The cheapest, fastest and most reliable components are those that aren't "
+    "there. Premature optimization is the root of all evil, yet we should not pass up our "
+    "opportunities in that critical 3%. Measuring programming progress by lines of code is like "
+    "measuring aircraft building progress by weight. - Kay, DeMarco, Dijkstra, Bell, Knuth, Gates";
+
+uint64_t fnv1a(const uint8_t* p, size_t n) {
+  uint64_t h = 0xcbf29ce484222325ull;
+  for (size_t i = 0; i < n; ++i) h = (h ^ p[i]) * 0x100000001b3ull;
+  return h;
+}
+
+void settle(uint32_t ms) {
+  for (uint32_t t = 0; t < ms; t += LV_DISP_DEF_REFR_PERIOD) {
+    lv_timer_handler();
+    delay(LV_DISP_DEF_REFR_PERIOD);
+  }
+}
+
+// Every pair of code points below 0x180, plus a few symbols, with the glyph
+// tables and without; false on the first difference
+bool checkFontTables() {
+  static const lv_font_t* const kFonts[] = {
+#if LV_FONT_MONTSERRAT_8
+      &lv_font_montserrat_8,
+#endif
+#if LV_FONT_MONTSERRAT_10
+      &lv_font_montserrat_10,
+#endif
+#if LV_FONT_MONTSERRAT_12
+      &lv_font_montserrat_12,
+#endif
+#if LV_FONT_MONTSERRAT_14
+      &lv_font_montserrat_14,
+#endif
+  };
+  std::vector<uint32_t> letters;
+  for (uint32_t c = 0; c < 0x180; ++c) letters.push_back(c);
+  for (uint32_t c : {0xF001u, 0xF00Cu, 0xF1EBu, 0xF240u, 0xF8A2u}) letters.push_back(c);
+
+  for (const lv_font_t* font : kFonts) {
+    for (uint32_t a : letters) {
+      for (uint32_t b : letters) {
+        lv_font_glyph_dsc_t ref, out;
+        lv_memset_00(&ref, sizeof(ref));
+        lv_memset_00(&out, sizeof(out));
+        lv_font_fmt_txt_enable_lut(false);
+        bool refFound = lv_font_get_glyph_dsc(font, &ref, a, b);
+        const uint8_t* refBitmap = lv_font_get_glyph_bitmap(font, a);
+        lv_font_fmt_txt_enable_lut(true);
+        bool outFound = lv_font_get_glyph_dsc(font, &out, a, b);
+        const uint8_t* outBitmap = lv_font_get_glyph_bitmap(font, a);
+        if (refFound != outFound || memcmp(&ref, &out, sizeof(ref)) != 0 || refBitmap != outBitmap) {
+          printf("[GOLDEN] fonts    FAIL U+%04X before U+%04X in the %d px font\n", (unsigned)a, (unsigned)b,
+                 (int)font->line_height);
+          return false;
+        }
+      }
+    }
+  }
+  printf("[GOLDEN] fonts    ok\n");
+  return true;
+}
+
+std::vector<uintptr_t> gEventLog;  // user data of the event callbacks run, in order
+
+void logEvent(lv_event_t* e) { gEventLog.push_back((uintptr_t)lv_event_get_user_data(e)); }
+
+// The callbacks run by every code past the built-in ones, on an object whose
+// callbacks are added and removed step by step, with the code masks and
+// without; false on the first difference. Codes 64 apart share a mask bit.
+bool checkEventMask() {
+  constexpr uint32_t first = _LV_EVENT_LAST;
+  static_assert(first + 65 < LV_EVENT_PREPROCESS, "codes past the built-in ones fit in a filter");
+  const uint32_t filters[] = {first + 1, first + 65, first + 3, LV_EVENT_ALL, (first + 2) | LV_EVENT_PREPROCESS,
+                              first + 3};
+  lv_obj_t* obj = lv_obj_create(lv_scr_act());
+  bool ok = true;
+  auto sendAll = [&](bool mask) {
+    lv_obj_enable_event_mask(mask);
+    std::vector<uintptr_t> log;
+    for (uint32_t code = first; code < LV_EVENT_PREPROCESS; ++code) {
+      gEventLog.clear();
+      lv_event_send(obj, (lv_event_code_t)code, nullptr);
+      log.push_back(code << 16);
+      log.insert(log.end(), gEventLog.begin(), gEventLog.end());
+    }
+    lv_obj_enable_event_mask(true);
+    return log;
+  };
+  auto compare = [&](const char* step) {
+    if (ok && sendAll(true) != sendAll(false)) {
+      printf("[GOLDEN] events   FAIL after %s\n", step);
+      ok = false;
+    }
+  };
+  for (uint32_t i = 0; i < sizeof(filters) / sizeof(filters[0]); ++i) {
+    lv_obj_add_event_cb(obj, logEvent, (lv_event_code_t)filters[i], (void*)(uintptr_t)(i + 1));
+    compare("adding a callback");
+  }
+  lv_obj_remove_event_cb_with_user_data(obj, logEvent, (void*)(uintptr_t)4);  // LV_EVENT_ALL
+  compare("removing the callback for all codes");
+  lv_obj_remove_event_cb_with_user_data(obj, logEvent, (void*)(uintptr_t)5);  // the preprocessing one
+  compare("removing the preprocessing callback");
+  lv_obj_remove_event_cb(obj, logEvent);
+  compare("removing the first callback");
+  lv_obj_del(obj);
+  if (ok) printf("[GOLDEN] events   ok\n");
+  return ok;
+}
+
+// Random readout updates on the sensor screen, a few characters or the whole
+// value at a time, each drawn the way the firmware draws it and then redrawn
+// in full; false on the first update where the two frames differ. The zoomed
+// icons are hidden: a transformed image steps through its source by the
+// width drawn, so LVGL itself draws it a little differently when only some
+// of its columns are redrawn.
+bool checkLabelDiff(Display& display) {
+  struct Readout {
+    lv_obj_t* label;
+    lv_obj_t* tile;
+    lv_obj_t* icon;
+    uint8_t decimals;
+    float lo, hi;
+    ColorOpacity (*color)(float);
+  };
+  const Readout readouts[] = {
+      {ui_AirQuality, ui_AirQualityContainer, ui_AirQualityImage, 0, 0, 500, getDangerColorAirQuality},
+      {ui_Temperature, ui_TemperatureContainer, ui_TemperatureImage, 1, -20, 50, getDangerColorTemperature},
+      {ui_RelativeHumidity, ui_RelativeHumidityContainer, ui_RelativeHumidityImage, 1, 0, 100,
+       getDangerColorHumidity},
+      {ui_Pressure, ui_PressureContainer, ui_PressureImage, 2, 950, 1050, getDangerColorPressure},
+      {ui_Illumination, ui_IlluminationContainer, ui_IlluminationImage, 2, 0, 20000, getDangerColorIllumination},
+      {ui_UVV, ui_UVContainer, ui_UVImage, 2, 0, 12, getDangerColorUVIndex},
+  };
+  for (const Readout& r : readouts) lv_obj_add_flag(r.icon, LV_OBJ_FLAG_HIDDEN);
+  // Sized by its text (no widest value), so a change of width lays it out again
+  lv_obj_t* free = numLabelCreate(ui_SensorData, lv_obj_get_style_text_font(ui_Temperature, LV_PART_MAIN), nullptr);
+  lv_obj_set_style_text_color(free, lv_color_white(), LV_PART_MAIN);
+  lv_obj_align(free, LV_ALIGN_BOTTOM_RIGHT, -2, -2);
+
+  const TFT_eSPI& tft = display.tft();
+  const size_t bytes = (size_t)tft.width() * tft.height() * sizeof(uint16_t);
+  std::vector<uint8_t> drawn(bytes);
+  std::mt19937 rng(7);
+  float values[6] = {};
+  bool ok = true;
+  for (int u = 0; u < 400 && ok; ++u) {
+    for (size_t i = 0; i < 6; ++i) {
+      const Readout& r = readouts[i];
+      if (rng() % 3) continue;
+      // Mostly a step of the last digit, sometimes anywhere in the range or not a number
+      float step = 1.0f;
+      for (uint8_t d = 0; d < r.decimals; ++d) step /= 10;
+      uint32_t k = rng() % 8;
+      values[i] = k == 0  ? NAN
+                  : k < 3 ? r.lo + (r.hi - r.lo) * (rng() % 1000) / 1000.0f
+                          : values[i] + step * (float)((int)(rng() % 5) - 2);
+      setDangerTile(r.tile, r.color(values[i]));
+      numLabelSetFloat(r.label, values[i], r.decimals);
+    }
+    if (rng() % 4 == 0) numLabelSetInt(free, (int32_t)(rng() % 3 ? rng() % 100 : rng() % 100000) - 50);
+    lv_refr_now(display.lvDisplay());
+    memcpy(drawn.data(), tft.framebuffer(), bytes);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(display.lvDisplay());
+    if (memcmp(drawn.data(), tft.framebuffer(), bytes) != 0) {
+      printf("[GOLDEN] readouts FAIL: update %d left pixels a full redraw changes\n", u);
+      ok = false;
+    }
+  }
+  lv_obj_del(free);
+  for (const Readout& r : readouts) lv_obj_clear_flag(r.icon, LV_OBJ_FLAG_HIDDEN);
+  if (ok) printf("[GOLDEN] readouts ok\n");
+  return ok;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  bool print = false;
+  const char* dumpPrefix = nullptr;
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--print")) {
+      print = true;
+    } else if (!strcmp(argv[i], "--dump") && i + 1 < argc) {
+      dumpPrefix = argv[++i];
+    } else {
+      fprintf(stderr, "usage: %s [--print] [--dump PREFIX]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  sim::setClockMode(sim::ClockMode::Virtual);
+  sim::installDefaultBoard({MQ135_PIN, UV_SENSOR_PIN, BATTERY_LEVEL_PIN, BATTERY_CHARGER_PIN});
+
+  static Display display;
+  if (!display.begin(SCREEN_W, SCREEN_H, /*rotation*/ 2)) return 1;
+  ui_init();
+  installNumericLabels();
+  installTextPagers();
+
+  static lv_obj_t* screens[] = {ui_SensorData, ui_DailyQuote, ui_EmailSummary};
+  DisplayManager::Params dmp;
+  dmp.screen_y = UI_COMP_NOTIFICATIONBAR_HEIGHT;
+  static DisplayManager dm(TOUCH_LEFT_PIN, TOUCH_RIGHT_PIN, dmp);
+  dm.begin(screens, 3);
+  dm.setAutoRotate(false);
+
+  // Tinted status icons and a part-filled battery, so recolouring and
+  // blending over colour are in the picture
+  showBatteryUI(57);
+  updateWifiUI(true, true, -60);
+  updateMqttUI(true, true, true, false);
+
+  const TFT_eSPI& tft = display.tft();
+  const size_t bytes = (size_t)tft.width() * tft.height() * sizeof(uint16_t);
+  int failures = 0;
+  for (int f = 0; f < kFrames; ++f) {
+    if (f < 3) {
+      if (f) dm.next();
+      settle(1000);
+      lv_obj_invalidate(lv_layer_top());
+      lv_obj_invalidate(lv_scr_act());
+    } else if (f == 3) {
+      // Stop halfway through the fade back to the first screen
+      dm.setActive(0);
+      settle(dmp.anim_time_ms / 2);
+    } else if (f == 4) {
+      // ... and halfway through the slide on to the second
+      settle(1000);
+      dm.next();
+      settle(dmp.anim_time_ms / 2);
+    } else {
+      // Second page of a quote too long for one
+      settle(1000);
+      updateDailyQuote(kLongQuote);
+      textPagerStepOn(lv_scr_act(), +1);
+      settle(100);
+    }
+    lv_refr_now(display.lvDisplay());
+
+    const uint8_t* fb = reinterpret_cast<const uint8_t*>(tft.framebuffer());
+    uint64_t h = fnv1a(fb, bytes);
+    if (dumpPrefix) {
+      char path[512];
+      snprintf(path, sizeof(path), "%s%s.bin", dumpPrefix, kGolden[f].name);
+      FILE* out = fopen(path, "wb");
+      if (!out || fwrite(fb, 1, bytes, out) != bytes) perror(path);
+      if (out) fclose(out);
+    }
+    if (print) {
+      printf("    {\"%s\", 0x%016llxull},\n", kGolden[f].name, (unsigned long long)h);
+    } else if (h != kGolden[f].hash) {
+      printf("[GOLDEN] %-8s FAIL %016llx, expected %016llx\n", kGolden[f].name, (unsigned long long)h,
+             (unsigned long long)kGolden[f].hash);
+      ++failures;
+    } else {
+      printf("[GOLDEN] %-8s ok\n", kGolden[f].name);
+    }
+  }
+  if (!print && !checkFontTables()) ++failures;
+#if LV_OBJ_EVENT_MASK
+  if (!print && !checkEventMask()) ++failures;
+#endif
+  if (!print) {
+    dm.setActive(0);
+    settle(1000);
+    if (!checkLabelDiff(display)) ++failures;
+  }
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,353 @@
+// Icon pipeline for the recoloured status icons. SquareLine exports them as
+// 32x32 TRUE_COLOR_ALPHA bitmaps that the notification bar zooms down and
+// recolours on every draw. This renders each one exactly as the bar lays it
+// out (object size, zoom, pivot), captures the coverage LVGL blends, and
+// writes it back as a pre-scaled ALPHA_8BIT or ALPHA_4BIT image. Drawn 1:1
+// with img_recolor as the tint, an alpha image takes the mask blend path in
+// lv_draw_sw_img.c instead of transform + per-pixel recolour.
+//
+//   auralink_iconconv [--bits 4|8] [--write DIR | --check DIR] [--bench N]
+//
+// With no action it prints the conversion table. --write regenerates
+// DIR/ui_img_<name>_a<bits>.c; --check exits 1 if those files are stale.
+// --bench N draws every icon N times through the old and the new path and
+// reports host CPU time per draw.
+#include <Arduino.h>
+#include <draw/sw/lv_draw_sw.h>
+#include <sim.h>
+#include <ui.h>
+
+#include <string>
+#include <vector>
+
+#include "User_Setup.h"
+#include "display.h"
+
+namespace {
+
+constexpr lv_coord_t kCentre = LV_COORD_MIN;  // pivot at the image centre (LVGL default)
+constexpr lv_coord_t kOrigin = 48;            // where the object is placed while capturing
+
+// The notification bar's icons as SquareLine lays them out
+struct Icon {
+  const char* name;
+  const lv_img_dsc_t* src;
+  lv_coord_t w, h;
+  uint16_t zoom;
+  lv_coord_t pivotX, pivotY;
+};
+
+const Icon kIcons[] = {
+    {"pub", &ui_img_pub_png, 20, 23, 96, kCentre, kCentre},
+    {"sub", &ui_img_sub_png, 27, 30, 96, -10, 0},
+    {"wifi", &ui_img_wifiicon_png, 20, 23, 190, -10, 6},
+    {"charging", &ui_img_chargingicon_png, 16, 16, 192, kCentre, kCentre},
+};
+
+// Coverage (mask x opa) of everything blended while capturing, in screen
+// coordinates
+struct Canvas {
+  lv_coord_t w = 0, h = 0;
+  std::vector<uint8_t> a;
+  void clear(lv_coord_t cw, lv_coord_t ch) {
+    w = cw;
+    h = ch;
+    a.assign((size_t)w * h, 0);
+  }
+};
+
+Canvas gCanvas;
+lv_obj_t* gBlank = nullptr;  // loaded while a stage is deleted
+bool gInImg = false;         // between the image's DRAW_MAIN_BEGIN and END
+uint32_t gDrawStart = 0;
+uint64_t gDrawCyc = 0;       // host CPU time spent drawing the image
+void (*gBlendCb)(lv_draw_ctx_t*, const lv_draw_sw_blend_dsc_t*) = nullptr;
+
+void drawBegin(lv_event_t*) {
+  gInImg = true;
+  gDrawStart = ESP.getCycleCount();
+}
+
+void drawEnd(lv_event_t*) {
+  gDrawCyc += ESP.getCycleCount() - gDrawStart;
+  gInImg = false;
+}
+
+void captureBlend(lv_draw_ctx_t* ctx, const lv_draw_sw_blend_dsc_t* dsc) {
+  gBlendCb(ctx, dsc);
+  if (!gInImg) return;
+  lv_area_t area;
+  if (!_lv_area_intersect(&area, dsc->blend_area, ctx->clip_area)) return;
+  if (dsc->mask_buf && dsc->mask_res == LV_DRAW_MASK_RES_TRANSP) return;
+  const lv_area_t* ma = dsc->mask_area;
+  lv_coord_t mw = ma ? lv_area_get_width(ma) : 0;
+  for (lv_coord_t y = area.y1; y <= area.y2; ++y) {
+    for (lv_coord_t x = area.x1; x <= area.x2; ++x) {
+      uint32_t m = dsc->mask_buf ? dsc->mask_buf[(y - ma->y1) * mw + (x - ma->x1)] : 255;
+      uint32_t cov = dsc->opa >= LV_OPA_MAX ? m : (m * dsc->opa) >> 8;
+      if (x < 0 || y < 0 || x >= gCanvas.w || y >= gCanvas.h) continue;
+      uint8_t& dst = gCanvas.a[(size_t)y * gCanvas.w + x];
+      dst = (uint8_t)(dst + ((255 - dst) * cov) / 255);
+    }
+  }
+}
+
+// An unstyled screen holding one image object at (kOrigin, kOrigin), tinted
+// white so the old and new paths are comparable
+lv_obj_t* makeStage(lv_obj_t** img, const lv_img_dsc_t* src, lv_coord_t w, lv_coord_t h, uint16_t zoom,
+                    lv_coord_t pivotX, lv_coord_t pivotY) {
+  lv_obj_t* scr = lv_obj_create(nullptr);
+  lv_obj_remove_style_all(scr);
+  lv_obj_set_style_bg_color(scr, lv_color_black(), LV_PART_MAIN);
+  lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, LV_PART_MAIN);
+  *img = lv_img_create(scr);
+  lv_img_set_src(*img, src);
+  lv_obj_set_size(*img, w, h);
+  lv_obj_set_pos(*img, kOrigin, kOrigin);
+  if (pivotX != kCentre) lv_img_set_pivot(*img, pivotX, pivotY);
+  if (zoom != LV_IMG_ZOOM_NONE) lv_img_set_zoom(*img, zoom);
+  lv_obj_set_style_img_recolor(*img, lv_color_white(), LV_PART_MAIN);
+  lv_obj_set_style_img_recolor_opa(*img, LV_OPA_COVER, LV_PART_MAIN);
+  lv_obj_add_event_cb(*img, drawBegin, LV_EVENT_DRAW_MAIN_BEGIN, nullptr);
+  lv_obj_add_event_cb(*img, drawEnd, LV_EVENT_DRAW_MAIN_END, nullptr);
+  lv_scr_load(scr);
+  return scr;
+}
+
+void dropStage(lv_obj_t* scr) {
+  lv_scr_load(gBlank);
+  lv_obj_del(scr);
+}
+
+// Renders a stage and records the image's coverage over the whole display
+void capture(lv_disp_t* disp, lv_obj_t* scr) {
+  lv_draw_sw_ctx_t* sw = (lv_draw_sw_ctx_t*)disp->driver->draw_ctx;
+  gCanvas.clear(lv_disp_get_hor_res(disp), lv_disp_get_ver_res(disp));
+  gBlendCb = sw->blend;
+  sw->blend = captureBlend;
+  lv_obj_invalidate(scr);
+  lv_refr_now(disp);
+  sw->blend = gBlendCb;
+}
+
+struct Converted {
+  const Icon* icon;
+  lv_coord_t dx = 0, dy = 0, w = 0, h = 0;  // bounding box, relative to the object's top-left
+  std::vector<uint8_t> a8;                   // w*h coverage
+  std::vector<uint8_t> data;                 // encoded at the requested depth
+  lv_img_dsc_t dsc{};
+};
+
+bool convert(lv_disp_t* disp, const Icon& icon, int bits, Converted& out) {
+  lv_obj_t* img;
+  lv_obj_t* scr = makeStage(&img, icon.src, icon.w, icon.h, icon.zoom, icon.pivotX, icon.pivotY);
+  capture(disp, scr);
+  lv_coord_t x1 = gCanvas.w, y1 = gCanvas.h, x2 = -1, y2 = -1;
+  for (lv_coord_t y = 0; y < gCanvas.h; ++y) {
+    for (lv_coord_t x = 0; x < gCanvas.w; ++x) {
+      if (!gCanvas.a[(size_t)y * gCanvas.w + x]) continue;
+      x1 = std::min(x1, x); x2 = std::max(x2, x);
+      y1 = std::min(y1, y); y2 = std::max(y2, y);
+    }
+  }
+  dropStage(scr);
+  if (x2 < 0) return false;
+
+  out.icon = &icon;
+  out.dx = x1 - kOrigin;
+  out.dy = y1 - kOrigin;
+  out.w = x2 - x1 + 1;
+  out.h = y2 - y1 + 1;
+  out.a8.clear();
+  for (lv_coord_t y = y1; y <= y2; ++y) {
+    const uint8_t* row = &gCanvas.a[(size_t)y * gCanvas.w];
+    out.a8.insert(out.a8.end(), row + x1, row + x2 + 1);
+  }
+  if (bits == 8) {
+    out.data = out.a8;
+  } else {
+    // Rows are byte aligned, high nibble first (lv_img_decoder.c)
+    size_t stride = (out.w + 1) / 2;
+    out.data.assign(stride * out.h, 0);
+    for (lv_coord_t y = 0; y < out.h; ++y) {
+      for (lv_coord_t x = 0; x < out.w; ++x) {
+        uint8_t v = (uint8_t)((out.a8[(size_t)y * out.w + x] * 15 + 127) / 255);
+        out.data[y * stride + x / 2] |= (x & 1) ? v : (uint8_t)(v << 4);
+      }
+    }
+  }
+  out.dsc.header.always_zero = 0;
+  out.dsc.header.w = out.w;
+  out.dsc.header.h = out.h;
+  out.dsc.header.cf = bits == 8 ? LV_IMG_CF_ALPHA_8BIT : LV_IMG_CF_ALPHA_4BIT;
+  out.dsc.data_size = out.data.size();
+  out.dsc.data = out.data.data();
+  return true;
+}
+
+// Largest coverage difference between the converted image drawn 1:1 and the
+// original path; 0 means the rendered pixels are identical
+int roundTripError(lv_disp_t* disp, const Converted& c) {
+  std::vector<uint8_t> ref(gCanvas.a);
+  lv_obj_t* img;
+  lv_obj_t* scr = makeStage(&img, &c.dsc, c.w, c.h, LV_IMG_ZOOM_NONE, kCentre, kCentre);
+  lv_obj_set_pos(img, kOrigin + c.dx, kOrigin + c.dy);
+  capture(disp, scr);
+  dropStage(scr);
+  int err = 0;
+  for (size_t i = 0; i < ref.size(); ++i) err = std::max(err, std::abs((int)ref[i] - (int)gCanvas.a[i]));
+  return err;
+}
+
+std::string symbol(const Converted& c, int bits) {
+  return std::string("ui_img_") + c.icon->name + "_a" + std::to_string(bits);
+}
+
+std::string render(const Converted& c, int bits) {
+  std::string sym = symbol(c, bits);
+  char line[256];
+  std::string s =
+      "// This file was generated by auralink_iconconv (host/src/iconconv_main.cpp)\n"
+      "// LVGL version: 8.3.11\n"
+      "// Project name: AuraLink\n"
+      "\n"
+      "#include \"ui.h\"\n"
+      "\n"
+      "#ifndef LV_ATTRIBUTE_MEM_ALIGN\n"
+      "    #define LV_ATTRIBUTE_MEM_ALIGN\n"
+      "#endif\n"
+      "\n";
+  snprintf(line, sizeof(line),
+           "// IMAGE DATA: %s at zoom %u in a %dx%d object, as an alpha mask drawn\n"
+           "// 1:1 at (%+d,%+d) from that object's top-left. The colour is img_recolor.\n",
+           c.icon->name, (unsigned)c.icon->zoom, (int)c.icon->w, (int)c.icon->h, (int)c.dx, (int)c.dy);
+  s += line;
+  s += "const LV_ATTRIBUTE_MEM_ALIGN uint8_t " + sym + "_data[] = {\n";
+  size_t stride = c.data.size() / c.h;
+  for (lv_coord_t y = 0; y < c.h; ++y) {
+    s += "    ";
+    for (size_t x = 0; x < stride; ++x) {
+      snprintf(line, sizeof(line), "0x%02X,", c.data[y * stride + x]);
+      s += line;
+    }
+    s += "\n";
+  }
+  s += "};\n";
+  s += "const lv_img_dsc_t " + sym + " = {\n";
+  s += "    .header.always_zero = 0,\n";
+  s += "    .header.w = " + std::to_string(c.w) + ",\n";
+  s += "    .header.h = " + std::to_string(c.h) + ",\n";
+  s += "    .data_size = sizeof(" + sym + "_data),\n";
+  s += std::string("    .header.cf = ") + (bits == 8 ? "LV_IMG_CF_ALPHA_8BIT" : "LV_IMG_CF_ALPHA_4BIT") + ",\n";
+  s += "    .data = " + sym + "_data\n";
+  s += "};\n";
+  return s;
+}
+
+bool readFile(const std::string& path, std::string& out) {
+  FILE* f = fopen(path.c_str(), "rb");
+  if (!f) return false;
+  char buf[4096];
+  size_t n;
+  out.clear();
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.append(buf, n);
+  fclose(f);
+  return true;
+}
+
+// Host CPU time per draw of the stage's image, in microseconds
+double timeDraws(lv_disp_t* disp, lv_obj_t* scr, int n) {
+  lv_refr_now(disp);  // warm the image cache
+  gDrawCyc = 0;
+  for (int i = 0; i < n; ++i) {
+    lv_obj_invalidate(scr);
+    lv_refr_now(disp);
+  }
+  return (double)gDrawCyc / ESP.getCpuFreqMHz() / n;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int bits = 8;
+  const char* writeDir = nullptr;
+  const char* checkDir = nullptr;
+  int benchN = 0;
+  bool usage = false;
+  for (int i = 1; i < argc && !usage; ++i) {
+    if (!strcmp(argv[i], "--bits") && i + 1 < argc) {
+      bits = atoi(argv[++i]);
+      usage = bits != 4 && bits != 8;
+    } else if (!strcmp(argv[i], "--write") && i + 1 < argc) {
+      writeDir = argv[++i];
+    } else if (!strcmp(argv[i], "--check") && i + 1 < argc) {
+      checkDir = argv[++i];
+    } else if (!strcmp(argv[i], "--bench") && i + 1 < argc) {
+      benchN = atoi(argv[++i]);
+      usage = benchN <= 0;
+    } else {
+      usage = true;
+    }
+  }
+  if (usage || (writeDir && checkDir)) {
+    fprintf(stderr, "usage: %s [--bits 4|8] [--write DIR | --check DIR] [--bench N]\n", argv[0]);
+    return 2;
+  }
+
+  sim::setClockMode(sim::ClockMode::Virtual);
+  static Display display;
+  if (!display.begin(SCREEN_W, SCREEN_H, /*rotation*/ 2)) return 1;
+  lv_disp_t* disp = display.lvDisplay();
+  gBlank = lv_scr_act();
+
+  std::vector<Converted> out(sizeof(kIcons) / sizeof(kIcons[0]));
+  bool ok = true;
+  printf("[ICONCONV] %-9s %11s %8s %9s %9s %5s\n", "icon", "source", "bytes", "alpha", "bytes", "err");
+  for (size_t i = 0; i < out.size(); ++i) {
+    const Icon& icon = kIcons[i];
+    if (!convert(disp, icon, bits, out[i])) {
+      fprintf(stderr, "[ICONCONV] %s: nothing drawn\n", icon.name);
+      return 1;
+    }
+    const Converted& c = out[i];
+    int err = roundTripError(disp, c);
+    printf("[ICONCONV] %-9s %5ux%-5u %8u %4dx%-4d %9u %5d  at (%+d,%+d)\n", icon.name, (unsigned)icon.src->header.w,
+           (unsigned)icon.src->header.h, (unsigned)icon.src->data_size, (int)c.w, (int)c.h,
+           (unsigned)c.dsc.data_size, err, (int)c.dx, (int)c.dy);
+
+    std::string text = render(c, bits);
+    if (writeDir || checkDir) {
+      std::string path = std::string(writeDir ? writeDir : checkDir) + "/" + symbol(c, bits) + ".c";
+      if (writeDir) {
+        FILE* f = fopen(path.c_str(), "wb");
+        if (!f || fwrite(text.data(), 1, text.size(), f) != text.size()) {
+          perror(path.c_str());
+          return 1;
+        }
+        fclose(f);
+      } else {
+        std::string disk;
+        if (!readFile(path, disk) || disk != text) {
+          fprintf(stderr, "[ICONCONV] %s is stale; rerun with --write\n", path.c_str());
+          ok = false;
+        }
+      }
+    }
+  }
+
+  if (benchN) {
+    printf("[ICONCONV] %-9s %12s %12s   us per draw, %d draws\n", "icon", "zoom+recolor", "alpha mask", benchN);
+    for (const Converted& c : out) {
+      const Icon& icon = *c.icon;
+      lv_obj_t* img;
+      lv_obj_t* scr = makeStage(&img, icon.src, icon.w, icon.h, icon.zoom, icon.pivotX, icon.pivotY);
+      double before = timeDraws(disp, scr, benchN);
+      dropStage(scr);
+      scr = makeStage(&img, &c.dsc, c.w, c.h, LV_IMG_ZOOM_NONE, kCentre, kCentre);
+      double after = timeDraws(disp, scr, benchN);
+      dropStage(scr);
+      printf("[ICONCONV] %-9s %12.2f %12.2f\n", icon.name, before, after);
+    }
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,76 @@
+// Host entry point: runs the unmodified sketch (setup() once, then loop())
+// on simulated hardware.
+//
+//   --seconds N        stop after N seconds of firmware time (default: run forever)
+//   --virtual-clock    let time advance only through delay(); runs faster than real time
+//   --broker HOST:PORT MQTT broker to talk to (default 127.0.0.1:1883)
+//   --trace FILE       record raw sensor samples (trace.h) for auralink_replay
+#include <Arduino.h>
+#include <sim.h>
+
+#include "User_Setup.h"
+
+static char gBrokerHost[64] = "127.0.0.1";
+static uint16_t gBrokerPort = 1883;
+
+#undef MQTT_HOST
+#undef MQTT_PORT
+#define MQTT_HOST gBrokerHost
+#define MQTT_PORT gBrokerPort
+
+#include "../../auralink.ino"
+
+// Print sink for the sensor trace
+class FilePrint : public Print {
+ public:
+  explicit FilePrint(FILE* f) : _f(f) {}
+  size_t write(uint8_t c) override { return fwrite(&c, 1, 1, _f); }
+  size_t write(const uint8_t* buffer, size_t size) override { return fwrite(buffer, 1, size, _f); }
+
+ private:
+  FILE* _f;
+};
+
+int main(int argc, char** argv) {
+  double seconds = -1.0;
+  FILE* trace = nullptr;
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--seconds") && i + 1 < argc) {
+      seconds = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--virtual-clock")) {
+      sim::setClockMode(sim::ClockMode::Virtual);
+    } else if (!strcmp(argv[i], "--broker") && i + 1 < argc) {
+      const char* arg = argv[++i];
+      const char* colon = strrchr(arg, ':');
+      size_t n = colon ? (size_t)(colon - arg) : strlen(arg);
+      if (n >= sizeof(gBrokerHost)) n = sizeof(gBrokerHost) - 1;
+      memcpy(gBrokerHost, arg, n);
+      gBrokerHost[n] = '\0';
+      if (colon) gBrokerPort = (uint16_t)atoi(colon + 1);
+    } else if (!strcmp(argv[i], "--trace") && i + 1 < argc) {
+      trace = fopen(argv[++i], "wb");
+      if (!trace) {
+        perror(argv[i]);
+        return 1;
+      }
+    } else {
+      fprintf(stderr, "usage: %s [--seconds N] [--virtual-clock] [--broker HOST:PORT] [--trace FILE]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  sim::installDefaultBoard({MQ135_PIN, UV_SENSOR_PIN, BATTERY_LEVEL_PIN, BATTERY_CHARGER_PIN});
+
+  static FilePrint traceOut(trace);
+  if (trace) sensorTrace.begin(traceOut);
+
+  setup();
+  const uint64_t endUs = seconds < 0 ? UINT64_MAX : sim::nowMicros() + (uint64_t)(seconds * 1e6);
+  while (sim::nowMicros() < endUs) loop();
+  Serial.flush();
+  if (trace) {
+    sensorTrace.end();
+    fclose(trace);
+  }
+  return 0;
+}
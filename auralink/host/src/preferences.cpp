@@ -0,0 +1,71 @@
+#include <Preferences.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+using Blob = std::vector<uint8_t>;
+static std::map<std::string, std::map<std::string, Blob>> gStore;
+
+bool Preferences::begin(const char* name, bool readOnly, const char* partition) {
+  (void)partition;
+  if (!name || !*name) return false;
+  _ns = name;
+  _readOnly = readOnly;
+  _open = true;
+  return true;
+}
+
+void Preferences::end() { _open = false; }
+
+bool Preferences::clear() {
+  if (!_open || _readOnly) return false;
+  gStore[_ns.c_str()].clear();
+  return true;
+}
+
+bool Preferences::remove(const char* key) {
+  if (!_open || _readOnly) return false;
+  return gStore[_ns.c_str()].erase(key) > 0;
+}
+
+bool Preferences::isKey(const char* key) {
+  if (!_open) return false;
+  auto& ns = gStore[_ns.c_str()];
+  return ns.find(key) != ns.end();
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t len) {
+  if (!_open || _readOnly || !key) return 0;
+  const uint8_t* p = (const uint8_t*)value;
+  gStore[_ns.c_str()][key] = Blob(p, p + len);
+  return len;
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+  if (!_open) return 0;
+  auto& ns = gStore[_ns.c_str()];
+  auto it = ns.find(key);
+  return it == ns.end() ? 0 : it->second.size();
+}
+
+size_t Preferences::getBytes(const char* key, void* buf, size_t maxLen) {
+  size_t len = getBytesLength(key);
+  if (len == 0 || len > maxLen) return 0;
+  memcpy(buf, gStore[_ns.c_str()][key].data(), len);
+  return len;
+}
+
+size_t Preferences::putUInt(const char* key, uint32_t value) { return putBytes(key, &value, sizeof(value)); }
+
+uint32_t Preferences::getUInt(const char* key, uint32_t defaultValue) {
+  uint32_t v;
+  return getBytes(key, &v, sizeof(v)) == sizeof(v) ? v : defaultValue;
+}
+
+size_t Preferences::putFloat(const char* key, float value) { return putBytes(key, &value, sizeof(value)); }
+
+float Preferences::getFloat(const char* key, float defaultValue) {
+  float v;
+  return getBytes(key, &v, sizeof(v)) == sizeof(v) ? v : defaultValue;
+}
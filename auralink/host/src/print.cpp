@@ -0,0 +1,251 @@
+#include <Arduino.h>
+#include <IPAddress.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <string>
+
+HardwareSerial Serial;
+
+// ---- Print ----
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+  size_t n = 0;
+  while (size--) n += write(*buffer++);
+  return n;
+}
+
+size_t Print::write(const char* str) { return str ? write((const uint8_t*)str, strlen(str)) : 0; }
+
+size_t Print::vprintf(const char* format, va_list args) {
+  char small[128];
+  va_list copy;
+  va_copy(copy, args);
+  int len = vsnprintf(small, sizeof(small), format, copy);
+  va_end(copy);
+  if (len < 0) return 0;
+  if ((size_t)len < sizeof(small)) return write((const uint8_t*)small, (size_t)len);
+
+  std::string big((size_t)len + 1, '\0');
+  vsnprintf(&big[0], big.size(), format, args);
+  return write((const uint8_t*)big.data(), (size_t)len);
+}
+
+size_t Print::printf(const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  size_t n = vprintf(format, args);
+  va_end(args);
+  return n;
+}
+
+size_t Print::_printNumber(unsigned long long n, int base) {
+  char buf[8 * sizeof(n) + 1];
+  char* p = &buf[sizeof(buf) - 1];
+  *p = '\0';
+  if (base < 2) base = 10;
+  do {
+    int d = (int)(n % (unsigned)base);
+    *--p = (char)(d < 10 ? '0' + d : 'A' + d - 10);
+    n /= (unsigned)base;
+  } while (n);
+  return write(p);
+}
+
+size_t Print::print(const __FlashStringHelper* s) { return write(reinterpret_cast<const char*>(s)); }
+size_t Print::print(const String& s) { return write((const uint8_t*)s.c_str(), s.length()); }
+size_t Print::print(const char* s) { return write(s); }
+size_t Print::print(char c) { return write((uint8_t)c); }
+size_t Print::print(unsigned char n, int base) { return _printNumber(n, base); }
+size_t Print::print(int n, int base) { return print((long long)n, base); }
+size_t Print::print(unsigned int n, int base) { return _printNumber(n, base); }
+size_t Print::print(long n, int base) { return print((long long)n, base); }
+size_t Print::print(unsigned long n, int base) { return _printNumber(n, base); }
+size_t Print::print(unsigned long long n, int base) { return _printNumber(n, base); }
+
+size_t Print::print(long long n, int base) {
+  if (base == 10 && n < 0) return write('-') + _printNumber((unsigned long long)(-n), 10);
+  return _printNumber((unsigned long long)n, base);
+}
+
+size_t Print::print(double n, int digits) { return printf("%.*f", digits, n); }
+size_t Print::print(const Printable& p) { return p.printTo(*this); }
+
+size_t Print::println() { return write("\r\n"); }
+size_t Print::println(const __FlashStringHelper* s) { return print(s) + println(); }
+size_t Print::println(const String& s) { return print(s) + println(); }
+size_t Print::println(const char* s) { return print(s) + println(); }
+size_t Print::println(char c) { return print(c) + println(); }
+size_t Print::println(unsigned char n, int base) { return print(n, base) + println(); }
+size_t Print::println(int n, int base) { return print(n, base) + println(); }
+size_t Print::println(unsigned int n, int base) { return print(n, base) + println(); }
+size_t Print::println(long n, int base) { return print(n, base) + println(); }
+size_t Print::println(unsigned long n, int base) { return print(n, base) + println(); }
+size_t Print::println(long long n, int base) { return print(n, base) + println(); }
+size_t Print::println(unsigned long long n, int base) { return print(n, base) + println(); }
+size_t Print::println(double n, int digits) { return print(n, digits) + println(); }
+size_t Print::println(const Printable& p) { return print(p) + println(); }
+
+// ---- Stream ----
+
+int Stream::_timedRead() {
+  unsigned long start = millis();
+  do {
+    int c = read();
+    if (c >= 0) return c;
+  } while (millis() - start < _timeout);
+  return -1;
+}
+
+size_t Stream::readBytes(char* buffer, size_t length) {
+  size_t n = 0;
+  while (n < length) {
+    int c = _timedRead();
+    if (c < 0) break;
+    buffer[n++] = (char)c;
+  }
+  return n;
+}
+
+// ---- Serial (stdout/stdin) ----
+
+static int gSerialPeek = -1;
+
+size_t HardwareSerial::write(uint8_t c) { return fwrite(&c, 1, 1, stdout); }
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) { return fwrite(buffer, 1, size, stdout); }
+void HardwareSerial::flush() { fflush(stdout); }
+
+int HardwareSerial::available() {
+  if (gSerialPeek >= 0) return 1;
+  struct pollfd p = {STDIN_FILENO, POLLIN, 0};
+  return poll(&p, 1, 0) > 0 ? 1 : 0;
+}
+
+int HardwareSerial::read() {
+  if (gSerialPeek >= 0) {
+    int c = gSerialPeek;
+    gSerialPeek = -1;
+    return c;
+  }
+  if (!available()) return -1;
+  unsigned char c;
+  return ::read(STDIN_FILENO, &c, 1) == 1 ? c : -1;
+}
+
+int HardwareSerial::peek() {
+  if (gSerialPeek < 0) gSerialPeek = read();
+  return gSerialPeek;
+}
+
+// ---- String ----
+
+static std::string _fmtInt(unsigned long long n, bool neg, unsigned char base) {
+  std::string s;
+  if (base < 2) base = 10;
+  do {
+    int d = (int)(n % base);
+    s.insert(s.begin(), (char)(d < 10 ? '0' + d : 'a' + d - 10));
+    n /= base;
+  } while (n);
+  if (neg) s.insert(s.begin(), '-');
+  return s;
+}
+
+static std::string _fmtSigned(long long n, unsigned char base) {
+  if (base == 10 && n < 0) return _fmtInt((unsigned long long)(-n), true, base);
+  return _fmtInt((unsigned long long)n, false, base);
+}
+
+static std::string _fmtFloat(double n, unsigned int decimals) {
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.*f", (int)decimals, n);
+  return buf;
+}
+
+String::String(unsigned char n, unsigned char base) : _s(_fmtInt(n, false, base)) {}
+String::String(int n, unsigned char base) : _s(_fmtSigned(n, base)) {}
+String::String(unsigned int n, unsigned char base) : _s(_fmtInt(n, false, base)) {}
+String::String(long n, unsigned char base) : _s(_fmtSigned(n, base)) {}
+String::String(unsigned long n, unsigned char base) : _s(_fmtInt(n, false, base)) {}
+String::String(long long n, unsigned char base) : _s(_fmtSigned(n, base)) {}
+String::String(unsigned long long n, unsigned char base) : _s(_fmtInt(n, false, base)) {}
+String::String(float n, unsigned int decimals) : _s(_fmtFloat(n, decimals)) {}
+String::String(double n, unsigned int decimals) : _s(_fmtFloat(n, decimals)) {}
+
+int String::indexOf(char c, unsigned int from) const {
+  size_t i = _s.find(c, from);
+  return i == std::string::npos ? -1 : (int)i;
+}
+
+int String::indexOf(const String& s, unsigned int from) const {
+  size_t i = _s.find(s._s, from);
+  return i == std::string::npos ? -1 : (int)i;
+}
+
+int String::lastIndexOf(char c) const {
+  size_t i = _s.rfind(c);
+  return i == std::string::npos ? -1 : (int)i;
+}
+
+String String::substring(unsigned int from) const { return from < _s.size() ? String(_s.substr(from)) : String(); }
+
+String String::substring(unsigned int from, unsigned int to) const {
+  if (from > to) std::swap(from, to);
+  if (from >= _s.size()) return String();
+  return String(_s.substr(from, to - from));
+}
+
+bool String::endsWith(const String& s) const {
+  return _s.size() >= s._s.size() && _s.compare(_s.size() - s._s.size(), s._s.size(), s._s) == 0;
+}
+
+void String::trim() {
+  size_t b = _s.find_first_not_of(" \t\r\n");
+  size_t e = _s.find_last_not_of(" \t\r\n");
+  _s = (b == std::string::npos) ? std::string() : _s.substr(b, e - b + 1);
+}
+
+void String::toLowerCase() {
+  for (auto& c : _s) c = (char)tolower((unsigned char)c);
+}
+
+void String::toUpperCase() {
+  for (auto& c : _s) c = (char)toupper((unsigned char)c);
+}
+
+void String::replace(const String& from, const String& to) {
+  if (from._s.empty()) return;
+  size_t pos = 0;
+  while ((pos = _s.find(from._s, pos)) != std::string::npos) {
+    _s.replace(pos, from._s.size(), to._s);
+    pos += to._s.size();
+  }
+}
+
+void String::remove(unsigned int index, unsigned int count) {
+  if (index < _s.size()) _s.erase(index, count);
+}
+
+long String::toInt() const { return strtol(_s.c_str(), nullptr, 10); }
+float String::toFloat() const { return strtof(_s.c_str(), nullptr); }
+double String::toDouble() const { return strtod(_s.c_str(), nullptr); }
+
+// ---- IPAddress ----
+
+bool IPAddress::fromString(const char* s) {
+  unsigned a, b, c, d;
+  if (!s || sscanf(s, "%u.%u.%u.%u", &a, &b, &c, &d) != 4 || a > 255 || b > 255 || c > 255 || d > 255) return false;
+  _b[0] = (uint8_t)a;
+  _b[1] = (uint8_t)b;
+  _b[2] = (uint8_t)c;
+  _b[3] = (uint8_t)d;
+  return true;
+}
+
+String IPAddress::toString() const {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _b[0], _b[1], _b[2], _b[3]);
+  return String(buf);
+}
+
+size_t IPAddress::printTo(Print& p) const { return p.print(toString()); }
@@ -0,0 +1,201 @@
+// Trace replay driver: feeds a recorded sensor trace (trace.h) back through
+// the firmware's sensor classes on the virtual clock, as fast as the host
+// can run them. A day of samples replays in seconds.
+//
+//   auralink_replay TRACE [--digest FILE] [--every SECONDS]
+//
+// The digest (stdout by default) prints every sensor's published value at a
+// fixed trace-time interval; diff two digests to check that a change keeps
+// the outputs identical. The summary on stderr reports host CPU time spent
+// inside each sensor's read().
+#include <Arduino.h>
+#include <Wire.h>
+#include <sim.h>
+
+#include <chrono>
+#include <vector>
+
+#include "User_Setup.h"
+#include "airquality.h"
+#include "battery.h"
+#include "i2c_bus.h"
+#include "illumination.h"
+#include "pressure.h"
+#include "thermohygrometer.h"
+#include "trace.h"
+#include "uv.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+enum Sensor { kAirQuality, kUV, kBattery, kIllumination, kPressure, kThermohygrometer, kSensorCount };
+const char* const kSensorNames[kSensorCount] = {"airquality", "uv", "battery", "illumination", "pressure",
+                                                "thermohygrometer"};
+
+struct Cost {
+  uint64_t calls = 0;
+  uint64_t ns = 0;
+};
+
+Cost gCost[kSensorCount];
+uint16_t gCounts[256];
+
+template <typename F>
+void timed(Sensor s, F&& read) {
+  auto t0 = Clock::now();
+  read();
+  gCost[s].ns += (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t0).count();
+  gCost[s].calls++;
+}
+
+bool loadFile(const char* path, std::vector<uint8_t>& out) {
+  FILE* f = fopen(path, "rb");
+  if (!f) return false;
+  uint8_t buf[65536];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.insert(out.end(), buf, buf + n);
+  fclose(f);
+  return true;
+}
+
+void digest(FILE* out, uint32_t traceMs, UV& uv) {
+  TemperatureHumidity th = thermohygrometer.average();
+  fprintf(out, "%10.1f aq=%.4f r0=%.4f warm=%d uv=%.4f batt=%d%% tte=%ld lux=%.4f hpa=%.4f t=%.4f rh=%.4f\n",
+          traceMs / 1000.0, airQuality.average(), airQuality.r0(), airQuality.warmingUp() ? 1 : 0, uv.average(),
+          battery.percent(), (long)battery.timeToEmptyMin(), illuminationMeter.average(),
+          pressureSensor.averagePressure(), th.temperature, th.humidity);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* tracePath = nullptr;
+  const char* digestPath = nullptr;
+  double everySec = 60.0;
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--digest") && i + 1 < argc) {
+      digestPath = argv[++i];
+    } else if (!strcmp(argv[i], "--every") && i + 1 < argc) {
+      everySec = atof(argv[++i]);
+    } else if (!tracePath && argv[i][0] != '-') {
+      tracePath = argv[i];
+    } else {
+      tracePath = nullptr;
+      break;
+    }
+  }
+  if (!tracePath || everySec <= 0.0) {
+    fprintf(stderr, "usage: %s TRACE [--digest FILE] [--every SECONDS]\n", argv[0]);
+    return 2;
+  }
+
+  std::vector<uint8_t> data;
+  if (!loadFile(tracePath, data)) {
+    perror(tracePath);
+    return 1;
+  }
+  FILE* out = digestPath ? fopen(digestPath, "w") : stdout;
+  if (!out) {
+    perror(digestPath);
+    return 1;
+  }
+
+  // Same board and sensor setup as the sketch, minus UI and network
+  sim::setClockMode(sim::ClockMode::Virtual);
+  sim::installDefaultBoard({MQ135_PIN, UV_SENSOR_PIN, BATTERY_LEVEL_PIN, BATTERY_CHARGER_PIN});
+  for (uint8_t pin : {(uint8_t)MQ135_PIN, (uint8_t)UV_SENSOR_PIN, (uint8_t)BATTERY_LEVEL_PIN}) {
+    sim::setAnalogSource(pin, [pin](uint64_t) { return gCounts[pin]; });
+  }
+
+  analogReadResolution(12);
+  i2cBus.begin(I2C_SDA_PIN, I2C_SCL_PIN);
+  illuminationMeter.begin(ILLUMINATION_SENSOR_ADDRESS, i2cBus.wire());
+  thermohygrometer.begin(DHT_PIN, DHT_TYPE);
+  airQuality.begin(MQ135_PIN, 10.0, 76.63, 5.0);
+  pressureSensor.begin();
+  UV uv(20);
+  uv.begin(UV_SENSOR_PIN);
+  battery.begin();
+  battery.setLoadMa(BATTERY_BASE_LOAD_MA);
+
+  SensorTraceReader reader(data.data(), data.size());
+  SensorTraceRecord r;
+  bool haveOffset = false;
+  int64_t offsetMs = 0;  // replay millis() - trace time
+  uint32_t firstMs = 0, lastMs = 0, nextDigest = 0;
+  uint64_t records = 0;
+  auto wall0 = Clock::now();
+
+  while (reader.next(r)) {
+    if (!haveOffset) {
+      offsetMs = (int64_t)millis() - r.timeMs;
+      firstMs = lastMs = r.timeMs;
+      nextDigest = r.timeMs + (uint32_t)(everySec * 1000.0);
+      haveOffset = true;
+    }
+    records++;
+
+    while (r.timeMs >= nextDigest) {
+      digest(out, nextDigest - firstMs, uv);
+      nextDigest += (uint32_t)(everySec * 1000.0);
+    }
+    lastMs = r.timeMs;
+
+    int64_t target = (int64_t)r.timeMs + offsetMs;
+    int64_t now = (int64_t)millis();
+    if (target > now) sim::advanceMicros((uint64_t)(target - now) * 1000);
+
+    switch (r.type) {
+      case SensorTrace::AdcCounts:
+        gCounts[r.channel] = (uint16_t)r.value;
+        if (r.channel == MQ135_PIN) {
+          timed(kAirQuality, [] {
+            TemperatureHumidity ambient = thermohygrometer.average();
+            airQuality.setAmbient(ambient.temperature, ambient.humidity);
+            airQuality.read();
+          });
+        } else if (r.channel == UV_SENSOR_PIN) {
+          timed(kUV, [&] { uv.read(); });
+        }
+        break;
+      case SensorTrace::AdcMillis:
+        // Smallest count that the shim's analogReadMilliVolts() maps back to this mV
+        gCounts[r.channel] = (uint16_t)(((uint32_t)r.value * 4095u + 3299u) / 3300u);
+        if (r.channel == BATTERY_LEVEL_PIN) timed(kBattery, [] { battery.read(); });
+        break;
+      case SensorTrace::Bh1750Raw:
+        sim::setBh1750Raw(r.value);
+        timed(kIllumination, [] { illuminationMeter.read(); });
+        break;
+      case SensorTrace::Bmp180:
+        sim::environment().pressureHpa = r.value / 100.0f;
+        sim::environment().temperatureC = r.value2 / 100.0f;
+        timed(kPressure, [] { pressureSensor.read(); });
+        break;
+      case SensorTrace::DhtFrame:
+        sim::setDhtFrame(r.frame);
+        timed(kThermohygrometer, [] { thermohygrometer.read(); });
+        break;
+      case SensorTrace::Digital:
+        if (r.channel == BATTERY_CHARGER_PIN) battery.setCharging(r.value != 0);
+        break;
+      default:
+        break;
+    }
+  }
+  if (haveOffset) digest(out, lastMs - firstMs, uv);
+  if (out != stdout) fclose(out);
+
+  double wallSec = std::chrono::duration<double>(Clock::now() - wall0).count();
+  double spanSec = (lastMs - firstMs) / 1000.0;
+  fprintf(stderr, "[REPLAY] %llu records, %zu bytes skipped, %.1f s of trace in %.3f s (%.0fx)\n",
+          (unsigned long long)records, reader.skippedBytes(), spanSec, wallSec,
+          wallSec > 0.0 ? spanSec / wallSec : 0.0);
+  for (int s = 0; s < kSensorCount; ++s) {
+    if (!gCost[s].calls) continue;
+    fprintf(stderr, "[REPLAY] %-16s %8llu reads %10.3f ms cpu %8.0f ns/read\n", kSensorNames[s],
+            (unsigned long long)gCost[s].calls, gCost[s].ns / 1e6, (double)gCost[s].ns / (double)gCost[s].calls);
+  }
+  return records ? 0 : 1;
+}
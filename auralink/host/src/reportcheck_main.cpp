@@ -0,0 +1,112 @@
+// Report-by-exception publisher (publisher.h) against a scripted transport on
+// the virtual clock.
+//
+//   auralink_reportcheck
+//
+// Escalates a field into a worse danger band while the transport refuses
+// the report, and exits 1 unless the refused report is neither counted nor
+// marked sent, the retry waits minIntervalMs, and the retried report goes
+// out as a danger alert. Also checks that no report is built while the
+// transport isn't ready and that a reading on a band edge doesn't flap.
+#include <Arduino.h>
+#include <sim.h>
+
+#include <string>
+
+#include "publisher.h"
+
+namespace {
+
+float gValue = 10.0f;
+bool gReady = true;
+int gRefuse = 0;    // reports still to refuse
+int gAttempts = 0;  // reports handed to the transport
+std::string gLast;  // last report taken
+
+// Band 0 below 50, 1 up to 100, 2 above
+uint8_t level(float v) { return v < 50.0f ? 0 : (v <= 100.0f ? 1 : 2); }
+
+bool publish(const uint8_t* payload, size_t len) {
+  gAttempts++;
+  if (gRefuse > 0) {
+    gRefuse--;
+    return false;
+  }
+  gLast.assign((const char*)payload, len);
+  return true;
+}
+
+bool fail(const char* what) {
+  fprintf(stderr, "[REPORTCHECK] %s (attempts %d, last %s)\n", what, gAttempts, gLast.c_str());
+  return false;
+}
+
+// Runs the loop once per 5 ms for `ms`
+void run(ReportPublisher& pub, uint32_t ms) {
+  for (uint32_t t = 0; t < ms; t += 5) {
+    pub.loop();
+    delay(5);
+  }
+}
+
+bool check() {
+  ReportPublisher::Params p;
+  p.heartbeatMs = 60000;
+  p.minIntervalMs = 1000;
+  ReportPublisher pub(p);
+  pub.addField("value", [] { return gValue; }, 2.0f, 0.0f, level);
+  pub.onPublish(publish);
+  pub.onReady([] { return gReady; });
+
+  // Not ready: nothing is built, and the next try waits minIntervalMs
+  gReady = false;
+  run(pub, 500);
+  if (gAttempts != 0 || pub.published() != 0) return fail("a report went out while the transport was not ready");
+  gReady = true;
+  run(pub, 600);
+  if (pub.published() != 1 || gLast.find("\"startup\"") == std::string::npos) return fail("no startup report");
+
+  // Escalation the transport refuses twice
+  run(pub, 2000);
+  gAttempts = 0;
+  gRefuse = 2;
+  gValue = 120.0f;
+  pub.loop();
+  if (gAttempts != 1) return fail("the escalation was not sent at once");
+  if (pub.alerts() != 0 || pub.published() != 1) return fail("a refused report was counted");
+  run(pub, 900);
+  if (gAttempts != 1) return fail("the refused report was retried before minIntervalMs");
+  run(pub, 2000);
+  if (gAttempts != 3) return fail("the refused report was not retried every minIntervalMs");
+  if (pub.alerts() != 1 || gLast.find("\"danger\"") == std::string::npos) return fail("the retry was not a danger alert");
+
+  // Sent now: the band is not raised again
+  gAttempts = 0;
+  run(pub, 5000);
+  if (gAttempts != 0) return fail("a report went out with nothing changed");
+
+  // Back to band 1 and sitting on its upper edge (100): within the 2.0
+  // deadband of the edge the band holds, so no alerts
+  gValue = 95.0f;
+  run(pub, 2000);
+  uint32_t alerts = pub.alerts();
+  for (int i = 0; i < 200; ++i) {
+    gValue = (i & 1) ? 100.5f : 99.5f;
+    run(pub, 10);
+  }
+  if (pub.alerts() != alerts) return fail("a reading on a band edge raised alerts");
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc > 1) {
+    fprintf(stderr, "usage: %s\n", argv[0]);
+    return 2;
+  }
+  sim::setClockMode(sim::ClockMode::Virtual);
+  if (!check()) return 1;
+  printf("[REPORTCHECK] refused reports are retried and alerts counted once sent\n");
+  return 0;
+}
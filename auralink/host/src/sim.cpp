@@ -0,0 +1,369 @@
+#include <Arduino.h>
+#include <sim.h>
+
+#include <map>
+
+namespace sim {
+
+// ---- room model ----
+
+static Environment gEnv;
+static EnvironmentModel gModel;
+
+void setEnvironmentModel(EnvironmentModel model) { gModel = std::move(model); }
+
+Environment& environment() {
+  if (gModel) gModel(nowMicros(), gEnv);
+  return gEnv;
+}
+
+// ---- replay overrides ----
+
+static int32_t gBh1750Raw = -1;
+static uint8_t gDhtFrame[5];
+static bool gDhtFrameSet = false;
+
+void setBh1750Raw(int32_t raw) { gBh1750Raw = raw; }
+int32_t bh1750Raw() { return gBh1750Raw; }
+
+void setDhtFrame(const uint8_t* frame) {
+  gDhtFrameSet = frame != nullptr;
+  if (frame) memcpy(gDhtFrame, frame, sizeof(gDhtFrame));
+}
+
+const uint8_t* dhtFrame() { return gDhtFrameSet ? gDhtFrame : nullptr; }
+
+// ---- GPIO / ADC ----
+
+struct Pin {
+  uint8_t mode = INPUT;
+  int level = LOW;
+  AnalogSource analog;
+  void (*isr)(void) = nullptr;
+};
+
+static std::map<uint8_t, Pin> gPins;
+
+// I2C pins as passed to Wire.begin(); used to emulate a stuck SDA line
+static int gSda = -1, gScl = -1;
+static bool gI2CStuck = false;
+static uint8_t gSclPulses = 0;
+
+void setAnalogSource(uint8_t pin, AnalogSource src) { gPins[pin].analog = std::move(src); }
+
+void setDigitalLevel(uint8_t pin, int level) {
+  Pin& p = gPins[pin];
+  bool changed = p.level != level;
+  p.level = level;
+  if (changed && p.isr) p.isr();
+}
+
+int digitalLevel(uint8_t pin) { return gPins[pin].level; }
+
+void fireInterrupt(uint8_t pin) {
+  Pin& p = gPins[pin];
+  if (p.isr) p.isr();
+}
+
+// ---- I2C registry ----
+
+static std::map<uint8_t, I2CDevice*> gI2C;
+static uint32_t gI2CTransactions = 0;
+
+void attachI2C(uint8_t addr, I2CDevice* dev) { gI2C[addr] = dev; }
+void detachI2C(uint8_t addr) { gI2C.erase(addr); }
+
+I2CDevice* i2cDevice(uint8_t addr) {
+  ++gI2CTransactions;
+  if (gI2CStuck) return nullptr;
+  auto it = gI2C.find(addr);
+  return it == gI2C.end() ? nullptr : it->second;
+}
+
+uint32_t i2cTransactions() { return gI2CTransactions; }
+
+void setI2CStuck(bool stuck) {
+  gI2CStuck = stuck;
+  gSclPulses = 0;
+}
+
+void setI2CPins(int sda, int scl) {
+  gSda = sda;
+  gScl = scl;
+}
+
+// ---- network ----
+
+static bool gWifiUp = true;
+void setWifiUp(bool up) { gWifiUp = up; }
+bool wifiUp() { return gWifiUp; }
+
+// ---- device models ----
+
+static uint16_t voltsToCounts(float v) {
+  float c = v / 3.3f * 4095.0f;
+  if (c < 0.0f) c = 0.0f;
+  if (c > 4095.0f) c = 4095.0f;
+  return (uint16_t)(c + 0.5f);
+}
+
+// Small deterministic ADC noise (+/- 3 counts)
+static uint16_t noisy(uint16_t counts) {
+  static uint32_t lcg = 12345;
+  lcg = lcg * 1103515245u + 12345u;
+  int n = (int)((lcg >> 16) % 7) - 3;
+  int v = (int)counts + n;
+  return (uint16_t)(v < 0 ? 0 : (v > 4095 ? 4095 : v));
+}
+
+// BH1750 ambient light sensor, continuous high-res mode
+class BH1750Model : public I2CDevice {
+ public:
+  bool onWrite(const uint8_t* data, size_t len) override {
+    for (size_t i = 0; i < len; ++i) {
+      uint8_t c = data[i];
+      if ((c & 0xF8) == 0x40) _mt = (uint8_t)((_mt & 0x1F) | ((c & 0x07) << 5));
+      else if ((c & 0xE0) == 0x60) _mt = (uint8_t)((_mt & 0xE0) | (c & 0x1F));
+    }
+    return true;
+  }
+
+  size_t onRead(uint8_t* data, size_t len) override {
+    float raw = environment().lux * 1.2f * ((float)_mt / 69.0f);
+    uint16_t r = raw > 65535.0f ? 65535 : (uint16_t)raw;
+    if (bh1750Raw() >= 0) r = (uint16_t)bh1750Raw();
+    uint8_t frame[2] = {(uint8_t)(r >> 8), (uint8_t)(r & 0xFF)};
+    size_t n = len < 2 ? len : 2;
+    memcpy(data, frame, n);
+    return n;
+  }
+
+ private:
+  uint8_t _mt = 69;
+};
+
+// BMP180 barometer with the datasheet's example calibration constants
+class BMP180Model : public I2CDevice {
+ public:
+  BMP180Model() {
+    const int16_t cal[11] = {408, -72, -14383, (int16_t)32741, (int16_t)32757, 23153, 6190, 4, -32768, -8711, 2868};
+    for (int i = 0; i < 11; ++i) {
+      _reg[0xAA + 2 * i] = (uint8_t)((uint16_t)cal[i] >> 8);
+      _reg[0xAB + 2 * i] = (uint8_t)((uint16_t)cal[i] & 0xFF);
+    }
+    _reg[0xD0] = 0x55;
+  }
+
+  bool onWrite(const uint8_t* data, size_t len) override {
+    if (len == 0) return true;
+    _ptr = data[0];
+    for (size_t i = 1; i < len; ++i) {
+      uint8_t r = (uint8_t)(_ptr + i - 1);
+      _reg[r] = data[i];
+      if (r == 0xF4) _convert(data[i]);
+    }
+    return true;
+  }
+
+  size_t onRead(uint8_t* data, size_t len) override {
+    for (size_t i = 0; i < len; ++i) data[i] = _reg[(uint8_t)(_ptr + i)];
+    return len;
+  }
+
+ private:
+  uint8_t _reg[256] = {};
+  uint8_t _ptr = 0;
+  int32_t _b5 = 0;
+
+  static constexpr int32_t AC1 = 408, AC2 = -72, AC3 = -14383, B1 = 6190, B2 = 4, MC = -8711, MD = 2868;
+  static constexpr uint32_t AC4 = 32741;
+  static constexpr int32_t AC5 = 32757, AC6 = 23153;
+
+  static int32_t b5For(int32_t ut) {
+    int32_t x1 = (ut - AC6) * AC5 >> 15;
+    int32_t x2 = (MC * 2048) / (x1 + MD);
+    return x1 + x2;
+  }
+
+  static int32_t pressureFor(int32_t up, int32_t b5, uint8_t oss) {
+    int32_t b6 = b5 - 4000;
+    int32_t x1 = (B2 * ((b6 * b6) >> 12)) >> 11;
+    int32_t x2 = (AC2 * b6) >> 11;
+    int32_t x3 = x1 + x2;
+    int32_t b3 = ((((int32_t)AC1 * 4 + x3) << oss) + 2) / 4;
+    x1 = (AC3 * b6) >> 13;
+    x2 = (B1 * ((b6 * b6) >> 12)) >> 16;
+    x3 = ((x1 + x2) + 2) >> 2;
+    uint32_t b4 = (AC4 * (uint32_t)(x3 + 32768)) >> 15;
+    uint32_t b7 = ((uint32_t)up - b3) * (uint32_t)(50000UL >> oss);
+    int32_t p = (b7 < 0x80000000) ? (int32_t)((b7 * 2) / b4) : (int32_t)((b7 / b4) * 2);
+    x1 = (p >> 8) * (p >> 8);
+    x1 = (x1 * 3038) >> 16;
+    x2 = (-7357 * p) >> 16;
+    return p + ((x1 + x2 + 3791) >> 4);
+  }
+
+  void _convert(uint8_t cmd) {
+    const Environment& env = environment();
+    if (cmd == 0x2E) {
+      // Smallest UT whose compensated temperature reaches the target
+      int32_t target = (int32_t)lroundf(env.temperatureC * 10.0f);
+      int32_t lo = 0, hi = 65535;
+      while (lo < hi) {
+        int32_t mid = (lo + hi) / 2;
+        if (((b5For(mid) + 8) >> 4) < target) lo = mid + 1;
+        else hi = mid;
+      }
+      _b5 = b5For(lo);
+      _reg[0xF6] = (uint8_t)(lo >> 8);
+      _reg[0xF7] = (uint8_t)(lo & 0xFF);
+    } else if ((cmd & 0x3F) == 0x34) {
+      uint8_t oss = (uint8_t)(cmd >> 6);
+      int32_t target = (int32_t)lroundf(env.pressureHpa * 100.0f);
+      int32_t lo = 0, hi = (1 << (16 + oss)) - 1;
+      while (lo < hi) {
+        int32_t mid = (lo + hi) / 2;
+        if (pressureFor(mid, _b5, oss) < target) lo = mid + 1;
+        else hi = mid;
+      }
+      uint32_t raw = (uint32_t)lo << (8 - oss);
+      _reg[0xF6] = (uint8_t)(raw >> 16);
+      _reg[0xF7] = (uint8_t)(raw >> 8);
+      _reg[0xF8] = (uint8_t)(raw & 0xFF);
+    }
+  }
+};
+
+// DS3231 RTC; keeps time relative to the simulator clock
+class DS3231Model : public I2CDevice {
+ public:
+  DS3231Model() { _setEpoch((int64_t)time(nullptr)); }
+
+  bool onWrite(const uint8_t* data, size_t len) override {
+    if (len == 0) return true;
+    _ptr = data[0];
+    if (len > 1 && _ptr == 0x00) {
+      uint8_t r[7] = {};
+      _snapshot(r);
+      for (size_t i = 1; i < len && i <= 7; ++i) r[i - 1] = data[i];
+      struct tm t = {};
+      t.tm_sec = bcd(r[0] & 0x7F);
+      t.tm_min = bcd(r[1]);
+      t.tm_hour = bcd(r[2] & 0x3F);
+      t.tm_mday = bcd(r[4]);
+      t.tm_mon = bcd(r[5] & 0x1F) - 1;
+      t.tm_year = bcd(r[6]) + 100;
+      _setEpoch((int64_t)timegm(&t));
+    } else {
+      for (size_t i = 1; i < len; ++i) _reg[(uint8_t)(_ptr + i - 1)] = data[i];
+    }
+    return true;
+  }
+
+  size_t onRead(uint8_t* data, size_t len) override {
+    _snapshot(_reg);
+    _reg[0x11] = (uint8_t)(int8_t)lroundf(environment().temperatureC);
+    for (size_t i = 0; i < len; ++i) data[i] = _reg[(uint8_t)(_ptr + i) % sizeof(_reg)];
+    return len;
+  }
+
+ private:
+  uint8_t _reg[0x13] = {};
+  uint8_t _ptr = 0;
+  int64_t _epoch = 0;
+  uint64_t _setAtUs = 0;
+
+  static uint8_t bcd(uint8_t v) { return (uint8_t)((v >> 4) * 10 + (v & 0x0F)); }
+  static uint8_t tobcd(int v) { return (uint8_t)(((v / 10) << 4) | (v % 10)); }
+
+  void _setEpoch(int64_t e) {
+    _epoch = e;
+    _setAtUs = nowMicros();
+  }
+
+  void _snapshot(uint8_t* r) {
+    time_t now = (time_t)(_epoch + (int64_t)((nowMicros() - _setAtUs) / 1000000ULL));
+    struct tm t;
+    gmtime_r(&now, &t);
+    r[0] = tobcd(t.tm_sec);
+    r[1] = tobcd(t.tm_min);
+    r[2] = tobcd(t.tm_hour);
+    r[3] = tobcd(t.tm_wday + 1);
+    r[4] = tobcd(t.tm_mday);
+    r[5] = tobcd(t.tm_mon + 1);
+    r[6] = tobcd(t.tm_year % 100);
+  }
+};
+
+void installDefaultBoard(const BoardPins& pins) {
+  static BH1750Model bh1750;
+  static BMP180Model bmp180;
+  static DS3231Model ds3231;
+  attachI2C(0x5C, &bh1750);
+  attachI2C(0x77, &bmp180);
+  attachI2C(0x68, &ds3231);
+
+  setAnalogSource(pins.mq135, [](uint64_t) { return noisy(voltsToCounts(environment().mq135Volts)); });
+  setAnalogSource(pins.uv, [](uint64_t) { return noisy(voltsToCounts(environment().uvIndex / 10.0f)); });
+  // Board divider halves the cell voltage; the charger lifts it by its I*R
+  setAnalogSource(pins.battery, [](uint64_t) {
+    const Environment& env = environment();
+    return noisy(voltsToCounts((env.batteryVolts + (env.charging ? 0.05f : 0.0f)) / 2.0f));
+  });
+  setDigitalLevel(pins.charger, environment().charging ? HIGH : LOW);
+}
+
+}  // namespace sim
+
+// ---- Arduino GPIO / ADC entry points ----
+
+static uint8_t gAdcBits = 12;
+
+extern "C" {
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  sim::Pin& p = sim::gPins[pin];
+  p.mode = mode;
+  if (mode == INPUT_PULLUP && p.level == LOW && !p.analog) p.level = HIGH;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  sim::Pin& p = sim::gPins[pin];
+  // Clocking SCL while SDA is stuck frees the bus after a few pulses
+  if ((int)pin == sim::gScl && sim::gI2CStuck && p.level == LOW && val == HIGH && ++sim::gSclPulses >= 3) {
+    sim::gI2CStuck = false;
+  }
+  p.level = val ? HIGH : LOW;
+}
+
+int digitalRead(uint8_t pin) {
+  if ((int)pin == sim::gSda) return sim::gI2CStuck ? LOW : HIGH;
+  return sim::gPins[pin].level;
+}
+
+uint16_t analogRead(uint8_t pin) {
+  auto& src = sim::gPins[pin].analog;
+  uint16_t v = src ? src(sim::nowMicros()) : 0;
+  return (uint16_t)(gAdcBits >= 12 ? v << (gAdcBits - 12) : v >> (12 - gAdcBits));
+}
+
+uint32_t analogReadMilliVolts(uint8_t pin) {
+  auto& src = sim::gPins[pin].analog;
+  uint16_t v = src ? src(sim::nowMicros()) : 0;
+  return (uint32_t)v * 3300u / 4095u;
+}
+
+void analogReadResolution(uint8_t bits) { gAdcBits = bits; }
+void analogSetPinAttenuation(uint8_t pin, adc_attenuation_t attenuation) {
+  (void)pin;
+  (void)attenuation;
+}
+
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode) {
+  (void)mode;
+  sim::gPins[pin].isr = isr;
+}
+
+void detachInterrupt(uint8_t pin) { sim::gPins[pin].isr = nullptr; }
+
+}  // extern "C"
@@ -0,0 +1,72 @@
+// DHT22 driver replacement: the real library bit-bangs the one-wire protocol,
+// which cannot run here. Same class and API (DHT.h), values come from the
+// simulated room and are quantised into a genuine 5-byte DHT22 frame.
+#include <DHT.h>
+#include <sim.h>
+
+DHT::DHT(uint8_t pin, uint8_t type, uint8_t count) : _pin(pin), _type(type) {
+  (void)count;
+  _lastreadtime = 0;
+  _maxcycles = 0;
+  _lastresult = false;
+  pullTime = 55;
+  memset(data, 0, sizeof(data));
+}
+
+void DHT::begin(uint8_t usec) {
+  pullTime = usec;
+  _lastreadtime = millis() - 2000;
+}
+
+bool DHT::read(bool force) {
+  uint32_t now = millis();
+  // The sensor only converts every 2 s; the real driver returns the old frame
+  if (!force && (now - _lastreadtime) < 2000) return _lastresult;
+  _lastreadtime = now;
+
+  // One-wire transfer time: ~4 ms per frame
+  delayMicroseconds(4000);
+
+  if (const uint8_t* frame = sim::dhtFrame()) {
+    memcpy(data, frame, 5);
+    _lastresult = (uint8_t)(data[0] + data[1] + data[2] + data[3]) == data[4];
+    return _lastresult;
+  }
+
+  const sim::Environment& env = sim::environment();
+  uint16_t h = (uint16_t)lroundf(env.humidityPct * 10.0f);
+  int16_t t = (int16_t)lroundf(env.temperatureC * 10.0f);
+  uint16_t tw = (uint16_t)(t < 0 ? (0x8000 | (uint16_t)(-t)) : (uint16_t)t);
+  data[0] = (uint8_t)(h >> 8);
+  data[1] = (uint8_t)(h & 0xFF);
+  data[2] = (uint8_t)(tw >> 8);
+  data[3] = (uint8_t)(tw & 0xFF);
+  data[4] = (uint8_t)(data[0] + data[1] + data[2] + data[3]);
+  _lastresult = true;
+  return true;
+}
+
+float DHT::readTemperature(bool S, bool force) {
+  if (!read(force)) return NAN;
+  float f = (float)(((uint16_t)(data[2] & 0x7F)) << 8 | data[3]) * 0.1f;
+  if (data[2] & 0x80) f = -f;
+  return S ? convertCtoF(f) : f;
+}
+
+float DHT::readHumidity(bool force) {
+  if (!read(force)) return NAN;
+  return (float)(((uint16_t)data[0]) << 8 | data[1]) * 0.1f;
+}
+
+float DHT::convertCtoF(float c) { return c * 1.8f + 32.0f; }
+float DHT::convertFtoC(float f) { return (f - 32.0f) * 0.55555f; }
+
+float DHT::computeHeatIndex(bool isFahrenheit) {
+  return computeHeatIndex(readTemperature(isFahrenheit), readHumidity(), isFahrenheit);
+}
+
+float DHT::computeHeatIndex(float temperature, float percentHumidity, bool isFahrenheit) {
+  float t = isFahrenheit ? temperature : convertCtoF(temperature);
+  float hi = 0.5f * (t + 61.0f + ((t - 68.0f) * 1.2f) + (percentHumidity * 0.094f));
+  return isFahrenheit ? hi : convertFtoC(hi);
+}
@@ -0,0 +1,52 @@
+#include <TFT_eSPI.h>
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h) : _w(w), _h(h) { memset(_fb, 0, sizeof(_fb)); }
+
+void TFT_eSPI::begin() { fillScreen(0); }
+
+void TFT_eSPI::setRotation(uint8_t r) {
+  _rotation = r & 3;
+  if (_rotation & 1) {
+    if (_w < _h) std::swap(_w, _h);
+  } else if (_w > _h) {
+    std::swap(_w, _h);
+  }
+}
+
+void TFT_eSPI::setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h) {
+  _wx = x;
+  _wy = y;
+  _ww = w;
+  _wh = h;
+  _cursor = 0;
+  ++_flushes;
+}
+
+void TFT_eSPI::_put(uint16_t panelPixel) {
+  if (_ww <= 0) return;
+  int32_t x = _wx + (int32_t)(_cursor % (uint32_t)_ww);
+  int32_t y = _wy + (int32_t)(_cursor / (uint32_t)_ww);
+  ++_cursor;
+  if (x < 0 || y < 0 || x >= _w || y >= _h || y * _w + x >= kMaxPixels) return;
+  _fb[y * _w + x] = panelPixel;
+}
+
+void TFT_eSPI::pushColors(uint16_t* data, uint32_t len, bool swap) {
+  for (uint32_t i = 0; i < len; ++i) {
+    uint16_t c = data[i];
+    _put(swap ? (uint16_t)((c << 8) | (c >> 8)) : c);
+  }
+  _pushed += len;
+}
+
+void TFT_eSPI::pushPixels(const void* data, uint32_t len) {
+  const uint16_t* p = static_cast<const uint16_t*>(data);
+  for (uint32_t i = 0; i < len; ++i) _put(p[i]);
+  _pushed += len;
+}
+
+void TFT_eSPI::fillScreen(uint32_t color) {
+  uint16_t c = (uint16_t)color;
+  uint16_t panel = (uint16_t)((c << 8) | (c >> 8));
+  for (int i = 0; i < kMaxPixels; ++i) _fb[i] = panel;
+}
@@ -0,0 +1,197 @@
+// LVGL timer scheduling (lv_timer.c): runs the same timers through
+// lv_timer_handler once walking the list and once from the due time heap of
+// LV_TIMER_HEAP, one handler call per virtual millisecond.
+//
+//   auralink_timerbench [--check] [--seconds N]
+//
+// With no action it prints the host time of one handler call both ways for
+// 10 to 1000 timers with periods of 5 ms to 1 s. --check instead drives a
+// random mix of timers, some of 1 ms or with a few repeats, pausing,
+// resuming, re-timing and deleting them between calls and from their
+// callbacks, and exits 1 on the first call where the two ways run a
+// different set of timers or return a different time until the next one.
+// Due timers may run in a different order within a call. Timers with a
+// period of 0 are left out: the list walk runs them again whenever a timer
+// is created or deleted during the call, the heap only once.
+#include <Arduino.h>
+#include <lvgl.h>
+#include <sim.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "memory_tiers.h"
+
+namespace {
+
+constexpr uint32_t kMaxTimers = 1024;
+
+std::vector<uint32_t> gRan;  // ids of the timers run by the current call
+uint32_t gRuns[kMaxTimers];  // calls per timer id over the whole run
+
+uint32_t idOf(lv_timer_t* t) { return (uint32_t)(uintptr_t)t->user_data; }
+
+// Only acts on itself, so what it does doesn't depend on the order timers run in
+void checkCb(lv_timer_t* t) {
+  uint32_t id = idOf(t);
+  gRan.push_back(id);
+  uint32_t n = ++gRuns[id];
+  uint32_t h = (id * 2654435761u) ^ (n * 40503u);
+  if (h % 29 == 0) {
+    lv_timer_set_period(t, 1 + h % 90);
+  } else if (h % 31 == 0) {
+    lv_timer_reset(t);
+  } else if (h % 97 == 0) {
+    lv_timer_del(t);
+  }
+}
+
+void benchCb(lv_timer_t* t) { gRuns[idOf(t) % kMaxTimers]++; }
+
+void deleteAll() {
+  while (lv_timer_t* t = lv_timer_get_next(nullptr)) lv_timer_del(t);
+}
+
+// What one run produced, call by call
+struct Trace {
+  std::vector<std::vector<uint32_t>> ran;
+  std::vector<uint32_t> tillNext;
+};
+
+lv_timer_t* findTimer(uint32_t id) {
+  for (lv_timer_t* t = lv_timer_get_next(nullptr); t; t = lv_timer_get_next(t)) {
+    if (idOf(t) == id) return t;
+  }
+  return nullptr;
+}
+
+Trace checkRun(bool heap, uint32_t seed, uint32_t calls) {
+  lv_timer_enable_heap(heap);
+  std::mt19937 rng(seed);
+  std::fill(std::begin(gRuns), std::end(gRuns), 0);
+  uint32_t nextId = 0;
+  auto create = [&]() {
+    uint32_t period = rng() % 4 == 0 ? 1 + rng() % 2 : 1 + rng() % 200;
+    lv_timer_t* t = lv_timer_create(checkCb, period, (void*)(uintptr_t)nextId++);
+    if (rng() % 8 == 0) lv_timer_set_repeat_count(t, 1 + rng() % 3);
+  };
+  for (int i = 0; i < 40; ++i) create();
+
+  Trace tr;
+  for (uint32_t c = 0; c < calls; ++c) {
+    // Changes from outside the timers, between calls
+    uint32_t r = rng() % 64;
+    if (r < 8 && nextId < kMaxTimers) {
+      create();
+    } else if (r < 24) {
+      if (lv_timer_t* t = findTimer(rng() % LV_MAX(1u, nextId))) {
+        switch (r % 8) {
+          case 0: lv_timer_pause(t); break;
+          case 1: lv_timer_resume(t); break;
+          case 2: lv_timer_set_period(t, 1 + rng() % 120); break;
+          case 3: lv_timer_ready(t); break;
+          case 4: lv_timer_reset(t); break;
+          case 5: lv_timer_set_repeat_count(t, rng() % 3); break;
+          case 6: lv_timer_del(t); break;
+          default: lv_timer_resume(t); break;
+        }
+      }
+    }
+
+    gRan.clear();
+    tr.tillNext.push_back(lv_timer_handler());
+    std::sort(gRan.begin(), gRan.end());
+    tr.ran.push_back(gRan);
+    delay(rng() % 4);  // 0 ms too: a second call in the same tick
+  }
+  deleteAll();
+  return tr;
+}
+
+bool check(uint32_t calls) {
+  for (uint32_t seed = 1; seed <= 20; ++seed) {
+    Trace list = checkRun(false, seed, calls);
+    Trace heap = checkRun(true, seed, calls);
+    for (uint32_t c = 0; c < calls; ++c) {
+      if (list.ran[c] != heap.ran[c] || list.tillNext[c] != heap.tillNext[c]) {
+        fprintf(stderr, "[TIMERBENCH] seed %u call %u: the heap ran %zu timers (next in %u ms), the list %zu (%u ms)\n",
+                seed, c, heap.ran[c].size(), heap.tillNext[c], list.ran[c].size(), list.tillNext[c]);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Host time of one lv_timer_handler call with `n` timers, in microseconds.
+// `bytes` gets what LVGL has allocated for the timers.
+double handlerUs(bool heap, uint32_t n, uint32_t seconds, size_t& bytes) {
+  auto lvBytes = []() { return memTierStats(MemTier::Internal).inUse + memTierStats(MemTier::Psram).inUse; };
+  lv_timer_enable_heap(heap);
+  size_t before = lvBytes();
+  std::mt19937 rng(n);
+  for (uint32_t i = 0; i < n; ++i) {
+    // Mostly slow timers (widgets, sensors), a few at the refresh period
+    uint32_t period = rng() % 8 == 0 ? LV_DISP_DEF_REFR_PERIOD : 5 + rng() % 996;
+    lv_timer_create(benchCb, period, (void*)(uintptr_t)i);
+  }
+  uint64_t cyc = 0;
+  uint32_t calls = seconds * 1000;
+  for (uint32_t c = 0; c < calls; ++c) {
+    uint32_t t0 = ESP.getCycleCount();
+    lv_timer_handler();
+    cyc += ESP.getCycleCount() - t0;
+    delay(1);
+  }
+  bytes = lvBytes() - before;
+  deleteAll();
+  return (double)cyc / ESP.getCpuFreqMHz() / calls;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  bool checkOnly = false;
+  uint32_t seconds = 5;
+  bool usage = false;
+  for (int i = 1; i < argc && !usage; ++i) {
+    if (!strcmp(argv[i], "--check")) {
+      checkOnly = true;
+    } else if (!strcmp(argv[i], "--seconds") && i + 1 < argc) {
+      seconds = (uint32_t)atoi(argv[++i]);
+      usage = seconds == 0;
+    } else {
+      usage = true;
+    }
+  }
+  if (usage) {
+    fprintf(stderr, "usage: %s [--check] [--seconds N]\n", argv[0]);
+    return 2;
+  }
+
+  sim::setClockMode(sim::ClockMode::Virtual);
+  lv_init();
+
+#if !LV_TIMER_HEAP
+  printf("[TIMERBENCH] LV_TIMER_HEAP is off; nothing to compare\n");
+  return 0;
+#endif
+
+  if (checkOnly) {
+    if (!check(seconds * 400)) return 1;
+    printf("[TIMERBENCH] 20 random schedules, %u calls each, run the same timers both ways\n", seconds * 400);
+    return 0;
+  }
+
+  printf("[TIMERBENCH] %7s %10s %10s %7s %8s   us per lv_timer_handler call on the host, heap memory\n", "timers",
+         "list", "heap", "gain", "+bytes");
+  for (uint32_t n : {10u, 30u, 100u, 300u, 1000u}) {
+    size_t listBytes = 0, heapBytes = 0;
+    double list = handlerUs(false, n, seconds, listBytes);
+    double heap = handlerUs(true, n, seconds, heapBytes);
+    printf("[TIMERBENCH] %7u %10.3f %10.3f %6.1fx %8d\n", n, list, heap, heap > 0 ? list / heap : 0,
+           (int)(heapBytes - listBytes));
+  }
+  return 0;
+}
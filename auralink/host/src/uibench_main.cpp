@@ -0,0 +1,84 @@
+// LVGL frame-time benchmark (ui_bench.h) on the headless display: the real
+// SquareLine screens, DisplayManager and draw pipeline, on the virtual clock
+// so the script's animations advance one frame per step regardless of how
+// long rendering takes. Times are host CPU time.
+//
+//   auralink_uibench [--frames] [--no-style-cache] [--no-mask-cache]
+//                    [--no-font-lut] [--no-glyph-cache] [--no-event-mask]
+//                    [--no-img-cache] [--no-label-diff] [--damage] [--repeat N]
+//
+// --frames prints one line per frame; --no-style-cache plays the script with
+// LV_OBJ_STYLE_CACHE switched off, --no-mask-cache with the rounded corner
+// masks (LV_RECT_MASK_CACHE_SIZE) computed on every draw, --no-font-lut with
+// every letter searched in the font (no LV_FONT_FMT_TXT_LUT), --no-glyph-cache
+// with every glyph decoded from the font (no LV_GLYPH_CACHE_SIZE),
+// --no-event-mask with every event scanning the object's callbacks (no
+// LV_OBJ_EVENT_MASK), --no-img-cache with zoomed images transformed on every
+// draw (no LV_IMG_TRANSFORM_CACHE_SIZE), --no-label-diff with the numeric
+// readouts redrawn whole on every change (numLabelEnableDiff); --damage
+// counts the flushed pixels that actually changed; --repeat runs the script N
+// times (the first run includes cold caches).
+#include <Arduino.h>
+#include <sim.h>
+#include <ui.h>
+
+#include "User_Setup.h"
+#include "display.h"
+#include "display_manager.h"
+#include "ui_bench.h"
+#include "update_ui.h"
+
+int main(int argc, char** argv) {
+  UiBench::Params p;
+  int repeat = 1;
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--frames")) {
+      p.perFrame = true;
+    } else if (!strcmp(argv[i], "--no-style-cache")) {
+      p.styleCache = false;
+    } else if (!strcmp(argv[i], "--no-mask-cache")) {
+      p.maskCache = false;
+    } else if (!strcmp(argv[i], "--no-font-lut")) {
+      p.fontLut = false;
+    } else if (!strcmp(argv[i], "--no-glyph-cache")) {
+      p.glyphCache = false;
+    } else if (!strcmp(argv[i], "--no-event-mask")) {
+      p.eventMask = false;
+    } else if (!strcmp(argv[i], "--no-img-cache")) {
+      p.imgCache = false;
+    } else if (!strcmp(argv[i], "--no-label-diff")) {
+      p.labelDiff = false;
+    } else if (!strcmp(argv[i], "--damage")) {
+      p.damage = true;
+    } else if (!strcmp(argv[i], "--repeat") && i + 1 < argc) {
+      repeat = atoi(argv[++i]);
+    } else {
+      fprintf(stderr,
+              "usage: %s [--frames] [--no-style-cache] [--no-mask-cache] [--no-font-lut] [--no-glyph-cache] "
+              "[--no-event-mask] [--no-img-cache] [--no-label-diff] [--damage] [--repeat N]\n",
+              argv[0]);
+      return 2;
+    }
+  }
+
+  sim::setClockMode(sim::ClockMode::Virtual);
+  sim::installDefaultBoard({MQ135_PIN, UV_SENSOR_PIN, BATTERY_LEVEL_PIN, BATTERY_CHARGER_PIN});
+
+  static Display display;
+  if (!display.begin(SCREEN_W, SCREEN_H, /*rotation*/ 2)) return 1;
+  ui_init();
+  installNumericLabels();
+  installTextPagers();
+
+  static lv_obj_t* screens[] = {ui_SensorData, ui_DailyQuote, ui_EmailSummary};
+  DisplayManager::Params dmp;
+  dmp.screen_y = UI_COMP_NOTIFICATIONBAR_HEIGHT;
+  static DisplayManager dm(TOUCH_LEFT_PIN, TOUCH_RIGHT_PIN, dmp);
+  dm.begin(screens, 3);
+
+  bool ok = true;
+  UiBench bench(p);
+  for (int i = 0; i < repeat; ++i) ok = bench.run(display.lvDisplay(), dm, Serial) && ok;
+  Serial.flush();
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,155 @@
+#include <WiFi.h>
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sim.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+WiFiClass WiFi;
+
+// ---- station ----
+
+wl_status_t WiFiClass::status() {
+  if (!_begun) return WL_IDLE_STATUS;
+  return sim::wifiUp() ? WL_CONNECTED : WL_DISCONNECTED;
+}
+
+bool WiFiClass::setHostname(const char* name) {
+  _hostname = name ? name : "";
+  return true;
+}
+
+wl_status_t WiFiClass::begin(const char* ssid, const char* pass) {
+  (void)ssid;
+  (void)pass;
+  _begun = true;
+  return status();
+}
+
+bool WiFiClass::disconnect(bool wifiOff, bool eraseAp) {
+  (void)eraseAp;
+  if (wifiOff) _begun = false;
+  return true;
+}
+
+IPAddress WiFiClass::localIP() { return status() == WL_CONNECTED ? IPAddress(127, 0, 0, 1) : IPAddress(); }
+int8_t WiFiClass::RSSI() { return status() == WL_CONNECTED ? -55 : 0; }
+String WiFiClass::macAddress() { return String("F6:E5:D4:C3:B2:A1"); }
+
+// ---- TCP client ----
+
+WiFiClient::~WiFiClient() { stop(); }
+
+int WiFiClient::connect(IPAddress ip, uint16_t port) { return connect(ip.toString().c_str(), port); }
+
+int WiFiClient::connect(const char* host, uint16_t port) {
+  stop();
+  if (!sim::wifiUp()) return 0;
+
+  struct addrinfo hints = {};
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  struct addrinfo* res = nullptr;
+  char service[8];
+  snprintf(service, sizeof(service), "%u", port);
+  if (getaddrinfo(host, service, &hints, &res) != 0 || !res) return 0;
+
+  int fd = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+  if (fd < 0) {
+    freeaddrinfo(res);
+    return 0;
+  }
+
+  // Bounded connect so an absent broker does not stall loop()
+  fcntl(fd, F_SETFL, O_NONBLOCK);
+  int rc = ::connect(fd, res->ai_addr, res->ai_addrlen);
+  freeaddrinfo(res);
+  if (rc < 0 && errno == EINPROGRESS) {
+    struct pollfd p = {fd, POLLOUT, 0};
+    int err = 0;
+    socklen_t len = sizeof(err);
+    if (poll(&p, 1, 1000) != 1 || getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) != 0 || err != 0) rc = -1;
+    else rc = 0;
+  }
+  if (rc < 0) {
+    ::close(fd);
+    return 0;
+  }
+  fcntl(fd, F_SETFL, 0);
+  int one = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  _fd = fd;
+  return 1;
+}
+
+size_t WiFiClient::write(const uint8_t* buf, size_t size) {
+  if (_fd < 0) return 0;
+  ssize_t n = ::send(_fd, buf, size, MSG_NOSIGNAL);
+  if (n < 0) {
+    stop();
+    return 0;
+  }
+  return (size_t)n;
+}
+
+int WiFiClient::available() {
+  if (_fd < 0) return 0;
+  int n = 0;
+  if (ioctl(_fd, FIONREAD, &n) < 0) return 0;
+  n += (_peeked >= 0 ? 1 : 0);
+  // Libraries busy-wait on available() against millis(); under the virtual
+  // clock time must still pass or a silent peer would hang them forever
+  if (n == 0 && sim::clockMode() == sim::ClockMode::Virtual) sim::advanceMicros(100);
+  return n;
+}
+
+int WiFiClient::read() {
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+int WiFiClient::read(uint8_t* buf, size_t size) {
+  if (_fd < 0 || size == 0) return -1;
+  size_t off = 0;
+  if (_peeked >= 0) {
+    buf[off++] = (uint8_t)_peeked;
+    _peeked = -1;
+  }
+  if (off < size && available() > 0) {
+    ssize_t n = ::recv(_fd, buf + off, size - off, MSG_DONTWAIT);
+    if (n > 0) off += (size_t)n;
+  }
+  return off ? (int)off : -1;
+}
+
+int WiFiClient::peek() {
+  if (_peeked < 0) _peeked = read();
+  return _peeked;
+}
+
+void WiFiClient::stop() {
+  if (_fd >= 0) ::close(_fd);
+  _fd = -1;
+  _peeked = -1;
+}
+
+uint8_t WiFiClient::connected() {
+  if (_fd < 0) return 0;
+  if (!sim::wifiUp()) {
+    stop();
+    return 0;
+  }
+  char c;
+  ssize_t n = ::recv(_fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+  if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+    stop();
+    return 0;
+  }
+  return 1;
+}
@@ -0,0 +1,71 @@
+#include <Wire.h>
+#include <sim.h>
+
+TwoWire Wire(0);
+TwoWire Wire1(1);
+
+bool TwoWire::begin() { return begin(-1, -1, 0); }
+
+bool TwoWire::begin(int sda, int scl, uint32_t frequency) {
+  if (_bus == 0 && sda >= 0 && scl >= 0) sim::setI2CPins(sda, scl);
+  if (frequency) _clock = frequency;
+  _begun = true;
+  return true;
+}
+
+bool TwoWire::end() {
+  _begun = false;
+  return true;
+}
+
+bool TwoWire::setClock(uint32_t frequency) {
+  _clock = frequency;
+  return true;
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+  _txAddr = address;
+  _txLen = 0;
+  _inTx = true;
+}
+
+// Return codes follow the Arduino convention: 0 ok, 1 too long, 2 NACK on address, 4 other
+uint8_t TwoWire::endTransmission(bool sendStop) {
+  (void)sendStop;
+  if (!_inTx) return 4;
+  _inTx = false;
+  if (!_begun) return 4;
+  sim::I2CDevice* dev = sim::i2cDevice(_txAddr);
+  if (!dev) return 2;
+  // Bus time at the configured clock: address + payload, 9 bits per byte
+  delayMicroseconds((uint32_t)((_txLen + 1) * 9 * 1000000ULL / _clock));
+  return dev->onWrite(_txBuf, _txLen) ? 0 : 3;
+}
+
+size_t TwoWire::requestFrom(uint8_t address, size_t size, bool sendStop) {
+  (void)sendStop;
+  _rxLen = _rxIdx = 0;
+  if (!_begun) return 0;
+  if (size > sizeof(_rxBuf)) size = sizeof(_rxBuf);
+  sim::I2CDevice* dev = sim::i2cDevice(address);
+  if (!dev) return 0;
+  delayMicroseconds((uint32_t)((size + 1) * 9 * 1000000ULL / _clock));
+  _rxLen = dev->onRead(_rxBuf, size);
+  return _rxLen;
+}
+
+size_t TwoWire::write(uint8_t c) {
+  if (!_inTx || _txLen >= sizeof(_txBuf)) return 0;
+  _txBuf[_txLen++] = c;
+  return 1;
+}
+
+size_t TwoWire::write(const uint8_t* data, size_t len) {
+  size_t n = 0;
+  while (n < len && write(data[n])) ++n;
+  return n;
+}
+
+int TwoWire::available() { return (int)(_rxLen - _rxIdx); }
+int TwoWire::read() { return _rxIdx < _rxLen ? _rxBuf[_rxIdx++] : -1; }
+int TwoWire::peek() { return _rxIdx < _rxLen ? _rxBuf[_rxIdx] : -1; }
@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+"""Runs the host firmware against the stub broker and checks that a sensor
+report with the expected fields arrives.
+
+    tools/smoke_test.py path/to/auralink_host
+"""
+import json
+import os
+import subprocess
+import sys
+import threading
+
+sys.dont_write_bytecode = True  # keep the source tree clean under ctest
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import stub_broker  # noqa: E402
+
+EXPECTED = {"battery_percent", "temperature_c", "humidity_percent", "air_quality_aqi", "pressure_pa", "reason"}
+
+
+def main():
+    binary = sys.argv[1]
+    sock = stub_broker.listen(0)
+    port = sock.getsockname()[1]
+
+    reports = []
+    broker = threading.Thread(
+        target=stub_broker.serve,
+        args=(sock, lambda topic, payload: reports.append((topic, payload))),
+        daemon=True,
+    )
+    broker.start()
+
+    fw = subprocess.run([binary, "--seconds", "120", "--virtual-clock", "--broker", f"127.0.0.1:{port}"],
+                        stdout=subprocess.DEVNULL, timeout=120)
+    broker.join(timeout=5)
+
+    if fw.returncode != 0:
+        print(f"firmware exited with {fw.returncode}")
+        return 1
+    sensor = [json.loads(p) for t, p in reports if t == "auralink/sensor"]
+    if not sensor:
+        print(f"no sensor report received ({len(reports)} messages)")
+        return 1
+    missing = EXPECTED - sensor[0].keys()
+    if missing:
+        print(f"first report lacks {sorted(missing)}: {sensor[0]}")
+        return 1
+    print(f"{len(sensor)} sensor report(s), first: {sensor[0]}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+"""Minimal MQTT 3.1.1 broker stand-in for the host build.
+
+Accepts one client, acknowledges CONNECT/SUBSCRIBE/PINGREQ and prints every
+PUBLISH as "<topic> <payload>" on stdout. Enough for the firmware's
+MqttClient; not a real broker (no QoS > 0, no fan-out).
+
+    tools/stub_broker.py 1883 &
+    ./auralink_host --seconds 60 --virtual-clock --broker 127.0.0.1:1883
+"""
+import socket
+import sys
+
+
+def _read_exact(conn, n):
+    data = b""
+    while len(data) < n:
+        chunk = conn.recv(n - len(data))
+        if not chunk:
+            return None
+        data += chunk
+    return data
+
+
+def _read_length(conn):
+    value, mult = 0, 1
+    while True:
+        b = conn.recv(1)
+        if not b:
+            return None
+        value += (b[0] & 0x7F) * mult
+        mult *= 128
+        if not b[0] & 0x80:
+            return value
+
+
+def serve(sock, on_publish):
+    conn, _ = sock.accept()
+    with conn:
+        while True:
+            header = conn.recv(1)
+            if not header:
+                return
+            length = _read_length(conn)
+            if length is None:
+                return
+            body = _read_exact(conn, length) if length else b""
+            if body is None:
+                return
+            kind = header[0] >> 4
+            if kind == 1:  # CONNECT -> CONNACK
+                conn.sendall(b"\x20\x02\x00\x00")
+            elif kind == 8:  # SUBSCRIBE -> SUBACK (granted QoS 0)
+                conn.sendall(bytes([0x90, 3]) + body[:2] + b"\x00")
+            elif kind == 12:  # PINGREQ -> PINGRESP
+                conn.sendall(b"\xd0\x00")
+            elif kind == 3:  # PUBLISH (QoS 0)
+                tlen = body[0] << 8 | body[1]
+                on_publish(body[2:2 + tlen].decode(), body[2 + tlen:].decode(errors="replace"))
+            elif kind == 14:  # DISCONNECT
+                return
+
+
+def listen(port):
+    sock = socket.socket()
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.bind(("127.0.0.1", port))
+    sock.listen(1)
+    return sock
+
+
+if __name__ == "__main__":
+    port = int(sys.argv[1]) if len(sys.argv) > 1 else 1883
+    serve(listen(port), lambda topic, payload: print(topic, payload, flush=True))
@@ -0,0 +1,33 @@
+# ctest driver: record a trace with the host firmware, replay it twice and
+# require a clean decode and identical digests.
+#
+#   cmake -DHOST=... -DREPLAY=... -DWORK_DIR=... -P trace_roundtrip.cmake
+file(MAKE_DIRECTORY ${WORK_DIR})
+set(TRACE ${WORK_DIR}/roundtrip.trace)
+
+execute_process(
+  COMMAND ${HOST} --seconds 600 --virtual-clock --broker 127.0.0.1:1 --trace ${TRACE}
+  RESULT_VARIABLE rc OUTPUT_QUIET)
+if(NOT rc EQUAL 0)
+  message(FATAL_ERROR "recording run failed: ${rc}")
+endif()
+
+foreach(run a b)
+  execute_process(
+    COMMAND ${REPLAY} ${TRACE} --digest ${WORK_DIR}/digest_${run}.txt --every 30
+    RESULT_VARIABLE rc ERROR_VARIABLE summary)
+  if(NOT rc EQUAL 0)
+    message(FATAL_ERROR "replay failed: ${rc}\n${summary}")
+  endif()
+endforeach()
+message(STATUS "${summary}")
+
+if(NOT summary MATCHES " 0 bytes skipped")
+  message(FATAL_ERROR "trace did not decode cleanly")
+endif()
+execute_process(
+  COMMAND ${CMAKE_COMMAND} -E compare_files ${WORK_DIR}/digest_a.txt ${WORK_DIR}/digest_b.txt
+  RESULT_VARIABLE rc)
+if(NOT rc EQUAL 0)
+  message(FATAL_ERROR "replay is not deterministic")
+endif()
@@ -0,0 +1,217 @@
+#include "i2c_bus.h"
+
+#include "User_Setup.h"
+
+I2CBus i2cBus;
+
+// Devices this board may carry, with the fastest SCL each one is rated for
+static const struct {
+    const char* name;
+    uint8_t addr;
+    uint32_t maxClockHz;
+} kKnownDevices[] = {
+    {"BH1750", ILLUMINATION_SENSOR_ADDRESS, 400000},
+    {"BMP180", PRESSURE_SENSOR_ADDRESS, 400000},  // 3.4 MHz HS mode not used
+    {"DS3231", RTC_ADDRESS, 400000},
+    {"AT24C32", RTC_EEPROM_ADDRESS, 400000},      // EEPROM on most DS3231 modules
+    {"BME280", THB_SENSOR_ADDRESS, 400000},
+};
+
+I2CBus::I2CBus()
+    : I2CBus(Params{}) {}
+
+I2CBus::I2CBus(const Params& p)
+    : _p(p) {}
+
+bool I2CBus::begin(int sda, int scl, TwoWire* wire) {
+    _wire = wire;
+    _sda = sda;
+    _scl = scl;
+    _clockHz = _p.standardHz;  // probe at the conservative clock
+
+    pinMode(_sda, INPUT_PULLUP);
+    if (_sdaStuck()) recover();
+    _startWire();
+    _probe();
+
+    // Only switch to fast mode when every responder is known to handle it
+    uint8_t present = 0;
+    bool fast = true;
+    for (uint8_t i = 0; i < _devCount; ++i) {
+        if (!_dev[i].present) continue;
+        ++present;
+        if (_dev[i].maxClockHz < _p.fastHz) fast = false;
+    }
+    if (present && fast) {
+        _clockHz = _p.fastHz;
+        _wire->setClock(_clockHz);
+    }
+
+    Serial.printf("[I2C] Bus up at %lu Hz, %u device(s) present\n", (unsigned long)_clockHz, present);
+    _lastStatsAt = millis();
+    return present > 0;
+}
+
+void I2CBus::_startWire() {
+    _wire->begin(_sda, _scl);
+    _wire->setClock(_clockHz);
+    _wire->setTimeout(_p.timeoutMs);
+}
+
+void I2CBus::_probe() {
+    _devCount = 0;
+    for (uint8_t addr = 0x08; addr < 0x78 && _devCount < kMaxDevices; ++addr) {
+        _wire->beginTransmission(addr);
+        if (_wire->endTransmission() != 0) continue;
+
+        Device& d = _dev[_devCount++];
+        d = Device{};
+        d.addr = addr;
+        d.present = true;
+        d.name = "unknown";
+        d.maxClockHz = _p.standardHz;  // unknown parts stay at 100 kHz
+        for (const auto& k : kKnownDevices) {
+            if (k.addr == addr) {
+                d.name = k.name;
+                d.maxClockHz = k.maxClockHz;
+                break;
+            }
+        }
+        Serial.printf("[I2C] Found %s at 0x%02X\n", d.name, addr);
+    }
+
+    // Keep slots for expected devices that did not answer so their errors still show up
+    for (const auto& k : kKnownDevices) {
+        if (_find(k.addr) || _devCount >= kMaxDevices) continue;
+        Device& d = _dev[_devCount++];
+        d = Device{};
+        d.name = k.name;
+        d.addr = k.addr;
+        d.maxClockHz = k.maxClockHz;
+    }
+}
+
+bool I2CBus::_sdaStuck() const {
+    // Reads the pad level only; the pin stays routed to the I2C controller
+    return _sda >= 0 && digitalRead(_sda) == LOW;
+}
+
+bool I2CBus::recover() {
+    if (_sda < 0 || _scl < 0) return false;
+    ++_recoveries;
+    Serial.println("[I2C] Bus recovery: pulsing SCL to release SDA.");
+
+    if (_wire) _wire->end();
+
+    pinMode(_sda, INPUT_PULLUP);
+    pinMode(_scl, OUTPUT_OPEN_DRAIN);
+    digitalWrite(_scl, HIGH);
+    delayMicroseconds(5);
+
+    // A slave stuck mid-byte releases SDA after at most 9 clocks
+    for (uint8_t i = 0; i < 9 && digitalRead(_sda) == LOW; ++i) {
+        digitalWrite(_scl, LOW);
+        delayMicroseconds(5);
+        digitalWrite(_scl, HIGH);
+        delayMicroseconds(5);
+    }
+
+    // STOP condition: SDA rises while SCL is high
+    pinMode(_sda, OUTPUT_OPEN_DRAIN);
+    digitalWrite(_sda, LOW);
+    delayMicroseconds(5);
+    digitalWrite(_scl, HIGH);
+    delayMicroseconds(5);
+    digitalWrite(_sda, HIGH);
+    delayMicroseconds(5);
+
+    pinMode(_sda, INPUT_PULLUP);
+    pinMode(_scl, INPUT_PULLUP);
+    bool released = digitalRead(_sda) == HIGH;
+
+    if (_wire) _startWire();
+
+    Serial.printf("[I2C] Bus recovery %s\n", released ? "succeeded" : "failed (SDA still low)");
+    return released;
+}
+
+bool I2CBus::submit(uint8_t addr, Job job, void* ctx) {
+    if (!job || _queued >= kQueueLen) return false;
+    _queue[_queued++] = Pending{addr, job, ctx};
+    return true;
+}
+
+void I2CBus::service() {
+    if (!_wire) return;
+
+    for (uint8_t i = 0; i < _queued; ++i) _exec(_queue[i]);
+    _queued = 0;
+
+    if (_p.statsIntervalMs && millis() - _lastStatsAt >= _p.statsIntervalMs) {
+        _lastStatsAt = millis();
+        printStats();
+    }
+}
+
+bool I2CBus::run(uint8_t addr, Job job, void* ctx) {
+    if (!_wire || !job) return false;
+    return _exec(Pending{addr, job, ctx});
+}
+
+bool I2CBus::_exec(const Pending& t) {
+    Device* d = _find(t.addr);
+
+    uint32_t start = micros();
+    bool ok = t.job(t.ctx);
+    uint32_t dt = micros() - start;
+
+    if (!d) return ok;
+
+    d->transactions++;
+    d->lastLatencyUs = dt;
+    if (dt > d->maxLatencyUs) d->maxLatencyUs = dt;
+    d->avgLatencyUs = (d->transactions == 1) ? (float)dt : d->avgLatencyUs + 0.1f * ((float)dt - d->avgLatencyUs);
+
+    if (ok) {
+        d->consecutiveErrors = 0;
+        d->present = true;
+        return true;
+    }
+
+    d->errors++;
+    if (d->consecutiveErrors < 0xFF) d->consecutiveErrors++;
+
+    // Repeated failures with SDA held low means a slave is wedged mid-transfer;
+    // otherwise the device itself stopped answering
+    if (d->consecutiveErrors >= _p.recoverAfterErr) {
+        d->consecutiveErrors = 0;
+        if (_sdaStuck()) recover();
+        else d->present = false;
+    }
+    return false;
+}
+
+bool I2CBus::isPresent(uint8_t addr) const {
+    for (uint8_t i = 0; i < _devCount; ++i) {
+        if (_dev[i].addr == addr) return _dev[i].present;
+    }
+    return false;
+}
+
+I2CBus::Device* I2CBus::_find(uint8_t addr) {
+    for (uint8_t i = 0; i < _devCount; ++i) {
+        if (_dev[i].addr == addr) return &_dev[i];
+    }
+    return nullptr;
+}
+
+void I2CBus::printStats() const {
+    Serial.printf("[I2C] clock=%lu Hz recoveries=%lu\n", (unsigned long)_clockHz, (unsigned long)_recoveries);
+    for (uint8_t i = 0; i < _devCount; ++i) {
+        const Device& d = _dev[i];
+        Serial.printf("[I2C]   0x%02X %-8s %s tx=%lu err=%lu lat last/avg/max=%lu/%.0f/%lu us\n",
+                      d.addr, d.name, d.present ? "up  " : "down",
+                      (unsigned long)d.transactions, (unsigned long)d.errors,
+                      (unsigned long)d.lastLatencyUs, d.avgLatencyUs, (unsigned long)d.maxLatencyUs);
+    }
+}
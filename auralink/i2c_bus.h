@@ -0,0 +1,90 @@
+#pragma once
+#include <Arduino.h>
+#include <Wire.h>
+
+// Shared I2C bus. Probes the known devices at boot, runs at the fastest clock
+// every present device supports, executes queued driver transactions
+// back-to-back and recovers a bus that is stuck with SDA held low.
+class I2CBus {
+public:
+  struct Params {
+    uint32_t standardHz      = 100000;
+    uint32_t fastHz          = 400000;
+    uint16_t timeoutMs       = 20;
+    uint8_t  recoverAfterErr = 3;      // consecutive device errors before a recovery attempt
+    uint32_t statsIntervalMs = 60000;  // 0: never print stats from service()
+  };
+
+  struct Device {
+    const char* name          = nullptr;
+    uint8_t     addr          = 0;
+    uint32_t    maxClockHz    = 0;
+    bool        present       = false;
+
+    uint32_t    transactions  = 0;
+    uint32_t    errors        = 0;
+    uint8_t     consecutiveErrors = 0;
+    uint32_t    lastLatencyUs = 0;
+    uint32_t    maxLatencyUs  = 0;
+    float       avgLatencyUs  = 0.0f;  // exponential moving average
+  };
+
+  // One driver transaction; return false if the device did not answer.
+  using Job = bool(*)(void* ctx);
+
+  I2CBus();
+  I2CBus(const Params& p);
+  ~I2CBus() = default;
+
+  bool begin(int sda, int scl, TwoWire* wire = &Wire);
+
+  // Queue a transaction; executed by the next service() call
+  bool submit(uint8_t addr, Job job, void* ctx = nullptr);
+  // Run all queued transactions back-to-back
+  void service();
+  // Run one transaction immediately with the same accounting
+  bool run(uint8_t addr, Job job, void* ctx = nullptr);
+
+  // Clock SDA free (up to 9 SCL pulses + STOP) and restart the controller
+  bool recover();
+
+  bool      isPresent(uint8_t addr) const;
+  uint32_t  clockHz()     const { return _clockHz; }
+  uint32_t  recoveries()  const { return _recoveries; }
+  uint8_t   deviceCount() const { return _devCount; }
+  const Device& device(uint8_t i) const { return _dev[i]; }
+  TwoWire*  wire()        const { return _wire; }
+
+  void printStats() const;
+
+private:
+  static constexpr uint8_t kMaxDevices = 12;
+  static constexpr uint8_t kQueueLen   = 8;
+
+  struct Pending {
+    uint8_t addr;
+    Job     job;
+    void*   ctx;
+  };
+
+  Params   _p;
+  TwoWire* _wire = nullptr;
+  int      _sda = -1, _scl = -1;
+  uint32_t _clockHz = 0;
+  uint32_t _recoveries = 0;
+  uint32_t _lastStatsAt = 0;
+
+  Device   _dev[kMaxDevices];
+  uint8_t  _devCount = 0;
+
+  Pending  _queue[kQueueLen];
+  uint8_t  _queued = 0;
+
+  void    _startWire();
+  void    _probe();
+  bool    _sdaStuck() const;
+  Device* _find(uint8_t addr);
+  bool    _exec(const Pending& t);
+};
+
+extern I2CBus i2cBus;
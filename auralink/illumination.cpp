@@ -6,7 +6,10 @@
 
 #include "User_Setup.h"
 #include "danger.h"
+#include "memory_tiers.h"
+#include "num_label.h"
 #include "lv_functions.h"
+#include "trace.h"
 
 BH1750 bh1750;
 
@@ -42,24 +45,25 @@ void updateIlluminationUI(bool force) {
 
     // set background color/opacity safely
     ColorOpacity co = getDangerColorIllumination(lux_avg);
-    LV_SAFE_DO(ui_IlluminationContainer, {
-        lv_obj_set_style_bg_color(_o, co.color, LV_PART_MAIN | LV_STATE_DEFAULT);
-        lv_obj_set_style_bg_opa(_o, co.opacity, LV_PART_MAIN | LV_STATE_DEFAULT);
-    });
+    LV_SAFE_DO(ui_IlluminationContainer, { setDangerTile(_o, co); });
 
     // update label text safely
-    LV_SAFE_DO(ui_Illumination, { lv_label_set_text_fmt(_o, "%.2f", lux_avg); });
+    LV_SAFE_DO(ui_Illumination, { numLabelSetFloat(_o, lux_avg, 2); });
 
     Serial.printf("[ILLUMINATION]: imm=%.2f avg=%.2f\n", lux_imm, lux_avg);
 }
 
-Illumination::Illumination(size_t windowSize) : _window(windowSize) {
-    _buf = (_window > 0) ? new float[_window]
-                         : nullptr;
+// Lux spans decades, so thresholds are relative: 5 Hz while the light
+// changes by more than half per second, one sample every 5 s when steady
+static const AdaptiveSampler::Params ILLUMINATION_SAMPLING = {200, 5000, 0.5f, 0.1f, true};
+
+Illumination::Illumination(size_t windowSize) : _window(windowSize), _sampler("illumination", ILLUMINATION_SAMPLING) {
+    _buf = (_window > 0) ? (float*)memCalloc(MemTier::Psram, _window, sizeof(float)) : nullptr;
     reset();
 }
 
 bool Illumination::begin(uint8_t addr, TwoWire* bus) {
+    _addr = addr;
     _ok = bh1750.begin(BH1750::CONTINUOUS_HIGH_RES_MODE, addr, bus);
     if (_ok)
         delay(180);  // allow first conversion
@@ -69,21 +73,30 @@ bool Illumination::begin(uint8_t addr, TwoWire* bus) {
 }
 
 Illumination::~Illumination() {
-    delete[] _buf;
+    memFree(_buf);
     _buf = nullptr;
 }
 
-void Illumination::read() {
-    if (!_ok) return;
+bool Illumination::read() {
+    if (!_ok) return false;
+    uint32_t now = millis();
     // In continuous mode, data ready ~every 120–180ms; readLightLevel() is fine
     float lux = bh1750.readLightLevel();
-    if (lux >= 0.0f && isfinite(lux)) add(lux);
+    if (lux < 0.0f || !isfinite(lux)) {  // -1: no answer on the bus
+        _sampler.missed(now);
+        return false;
+    }
+    // High-res mode at the default MTreg: lux = register / 1.2
+    sensorTrace.bh1750(_addr, (uint16_t)lroundf(lux * 1.2f));
+    _last = lux;
+    // Samples taken at the slow rate would hold the average back
+    if (_sampler.update(lux, now)) reset();
+    add(lux);
+    return true;
 }
 
 float Illumination::readImmediate() const {
-    if (!_ok) return -1.0f;  // guard in case someone calls too early
-    float lux = bh1750.readLightLevel();
-    return (lux >= 0.0f && isfinite(lux)) ? lux : -1.0f;
+    return _ok ? _last : -1.0f;  // guard in case someone calls too early
 }
 
 float Illumination::average() const {
@@ -2,6 +2,8 @@
 #include <Arduino.h>
 #include <BH1750.h>
 
+#include "sampler.h"
+
 extern BH1750 bh1750;
 
 void updateIlluminationUI(bool force = false);
@@ -12,8 +14,12 @@ class Illumination {
     explicit Illumination(size_t windowSize);
     ~Illumination();
     bool begin(uint8_t addr, TwoWire* bus = &Wire);
-    void read();
+    bool read();
+    // Whether the adaptive sampling policy wants a new reading
+    bool due() const { return _sampler.due(millis()); }
+    const AdaptiveSampler& sampler() const { return _sampler; }
     void reset();
+    // Last sample taken by read() (no new bus transaction)
     float readImmediate() const;
 
     float average() const;
@@ -25,7 +31,10 @@ class Illumination {
     size_t _count = 0;   // how many valid samples in buffer
     double _sum = 0;   // running sum of current window
     uint8_t _pin;
+    uint8_t _addr = 0;
     bool     _ok = false;
+    float    _last = -1.0f;
+    AdaptiveSampler _sampler;
 
     void add(float v);
 };
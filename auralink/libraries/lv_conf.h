@@ -30,7 +30,8 @@
 #define LV_COLOR_DEPTH 16
 
 /*Swap the 2 bytes of RGB565 color. Useful if the display has an 8-bit interface (e.g. SPI)*/
-#define LV_COLOR_16_SWAP 0 
+/*AuraLink: the ST7735 takes big-endian RGB565 over SPI, so LVGL renders in panel order and the flush is a plain copy*/
+#define LV_COLOR_16_SWAP 1
 
 /*Enable features to draw on transparent background.
  *It's required if opa, and transform_* style properties are used.
@@ -49,7 +50,8 @@
  *=========================*/
 
 /*1: use custom malloc/free, 0: use the built-in `lv_mem_alloc()` and `lv_mem_free()`*/
-#define LV_MEM_CUSTOM 0
+/*AuraLink: 1, so LVGL shares the firmware's tiered heap (memory_tiers.h) instead of a fixed internal pool*/
+#define LV_MEM_CUSTOM 1
 #if LV_MEM_CUSTOM == 0
     /*Size of the memory available for `lv_mem_alloc()` in bytes (>= 2kB)*/
     #define LV_MEM_SIZE (48U * 1024U)          /*[bytes]*/
@@ -63,10 +65,22 @@
     #endif
 
 #else       /*LV_MEM_CUSTOM*/
-    #define LV_MEM_CUSTOM_INCLUDE <stdlib.h>   /*Header for the dynamic memory function*/
-    #define LV_MEM_CUSTOM_ALLOC   malloc
-    #define LV_MEM_CUSTOM_FREE    free
-    #define LV_MEM_CUSTOM_REALLOC realloc
+    #define LV_MEM_CUSTOM_INCLUDE <stddef.h>   /*Header for the dynamic memory function*/
+    #define LV_MEM_CUSTOM_ALLOC   lv_tier_alloc
+    #define LV_MEM_CUSTOM_FREE    lv_tier_free
+    #define LV_MEM_CUSTOM_REALLOC lv_tier_realloc
+
+    /*Implemented in the sketch (memory_tiers.cpp), which is not on LVGL's include path*/
+    #include <stddef.h>
+    #ifdef __cplusplus
+    extern "C" {
+    #endif
+    void * lv_tier_alloc(size_t size);
+    void lv_tier_free(void * ptr);
+    void * lv_tier_realloc(void * ptr, size_t size);
+    #ifdef __cplusplus
+    }
+    #endif
 #endif     /*LV_MEM_CUSTOM*/
 
 /*Number of the intermediate memory buffer used during rendering and other internal processing mechanisms.
@@ -83,9 +97,24 @@
 /*Default display refresh period. LVG will redraw changed areas with this period time*/
 #define LV_DISP_DEF_REFR_PERIOD 30      /*[ms]*/
 
+/*Join invalidated areas by cost, not only when they overlap. An area costs its pixels plus
+ *LV_DISP_INV_AREA_COST per flushed chunk. With a full area buffer a new area is joined into
+ *the cheapest one instead of redrawing the whole screen*/
+/*AuraLink: each chunk pays for an address window and a walk over the screen's objects*/
+#define LV_DISP_INV_AREA_MERGE 1
+#if LV_DISP_INV_AREA_MERGE
+    #define LV_DISP_INV_AREA_COST 128   /*[px]*/
+#endif
+
 /*Input device read period in milliseconds*/
 #define LV_INDEV_DEF_READ_PERIOD 30 //10 //30     /*[ms]*/ //Can't be less than display refresh-period otherwise Roller will lag behind finger-movement
 
+/*Keep the timers in a min-heap by due time. `lv_timer_handler` then only looks at the timers that are due
+ *and tells the time until the next one without walking the list. Due timers run in due time order.
+ *Timer periods must stay below 2^31 ms*/
+/*AuraLink: the main loop sleeps at most until the next timer is due*/
+#define LV_TIMER_HEAP 1
+
 /*Use a custom tick source that tells the elapsed time in milliseconds.
  *It removes the need to manually update the tick with `lv_tick_inc()`)*/
 #define LV_TICK_CUSTOM 1
@@ -121,8 +150,41 @@
     * radius * 4 bytes are used per circle (the most often used radiuses are saved)
     * 0: to disable caching */
     #define LV_CIRCLE_CACHE_SIZE 4
+
+    /* Set number of maximally cached rounded rectangle masks.
+    * The anti-aliased corner rows of backgrounds and borders are saved per size, radius and border width
+    * and reused when the same shape is drawn again in any color or position
+    * 0: to disable caching */
+    /*AuraLink: one entry per sensor tile size plus the battery outline*/
+    #define LV_RECT_MASK_CACHE_SIZE 8
 #endif /*LV_DRAW_COMPLEX*/
 
+/*Fill 16 bit colors with opacity two pixels per 32 bit word, each channel of both mixed in one multiplication.
+ *Gives the same pixels as the one pixel loop*/
+/*AuraLink: the sensor tiles are bg_opa fills over the black screen*/
+#define LV_DRAW_SW_BLEND_SWAR 1
+
+/*Keep the anti-aliased glyphs drawn by the software renderer as ready to blend A8 rasters, least recently used
+ *out first. Keyed by font, letter and text opacity, so a glyph is decoded once in any color or position.
+ *LV_GLYPH_CACHE_SIZE: [bytes] of rasters in the cache, 0 to disable it
+ *LV_GLYPH_CACHE_MAX_GLYPH: [bytes] larger glyphs are drawn from the font every time*/
+/*AuraLink: the labels redraw the same few dozen 8..14 px glyphs; 8 kB holds all of them*/
+#define LV_GLYPH_CACHE_SIZE (8U * 1024U)
+#if LV_GLYPH_CACHE_SIZE
+    #define LV_GLYPH_CACHE_MAX_GLYPH 512
+#endif
+
+/*Keep zoomed or rotated images in their final form: transformed and recolored RGB565A8 pixels, blended with
+ *the image's opacity on every draw. Keyed by image, zoom, angle, pivot and recolor, so a fade reuses the same entry.
+ *Images are cached when drawn the second time, least recently used out first. Needs LV_COLOR_DEPTH 16.
+ *LV_IMG_TRANSFORM_CACHE_SIZE: [bytes] of images in the cache, 0 to disable it
+ *LV_IMG_TRANSFORM_CACHE_MAX_IMG: [bytes] larger images are transformed on every draw*/
+/*AuraLink: the six SquareLine sensor icons are 32 px PNGs drawn zoomed; cached they take 8.5 kB*/
+#define LV_IMG_TRANSFORM_CACHE_SIZE (12U * 1024U)
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    #define LV_IMG_TRANSFORM_CACHE_MAX_IMG (4U * 1024U)
+#endif
+
 /**
  * "Simple layers" are used when a widget has `style_opa < 255` to buffer the widget into a layer
  * and blend it as an image with the given opacity.
@@ -298,6 +360,18 @@
 
 #define LV_USE_USER_DATA 1
 
+/*Cache the resolved style properties of objects per part and state*/
+/*AuraLink: a redraw resolves ~1700 properties per screen through the theme and local styles*/
+#define LV_OBJ_STYLE_CACHE 1
+#if LV_OBJ_STYLE_CACHE
+    #define LV_OBJ_STYLE_CACHE_SIZE 1024     /*Number of entries; a power of 2. An entry is 20 bytes on 32-bit targets*/
+#endif
+
+/*Keep a mask of the event codes each object has handlers for. Events the object has no handler for
+ *then skip its list of handlers*/
+/*AuraLink: every drawn object gets a dozen events per frame; LV_WATCH_DELETE and the SquareLine components add handlers*/
+#define LV_OBJ_EVENT_MASK 1
+
 /*Garbage Collector settings
  *Used if lvgl is bound to higher level language and the memory is managed by that language*/
 #define LV_ENABLE_GC 0
@@ -401,6 +475,11 @@
 /*Enables/disables support for compressed fonts.*/
 #define LV_USE_FONT_COMPRESSED 0
 
+/*Look up the glyph ids and kerning classes of code points 0..255 in a table per font (1 kB each, built on first use)
+ *instead of searching the cmaps and kerning tables for every letter. Other code points are still searched.*/
+/*AuraLink: the email summary and quote pages wrap hundreds of ASCII letters per relayout*/
+#define LV_FONT_FMT_TXT_LUT 1
+
 /*Enable subpixel rendering*/
 #define LV_USE_FONT_SUBPX 0
 #if LV_USE_FONT_SUBPX
@@ -680,7 +759,7 @@
  *----------*/
 
 /*1: Enable API to take snapshot for object*/
-#define LV_USE_SNAPSHOT 0
+#define LV_USE_SNAPSHOT 1
 
 /*1: Enable Monkey test*/
 #define LV_USE_MONKEY 0
@@ -80,9 +80,22 @@
 /*Default display refresh period. LVG will redraw changed areas with this period time*/
 #define LV_DISP_DEF_REFR_PERIOD 30      /*[ms]*/
 
+/*Join invalidated areas by cost, not only when they overlap. An area costs its pixels plus
+ *LV_DISP_INV_AREA_COST per flushed chunk. With a full area buffer a new area is joined into
+ *the cheapest one instead of redrawing the whole screen*/
+#define LV_DISP_INV_AREA_MERGE 0
+#if LV_DISP_INV_AREA_MERGE
+    #define LV_DISP_INV_AREA_COST 128   /*[px]*/
+#endif
+
 /*Input device read period in milliseconds*/
 #define LV_INDEV_DEF_READ_PERIOD 30     /*[ms]*/
 
+/*Keep the timers in a min-heap by due time. `lv_timer_handler` then only looks at the timers that are due
+ *and tells the time until the next one without walking the list. Due timers run in due time order.
+ *Timer periods must stay below 2^31 ms*/
+#define LV_TIMER_HEAP 0
+
 /*Use a custom tick source that tells the elapsed time in milliseconds.
  *It removes the need to manually update the tick with `lv_tick_inc()`)*/
 #define LV_TICK_CUSTOM 0
@@ -121,8 +134,37 @@
     * radius * 4 bytes are used per circle (the most often used radiuses are saved)
     * 0: to disable caching */
     #define LV_CIRCLE_CACHE_SIZE 4
+
+    /* Set number of maximally cached rounded rectangle masks.
+    * The anti-aliased corner rows of backgrounds and borders are saved per size, radius and border width
+    * and reused when the same shape is drawn again in any color or position
+    * 0: to disable caching */
+    #define LV_RECT_MASK_CACHE_SIZE 0
 #endif /*LV_DRAW_COMPLEX*/
 
+/*Fill 16 bit colors with opacity two pixels per 32 bit word, each channel of both mixed in one multiplication.
+ *Gives the same pixels as the one pixel loop*/
+#define LV_DRAW_SW_BLEND_SWAR 0
+
+/*Keep the anti-aliased glyphs drawn by the software renderer as ready to blend A8 rasters, least recently used
+ *out first. Keyed by font, letter and text opacity, so a glyph is decoded once in any color or position.
+ *LV_GLYPH_CACHE_SIZE: [bytes] of rasters in the cache, 0 to disable it
+ *LV_GLYPH_CACHE_MAX_GLYPH: [bytes] larger glyphs are drawn from the font every time*/
+#define LV_GLYPH_CACHE_SIZE 0
+#if LV_GLYPH_CACHE_SIZE
+    #define LV_GLYPH_CACHE_MAX_GLYPH 512
+#endif
+
+/*Keep zoomed or rotated images in their final form: transformed and recolored RGB565A8 pixels, blended with
+ *the image's opacity on every draw. Keyed by image, zoom, angle, pivot and recolor, so a fade reuses the same entry.
+ *Images are cached when drawn the second time, least recently used out first. Needs LV_COLOR_DEPTH 16.
+ *LV_IMG_TRANSFORM_CACHE_SIZE: [bytes] of images in the cache, 0 to disable it
+ *LV_IMG_TRANSFORM_CACHE_MAX_IMG: [bytes] larger images are transformed on every draw*/
+#define LV_IMG_TRANSFORM_CACHE_SIZE 0
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    #define LV_IMG_TRANSFORM_CACHE_MAX_IMG (4U * 1024U)
+#endif
+
 /**
  * "Simple layers" are used when a widget has `style_opa < 255` to buffer the widget into a layer
  * and blend it as an image with the given opacity.
@@ -306,6 +348,16 @@
 
 #define LV_USE_USER_DATA 1
 
+/*Cache the resolved style properties of objects per part and state*/
+#define LV_OBJ_STYLE_CACHE 0
+#if LV_OBJ_STYLE_CACHE
+    #define LV_OBJ_STYLE_CACHE_SIZE 256     /*Number of entries; a power of 2. An entry is 20 bytes on 32-bit targets*/
+#endif
+
+/*Keep a mask of the event codes each object has handlers for. Events the object has no handler for
+ *then skip its list of handlers*/
+#define LV_OBJ_EVENT_MASK 0
+
 /*Garbage Collector settings
  *Used if lvgl is bound to higher level language and the memory is managed by that language*/
 #define LV_ENABLE_GC 0
@@ -409,6 +461,10 @@
 /*Enables/disables support for compressed fonts.*/
 #define LV_USE_FONT_COMPRESSED 0
 
+/*Look up the glyph ids and kerning classes of code points 0..255 in a table per font (1 kB each, built on first use)
+ *instead of searching the cmaps and kerning tables for every letter. Other code points are still searched.*/
+#define LV_FONT_FMT_TXT_LUT 0
+
 /*Enable subpixel rendering*/
 #define LV_USE_FONT_SUBPX 0
 #if LV_USE_FONT_SUBPX
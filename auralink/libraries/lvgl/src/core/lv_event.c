@@ -29,12 +29,20 @@ typedef struct _lv_event_dsc_t {
 static lv_event_dsc_t * lv_obj_get_event_dsc(const lv_obj_t * obj, uint32_t id);
 static lv_res_t event_send_core(lv_event_t * e);
 static bool event_is_bubbled(lv_event_t * e);
+static void event_dsc_remove(lv_obj_t * obj, uint32_t id);
+#if LV_OBJ_EVENT_MASK
+    static void event_mask_add(lv_obj_t * obj, lv_event_code_t filter);
+    static bool event_mask_skip(lv_event_t * e, bool preprocess);
+#endif
 
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static lv_event_t * event_head;
+#if LV_OBJ_EVENT_MASK
+    static bool event_mask_en = true;
+#endif
 
 /**********************
  *      MACROS
@@ -173,6 +181,9 @@ struct _lv_event_dsc_t * lv_obj_add_event_cb(lv_obj_t * obj, lv_event_cb_t event
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].cb = event_cb;
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].filter = filter;
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].user_data = user_data;
+#if LV_OBJ_EVENT_MASK
+    event_mask_add(obj, filter);
+#endif
 
     return &obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1];
 }
@@ -185,14 +196,7 @@ bool lv_obj_remove_event_cb(lv_obj_t * obj, lv_event_cb_t event_cb)
     int32_t i = 0;
     for(i = 0; i < obj->spec_attr->event_dsc_cnt; i++) {
         if(event_cb == NULL || obj->spec_attr->event_dsc[i].cb == event_cb) {
-            /*Shift the remaining event handlers forward*/
-            for(; i < (obj->spec_attr->event_dsc_cnt - 1); i++) {
-                obj->spec_attr->event_dsc[i] = obj->spec_attr->event_dsc[i + 1];
-            }
-            obj->spec_attr->event_dsc_cnt--;
-            obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
-                                                       obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
-            LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            event_dsc_remove(obj, i);
             return true;
         }
     }
@@ -210,14 +214,7 @@ bool lv_obj_remove_event_cb_with_user_data(lv_obj_t * obj, lv_event_cb_t event_c
     for(i = 0; i < obj->spec_attr->event_dsc_cnt; i++) {
         if((event_cb == NULL || obj->spec_attr->event_dsc[i].cb == event_cb) &&
            obj->spec_attr->event_dsc[i].user_data == user_data) {
-            /*Shift the remaining event handlers forward*/
-            for(; i < (obj->spec_attr->event_dsc_cnt - 1); i++) {
-                obj->spec_attr->event_dsc[i] = obj->spec_attr->event_dsc[i + 1];
-            }
-            obj->spec_attr->event_dsc_cnt--;
-            obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
-                                                       obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
-            LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            event_dsc_remove(obj, i);
             return true;
         }
     }
@@ -235,14 +232,7 @@ bool lv_obj_remove_event_dsc(lv_obj_t * obj, struct _lv_event_dsc_t * event_dsc)
     int32_t i = 0;
     for(i = 0; i < obj->spec_attr->event_dsc_cnt; i++) {
         if(&obj->spec_attr->event_dsc[i] == event_dsc) {
-            /*Shift the remaining event handlers forward*/
-            for(; i < (obj->spec_attr->event_dsc_cnt - 1); i++) {
-                obj->spec_attr->event_dsc[i] = obj->spec_attr->event_dsc[i + 1];
-            }
-            obj->spec_attr->event_dsc_cnt--;
-            obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
-                                                       obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
-            LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            event_dsc_remove(obj, i);
             return true;
         }
     }
@@ -263,6 +253,15 @@ void * lv_obj_get_event_user_data(struct _lv_obj_t * obj, lv_event_cb_t event_cb
     return NULL;
 }
 
+void lv_obj_enable_event_mask(bool en)
+{
+#if LV_OBJ_EVENT_MASK
+    event_mask_en = en;
+#else
+    LV_UNUSED(en);
+#endif
+}
+
 lv_indev_t * lv_event_get_indev(lv_event_t * e)
 {
 
@@ -437,6 +436,9 @@ static lv_res_t event_send_core(lv_event_t * e)
 
     lv_res_t res = LV_RES_OK;
     lv_event_dsc_t * event_dsc = lv_obj_get_event_dsc(e->current_target, 0);
+#if LV_OBJ_EVENT_MASK
+    if(event_dsc && event_mask_skip(e, true)) event_dsc = NULL;
+#endif
 
     uint32_t i = 0;
     while(event_dsc && res == LV_RES_OK) {
@@ -458,6 +460,9 @@ static lv_res_t event_send_core(lv_event_t * e)
     res = lv_obj_event_base(NULL, e);
 
     event_dsc = res == LV_RES_INV ? NULL : lv_obj_get_event_dsc(e->current_target, 0);
+#if LV_OBJ_EVENT_MASK
+    if(event_dsc && event_mask_skip(e, false)) event_dsc = NULL;
+#endif
 
     i = 0;
     while(event_dsc && res == LV_RES_OK) {
@@ -484,6 +489,55 @@ static lv_res_t event_send_core(lv_event_t * e)
     return res;
 }
 
+/**
+ * Remove the `id`th event callback of an object
+ */
+static void event_dsc_remove(lv_obj_t * obj, uint32_t id)
+{
+    uint32_t i;
+    /*Shift the remaining event handlers forward*/
+    for(i = id; i < (uint32_t)(obj->spec_attr->event_dsc_cnt - 1); i++) {
+        obj->spec_attr->event_dsc[i] = obj->spec_attr->event_dsc[i + 1];
+    }
+    obj->spec_attr->event_dsc_cnt--;
+    obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
+                                               obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
+    LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+
+#if LV_OBJ_EVENT_MASK
+    /*Other callbacks might take the same code*/
+    obj->spec_attr->event_codes = 0;
+    obj->spec_attr->event_pre = 0;
+    for(i = 0; i < obj->spec_attr->event_dsc_cnt; i++) {
+        event_mask_add(obj, obj->spec_attr->event_dsc[i].filter);
+    }
+#endif
+}
+
+#if LV_OBJ_EVENT_MASK
+static void event_mask_add(lv_obj_t * obj, lv_event_code_t filter)
+{
+    if(filter & LV_EVENT_PREPROCESS) obj->spec_attr->event_pre = 1;
+    obj->spec_attr->event_codes |= (uint64_t)1 << ((filter & ~LV_EVENT_PREPROCESS) % 64);
+}
+
+/**
+ * Tell whether none of the callbacks of the current target can take the event
+ * @param e             pointer to the event being sent
+ * @param preprocess    true: for the preprocessing callbacks; false: for the others
+ * @return              true: the callbacks can be skipped
+ */
+static bool event_mask_skip(lv_event_t * e, bool preprocess)
+{
+    if(!event_mask_en) return false;
+
+    const _lv_obj_spec_attr_t * attr = e->current_target->spec_attr;
+    if(preprocess && !attr->event_pre) return true;
+    uint64_t bits = ((uint64_t)1 << (e->code % 64)) | ((uint64_t)1 << LV_EVENT_ALL);
+    return (attr->event_codes & bits) == 0;
+}
+#endif
+
 static bool event_is_bubbled(lv_event_t * e)
 {
     if(e->stop_bubbling) return false;
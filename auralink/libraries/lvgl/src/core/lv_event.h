@@ -272,6 +272,13 @@ bool lv_obj_remove_event_dsc(struct _lv_obj_t * obj, struct _lv_event_dsc_t * ev
  */
 void * lv_obj_get_event_user_data(struct _lv_obj_t * obj, lv_event_cb_t event_cb);
 
+/**
+ * Enable or disable skipping the event callbacks of objects that have none for the sent code
+ * (`LV_OBJ_EVENT_MASK`). Enabled by default. The same callbacks run either way.
+ * @param en        true: check the mask of codes first; false: always scan the callbacks
+ */
+void lv_obj_enable_event_mask(bool en);
+
 /**
  * Get the input device passed as parameter to indev related events.
  * @param e     pointer to an event
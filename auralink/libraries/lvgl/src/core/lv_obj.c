@@ -894,6 +894,11 @@ static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state)
     /*If there is no difference in styles there is nothing else to do*/
     if(cmp_res == _LV_STYLE_STATE_CMP_SAME) return;
 
+#if LV_OBJ_STYLE_CACHE
+    /*The children may inherit state dependent values and won't be refreshed on `DIFF_REDRAW`*/
+    _lv_obj_style_cache_invalidate(obj);
+#endif
+
     _lv_obj_style_transition_dsc_t * ts = lv_mem_buf_get(sizeof(_lv_obj_style_transition_dsc_t) * STYLE_TRANSITION_MAX);
     lv_memset_00(ts, sizeof(_lv_obj_style_transition_dsc_t) * STYLE_TRANSITION_MAX);
     uint32_t tsi = 0;
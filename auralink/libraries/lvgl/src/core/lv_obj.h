@@ -169,6 +169,10 @@ typedef struct {
     lv_dir_t scroll_dir : 4;                /**< The allowed scroll direction(s)*/
     uint8_t event_dsc_cnt : 6;              /**< Number of event callbacks stored in `event_dsc` array*/
     uint8_t layer_type : 2;    /**< Cache the layer type here. Element of @lv_intermediate_layer_type_t */
+#if LV_OBJ_EVENT_MASK
+    uint8_t event_pre : 1;     /**< Some callback in `event_dsc` is for preprocessing*/
+    uint64_t event_codes;      /**< Bit `code % 64` is set if some callback in `event_dsc` takes `code`*/
+#endif
 } _lv_obj_spec_attr_t;
 
 typedef struct _lv_obj_t {
@@ -190,6 +194,9 @@ typedef struct _lv_obj_t {
     uint16_t h_layout   : 1;
     uint16_t w_layout   : 1;
     uint16_t being_deleted   : 1;
+#if LV_OBJ_STYLE_CACHE
+    uint32_t style_gen;     /**< Entries of the resolved style cache are valid only with this generation*/
+#endif
 } lv_obj_t;
 
 
@@ -49,6 +49,10 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
     lv_memset_00(obj, s);
     obj->class_p = class_p;
     obj->parent = parent;
+#if LV_OBJ_STYLE_CACHE
+    /*A new generation, so entries left by a deleted object at the same address don't match*/
+    _lv_obj_style_cache_invalidate(obj);
+#endif
 
     /*Create a screen*/
     if(parent == NULL) {
@@ -27,6 +27,20 @@ typedef struct {
     lv_style_value_t end_value;
 } trans_t;
 
+#if LV_OBJ_STYLE_CACHE
+/*One resolved `lv_obj_get_style_prop` value. Valid while `gen` matches the object's `style_gen`
+ *and, for inherited properties, `epoch` matches `style_cache_epoch` too*/
+typedef struct {
+    const lv_obj_t * obj;
+    uint32_t gen;
+    lv_style_value_t value;
+    uint16_t prop;
+    lv_state_t state;
+    uint16_t epoch;
+    uint8_t part;   /*Part index: lv_part_t >> 16*/
+} style_cache_entry_t;
+#endif
+
 typedef enum {
     CACHE_ZERO = 0,
     CACHE_TRUE = 1,
@@ -54,12 +68,30 @@ static void trans_anim_ready_cb(lv_anim_t * a);
 static lv_layer_type_t calculate_layer_type(lv_obj_t * obj);
 static void fade_anim_cb(void * obj, int32_t v);
 static void fade_in_anim_ready(lv_anim_t * a);
+#if LV_OBJ_STYLE_CACHE
+static void style_cache_drop(lv_obj_t * obj, bool inherited);
+static void style_cache_clear(void);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static bool style_refr = true;
 
+#if LV_OBJ_STYLE_CACHE
+#if (LV_OBJ_STYLE_CACHE_SIZE & (LV_OBJ_STYLE_CACHE_SIZE - 1)) != 0
+    #error "LV_OBJ_STYLE_CACHE_SIZE must be a power of 2"
+#endif
+#if LV_OBJ_STYLE_CACHE_SIZE < 2
+    #error "LV_OBJ_STYLE_CACHE_SIZE must be at least 2"
+#endif
+static style_cache_entry_t style_cache[LV_OBJ_STYLE_CACHE_SIZE];
+static uint32_t style_cache_gen = 1;
+static uint16_t style_cache_epoch = 1;  /*Advances on any change an inherited value may depend on*/
+static bool style_cache_en = true;
+static lv_obj_style_cache_stat_t style_cache_stat;
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -148,10 +180,19 @@ void lv_obj_remove_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t
     if(deleted && prop != LV_STYLE_PROP_INV) {
         lv_obj_refresh_style(obj, part, prop);
     }
+#if LV_OBJ_STYLE_CACHE
+    else if(deleted) {
+        style_cache_drop(obj, true);
+    }
+#endif
 }
 
 void lv_obj_report_style_change(lv_style_t * style)
 {
+#if LV_OBJ_STYLE_CACHE
+    /*The users of the style won't be refreshed now but their cached values are stale already*/
+    if(!style_refr) style_cache_clear();
+#endif
     if(!style_refr) return;
     lv_disp_t * d = lv_disp_get_next(NULL);
 
@@ -168,6 +209,11 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+#if LV_OBJ_STYLE_CACHE
+    /*Even without a refresh the styles have changed. Children inherit only inheritable properties*/
+    style_cache_drop(obj, prop == LV_STYLE_PROP_ANY || lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT));
+#endif
+
     if(!style_refr) return;
 
     lv_obj_invalidate(obj);
@@ -220,10 +266,51 @@ void lv_obj_enable_style_refresh(bool en)
     style_refr = en;
 }
 
+#if LV_OBJ_STYLE_CACHE
+void lv_obj_enable_style_cache(bool en)
+{
+    style_cache_en = en;
+}
+
+void lv_obj_get_style_cache_stat(lv_obj_style_cache_stat_t * stat)
+{
+    *stat = style_cache_stat;
+}
+
+void _lv_obj_style_cache_invalidate(lv_obj_t * obj)
+{
+    style_cache_drop(obj, true);
+}
+#endif
+
 lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
 {
     lv_style_value_t value_act;
     bool inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT);
+
+#if LV_OBJ_STYLE_CACHE
+    style_cache_stat.lookups++;
+    style_cache_entry_t * e = NULL;
+    const lv_obj_t * obj_ori = obj;
+    uint8_t part_id = (uint8_t)(part >> 16);
+    /*Transitions read the styles with the transition styles skipped*/
+    if(style_cache_en && !obj->skip_trans) {
+        /*2-way sets: a miss moves the newer entry to the second way and takes the first*/
+        uint32_t h = ((uint32_t)(uintptr_t)obj ^ ((uint32_t)prop << 16) ^ ((uint32_t)part_id << 8) ^ obj->state) *
+                     2654435761u;
+        e = &style_cache[((h >> 16) & (LV_OBJ_STYLE_CACHE_SIZE / 2 - 1)) * 2];
+        uint32_t w;
+        for(w = 0; w < 2; w++) {
+            if(e[w].obj == obj && e[w].gen == obj->style_gen && e[w].prop == (uint16_t)prop && e[w].part == part_id &&
+               e[w].state == obj->state && (!inheritable || e[w].epoch == style_cache_epoch)) {
+                style_cache_stat.hits++;
+                return e[w].value;
+            }
+        }
+        e[1] = e[0];
+    }
+#endif
+
     lv_style_res_t found = LV_STYLE_RES_NOT_FOUND;
     while(obj) {
         found = get_prop_core(obj, part, prop, &value_act);
@@ -264,6 +351,18 @@ lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_
             value_act = lv_style_prop_get_default(prop);
         }
     }
+
+#if LV_OBJ_STYLE_CACHE
+    if(e) {
+        e->obj = obj_ori;
+        e->gen = obj_ori->style_gen;
+        e->value = value_act;
+        e->prop = (uint16_t)prop;
+        e->state = obj_ori->state;
+        e->epoch = style_cache_epoch;
+        e->part = part_id;
+    }
+#endif
     return value_act;
 }
 
@@ -746,6 +845,9 @@ static bool trans_del(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, tran
             _lv_ll_remove(&LV_GC_ROOT(_lv_obj_style_trans_ll), tr);
             lv_mem_free(tr);
             removed = true;
+#if LV_OBJ_STYLE_CACHE
+            style_cache_drop(obj, true);
+#endif
 
         }
         tr = tr_prev;
@@ -835,6 +937,9 @@ static void trans_anim_start_cb(lv_anim_t * a)
 
     _lv_obj_style_t * style_trans = get_trans_style(tr->obj, tr->selector);
     lv_style_set_prop(style_trans->style, tr->prop, tr->start_value);   /*Be sure `trans_style` has a valid value*/
+#if LV_OBJ_STYLE_CACHE
+    style_cache_drop(tr->obj, true);
+#endif
 
 }
 
@@ -865,6 +970,9 @@ static void trans_anim_ready_cb(lv_anim_t * a)
 
                 _lv_obj_style_t * obj_style = &obj->styles[i];
                 lv_style_remove_prop(obj_style->style, prop);
+#if LV_OBJ_STYLE_CACHE
+                style_cache_drop(obj, true);
+#endif
 
                 if(lv_style_is_empty(obj->styles[i].style)) {
                     lv_obj_remove_style(obj, obj_style->style, obj_style->selector);
@@ -897,4 +1005,32 @@ static void fade_in_anim_ready(lv_anim_t * a)
     lv_obj_remove_local_style_prop(a->var, LV_STYLE_OPA, 0);
 }
 
+#if LV_OBJ_STYLE_CACHE
+/**
+ * Make the cached values of an object stale by moving it to a new generation
+ * @param obj       pointer to an object
+ * @param inherited true: the values its children inherit may have changed too
+ */
+static void style_cache_drop(lv_obj_t * obj, bool inherited)
+{
+    obj->style_gen = style_cache_gen++;
+    if(style_cache_gen == 0) {
+        /*Wrapped: old entries could match again*/
+        style_cache_clear();
+        style_cache_gen = 1;
+    }
 
+    if(inherited) {
+        style_cache_epoch++;
+        if(style_cache_epoch == 0) {
+            style_cache_clear();
+            style_cache_epoch = 1;
+        }
+    }
+}
+
+static void style_cache_clear(void)
+{
+    lv_memset_00(style_cache, sizeof(style_cache));
+}
+#endif
@@ -43,6 +43,13 @@ typedef struct {
     uint32_t is_trans : 1;
 } _lv_obj_style_t;
 
+#if LV_OBJ_STYLE_CACHE
+typedef struct {
+    uint32_t lookups;   /*`lv_obj_get_style_prop` calls*/
+    uint32_t hits;      /*Of those, answered from the cache*/
+} lv_obj_style_cache_stat_t;
+#endif
+
 typedef struct {
     uint16_t time;
     uint16_t delay;
@@ -118,6 +125,29 @@ void lv_obj_refresh_style(struct _lv_obj_t * obj, lv_part_t part, lv_style_prop_
  */
 void lv_obj_enable_style_refresh(bool en);
 
+#if LV_OBJ_STYLE_CACHE
+/**
+ * Enable or disable the resolved style cache (`LV_OBJ_STYLE_CACHE`). It's enabled by default.
+ * Turning it off only makes every lookup scan the styles again, e.g. to measure the difference.
+ * @param en        true: look up through the cache; false: always scan the styles
+ */
+void lv_obj_enable_style_cache(bool en);
+
+/**
+ * Get the lookup and hit counters of the resolved style cache. They only ever grow (and wrap).
+ * @param stat      the counters are copied here
+ */
+void lv_obj_get_style_cache_stat(lv_obj_style_cache_stat_t * stat);
+
+/**
+ * Drop the cached style values of an object and the values inherited from it.
+ * Done by `lv_obj_refresh_style`, so needed only where an object's styles,
+ * state or parent change without a refresh.
+ * @param obj       pointer to an object
+ */
+void _lv_obj_style_cache_invalidate(struct _lv_obj_t * obj);
+#endif
+
 /**
  * Get the value of a style property. The current state of the object will be considered.
  * Inherited properties will be inherited.
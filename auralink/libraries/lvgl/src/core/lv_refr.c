@@ -26,6 +26,10 @@
 /*********************
  *      DEFINES
  *********************/
+#if LV_DISP_INV_AREA_MERGE
+    /*Number of row bands the invalidated areas are bucketed into when joining them*/
+    #define INV_AREA_BANDS 16
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -62,6 +66,10 @@ static void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
 static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h);
 static void draw_buf_flush(lv_disp_t * disp);
 static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
+#if LV_DISP_INV_AREA_MERGE
+    static uint32_t inv_area_cost(lv_disp_t * disp, const lv_area_t * area_p);
+    static void inv_area_join_cheapest(lv_disp_t * disp, const lv_area_t * area_p);
+#endif
 
 #if LV_USE_PERF_MONITOR
     static void perf_monitor_init(perf_monitor_t * perf_monitor);
@@ -251,12 +259,19 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
     /*Save the area*/
     if(disp->inv_p < LV_INV_BUF_SIZE) {
         lv_area_copy(&disp->inv_areas[disp->inv_p], &com_area);
+        disp->inv_p++;
+    }
+#if LV_DISP_INV_AREA_MERGE
+    else {   /*If no place for the area join it where it adds the least cost*/
+        inv_area_join_cheapest(disp, &com_area);
     }
+#else
     else {   /*If no place for the area add the screen*/
         disp->inv_p = 0;
         lv_area_copy(&disp->inv_areas[disp->inv_p], &scr_area);
+        disp->inv_p++;
     }
-    disp->inv_p++;
+#endif
     if(disp->refr_timer) lv_timer_resume(disp->refr_timer);
 }
 
@@ -472,6 +487,63 @@ uint32_t lv_refr_get_fps_avg(void)
  *   STATIC FUNCTIONS
  **********************/
 
+#if LV_DISP_INV_AREA_MERGE
+/**
+ * Join the areas which are cheaper to refresh together than one by one (see `inv_area_cost`).
+ * The areas are bucketed by the row band of their top edge, so an area is compared only with
+ * the areas starting in the bands a profitable join could reach. Repeated until nothing joins.
+ */
+static void lv_refr_join_area(void)
+{
+    uint32_t area_cnt = disp_refr->inv_p;
+    if(area_cnt < 2) return;
+
+    lv_coord_t band_h = (lv_disp_get_ver_res(disp_refr) + INV_AREA_BANDS - 1) / INV_AREA_BANDS;
+    if(band_h < 1) band_h = 1;
+
+    /*Order the areas by band with a counting sort*/
+    uint16_t band_start[INV_AREA_BANDS + 1];
+    uint16_t order[LV_INV_BUF_SIZE];
+    lv_memset_00(band_start, sizeof(band_start));
+    uint32_t i;
+    for(i = 0; i < area_cnt; i++) {
+        band_start[LV_CLAMP(0, disp_refr->inv_areas[i].y1 / band_h, INV_AREA_BANDS - 1) + 1]++;
+    }
+    for(i = 0; i < INV_AREA_BANDS; i++) band_start[i + 1] += band_start[i];
+    for(i = 0; i < area_cnt; i++) {
+        order[band_start[LV_CLAMP(0, disp_refr->inv_areas[i].y1 / band_h, INV_AREA_BANDS - 1)]++] = i;
+    }
+
+    bool joined;
+    do {
+        joined = false;
+        for(i = 0; i < area_cnt; i++) {
+            lv_area_t * join_in = &disp_refr->inv_areas[order[i]];
+            if(disp_refr->inv_area_joined[order[i]] != 0) continue;
+
+            uint32_t j;
+            for(j = i + 1; j < area_cnt; j++) {
+                lv_area_t * join_from = &disp_refr->inv_areas[order[j]];
+                if(disp_refr->inv_area_joined[order[j]] != 0) continue;
+
+                /*Spanning a gap of more rows than a chunk's cost pays for at this width can't
+                 *be cheaper. The areas after this one start in the same or lower bands*/
+                lv_coord_t reach = join_in->y2 + 1 + LV_DISP_INV_AREA_COST / lv_area_get_width(join_in);
+                if(join_from->y1 / band_h > reach / band_h) break;
+
+                lv_area_t joined_area;
+                _lv_area_join(&joined_area, join_in, join_from);
+                if(inv_area_cost(disp_refr, &joined_area) < inv_area_cost(disp_refr, join_in) +
+                   inv_area_cost(disp_refr, join_from)) {
+                    lv_area_copy(join_in, &joined_area);
+                    disp_refr->inv_area_joined[order[j]] = 1;
+                    joined = true;
+                }
+            }
+        }
+    } while(joined);
+}
+#else
 /**
  * Join the areas which has got common parts
  */
@@ -508,6 +580,51 @@ static void lv_refr_join_area(void)
         }
     }
 }
+#endif
+
+#if LV_DISP_INV_AREA_MERGE
+/**
+ * The cost of refreshing an area: its pixels plus `LV_DISP_INV_AREA_COST` for each chunk
+ * it's rendered and flushed in
+ * @param disp      the display of the area
+ * @param area_p    pointer to an area
+ * @return          the cost in pixels
+ */
+static uint32_t inv_area_cost(lv_disp_t * disp, const lv_area_t * area_p)
+{
+    uint32_t w = lv_area_get_width(area_p);
+    uint32_t h = lv_area_get_height(area_p);
+    uint32_t chunk_cnt = 1;
+    if(!disp->driver->full_refresh && !disp->driver->direct_mode) {
+        uint32_t max_row = disp->driver->draw_buf->size / w;
+        if(max_row == 0) max_row = 1;
+        chunk_cnt = (h + max_row - 1) / max_row;
+    }
+    return w * h + chunk_cnt * LV_DISP_INV_AREA_COST;
+}
+
+/**
+ * Join an area into the saved area it makes the least more expensive to refresh
+ * @param disp      the display with a full `inv_areas` buffer
+ * @param area_p    pointer to the area to add
+ */
+static void inv_area_join_cheapest(lv_disp_t * disp, const lv_area_t * area_p)
+{
+    uint32_t best_i = 0;
+    uint32_t best_cost = UINT32_MAX;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        lv_area_t joined_area;
+        _lv_area_join(&joined_area, &disp->inv_areas[i], area_p);
+        uint32_t cost = inv_area_cost(disp, &joined_area) - inv_area_cost(disp, &disp->inv_areas[i]);
+        if(cost < best_cost) {
+            best_cost = cost;
+            best_i = i;
+        }
+    }
+    _lv_area_join(&disp->inv_areas[best_i], &disp->inv_areas[best_i], area_p);
+}
+#endif
 
 /**
  * Refresh the sync areas
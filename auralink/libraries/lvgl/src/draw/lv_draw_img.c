@@ -13,14 +13,46 @@
 #include "../core/lv_refr.h"
 #include "../misc/lv_mem.h"
 #include "../misc/lv_math.h"
+#include "lv_draw_transform.h"
 
 /*********************
  *      DEFINES
  *********************/
+#if LV_IMG_TRANSFORM_CACHE_SIZE && LV_COLOR_DEPTH == 16
+    #define TRANSFORM_CACHE         1
+    #define TRANSFORM_CACHE_SLOTS   16      /*Images tracked at once, cached or seen once*/
+#else
+    #define TRANSFORM_CACHE         0
+#endif
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if TRANSFORM_CACHE
+typedef enum {
+    TRANSFORM_CACHE_FREE = 0,
+    TRANSFORM_CACHE_SEEN,       /*Drawn once: rendered into the cache if it's drawn again*/
+    TRANSFORM_CACHE_READY,      /*`buf` holds the final pixels*/
+    TRANSFORM_CACHE_SKIP,       /*Too large or a color format that can't be transformed whole*/
+} transform_cache_state_t;
+
+typedef struct {
+    const void * src;
+    const void * data;          /*`src`'s pixels when cached: an image pointed to new pixels is cached again*/
+    int32_t frame_id;
+    lv_point_t pivot;
+    int16_t angle;
+    uint16_t zoom;
+    lv_color_t recolor;
+    lv_opa_t recolor_opa;
+    uint8_t antialias;
+    uint8_t state;
+    lv_area_t area;             /*The area cached or last drawn, relative to the image's coordinates*/
+    uint8_t * buf;              /*RGB565 pixels followed by their A8 alpha*/
+    uint32_t size;
+    uint32_t last_use;
+} transform_cache_entry_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -32,9 +64,25 @@ static lv_res_t /* LV_ATTRIBUTE_FAST_MEM */ decode_and_draw(lv_draw_ctx_t * draw
 static void show_error(lv_draw_ctx_t * draw_ctx, const lv_area_t * coords, const char * msg);
 static void draw_cleanup(_lv_img_cache_entry_t * cache);
 
+#if TRANSFORM_CACHE
+static lv_res_t transform_cache_draw(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * draw_dsc,
+                                     const lv_area_t * coords, const void * src);
+static bool transform_cache_render(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * draw_dsc,
+                                   const lv_area_t * coords, const lv_area_t * area, transform_cache_entry_t * e);
+static void transform_cache_drop(transform_cache_entry_t * e);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if TRANSFORM_CACHE
+    static transform_cache_entry_t transform_cache[TRANSFORM_CACHE_SLOTS];
+    static bool transform_cache_en = true;
+    static uint32_t transform_cache_size;
+    static uint32_t transform_cache_clock;
+    static uint32_t transform_cache_hits;
+    static uint32_t transform_cache_misses;
+#endif
 
 /**********************
  *      MACROS
@@ -233,6 +281,40 @@ void lv_draw_img_decoded(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc
     draw_ctx->draw_img_decoded(draw_ctx, dsc, coords, map_p, color_format);
 }
 
+void lv_draw_img_enable_transform_cache(bool en)
+{
+#if TRANSFORM_CACHE
+    transform_cache_en = en;
+    if(!en) _lv_draw_img_transform_cache_invalidate(NULL);
+#else
+    LV_UNUSED(en);
+#endif
+}
+
+void lv_draw_img_get_transform_cache_stat(lv_draw_img_cache_stat_t * stat)
+{
+#if TRANSFORM_CACHE
+    stat->hits = transform_cache_hits;
+    stat->misses = transform_cache_misses;
+    stat->size = transform_cache_size;
+#else
+    lv_memset_00(stat, sizeof(lv_draw_img_cache_stat_t));
+#endif
+}
+
+void _lv_draw_img_transform_cache_invalidate(const void * src)
+{
+#if TRANSFORM_CACHE
+    uint32_t i;
+    for(i = 0; i < TRANSFORM_CACHE_SLOTS; i++) {
+        transform_cache_entry_t * e = &transform_cache[i];
+        if(e->state != TRANSFORM_CACHE_FREE && (src == NULL || e->src == src)) transform_cache_drop(e);
+    }
+#else
+    LV_UNUSED(src);
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -243,6 +325,10 @@ static lv_res_t LV_ATTRIBUTE_FAST_MEM decode_and_draw(lv_draw_ctx_t * draw_ctx,
 {
     if(draw_dsc->opa <= LV_OPA_MIN) return LV_RES_OK;
 
+#if TRANSFORM_CACHE
+    if(transform_cache_draw(draw_ctx, draw_dsc, coords, src) == LV_RES_OK) return LV_RES_OK;
+#endif
+
     _lv_img_cache_entry_t * cdsc = _lv_img_cache_open(src, draw_dsc->recolor, draw_dsc->frame_id);
 
     if(cdsc == NULL) return LV_RES_INV;
@@ -250,11 +336,12 @@ static lv_res_t LV_ATTRIBUTE_FAST_MEM decode_and_draw(lv_draw_ctx_t * draw_ctx,
     lv_img_cf_t cf;
     if(lv_img_cf_is_chroma_keyed(cdsc->dec_dsc.header.cf)) cf = LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED;
     else if(LV_IMG_CF_ALPHA_8BIT == cdsc->dec_dsc.header.cf) cf = LV_IMG_CF_ALPHA_8BIT;
+    else if(LV_IMG_CF_ALPHA_4BIT == cdsc->dec_dsc.header.cf && cdsc->dec_dsc.img_data) cf = LV_IMG_CF_ALPHA_4BIT;
     else if(LV_IMG_CF_RGB565A8 == cdsc->dec_dsc.header.cf) cf = LV_IMG_CF_RGB565A8;
     else if(lv_img_cf_has_alpha(cdsc->dec_dsc.header.cf)) cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
     else cf = LV_IMG_CF_TRUE_COLOR;
 
-    if(cf == LV_IMG_CF_ALPHA_8BIT) {
+    if(cf == LV_IMG_CF_ALPHA_8BIT || cf == LV_IMG_CF_ALPHA_4BIT) {
         if(draw_dsc->angle || draw_dsc->zoom != LV_IMG_ZOOM_NONE) {
             /* resume normal method */
             cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
@@ -373,3 +460,189 @@ static void draw_cleanup(_lv_img_cache_entry_t * cache)
     LV_UNUSED(cache);
 #endif
 }
+
+#if TRANSFORM_CACHE
+/**
+ * Draw a zoomed or rotated image from its cached final form.
+ * The opacity and blend mode are applied when blending, so one entry serves every opacity of a fade.
+ * @return LV_RES_OK: drawn; LV_RES_INV: draw it the normal way
+ */
+static lv_res_t transform_cache_draw(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * draw_dsc,
+                                     const lv_area_t * coords, const void * src)
+{
+    if(!transform_cache_en || draw_ctx->draw_transform == NULL) return LV_RES_INV;
+    if(draw_dsc->angle == 0 && draw_dsc->zoom == LV_IMG_ZOOM_NONE) return LV_RES_INV;
+    if(lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) return LV_RES_INV;
+
+    const void * data = ((const lv_img_dsc_t *)src)->data;
+    transform_cache_entry_t * e = NULL;
+    transform_cache_entry_t * victim = NULL;    /*A free slot or else the least recently used one*/
+    uint32_t i;
+    for(i = 0; i < TRANSFORM_CACHE_SLOTS; i++) {
+        transform_cache_entry_t * t = &transform_cache[i];
+        if(t->state == TRANSFORM_CACHE_FREE) {
+            if(victim == NULL || victim->state != TRANSFORM_CACHE_FREE) victim = t;
+            continue;
+        }
+        if(t->src == src && t->data == data && t->frame_id == draw_dsc->frame_id &&
+           t->angle == draw_dsc->angle && t->zoom == draw_dsc->zoom &&
+           t->pivot.x == draw_dsc->pivot.x && t->pivot.y == draw_dsc->pivot.y &&
+           t->recolor_opa == draw_dsc->recolor_opa && t->antialias == draw_dsc->antialias &&
+           (draw_dsc->recolor_opa == LV_OPA_TRANSP || t->recolor.full == draw_dsc->recolor.full)) {
+            e = t;
+            break;
+        }
+        if(victim == NULL || (victim->state != TRANSFORM_CACHE_FREE && t->last_use < victim->last_use)) victim = t;
+    }
+
+    if(e == NULL) {
+        transform_cache_drop(victim);
+        e = victim;
+        e->src = src;
+        e->data = data;
+        e->frame_id = draw_dsc->frame_id;
+        e->pivot = draw_dsc->pivot;
+        e->angle = draw_dsc->angle;
+        e->zoom = draw_dsc->zoom;
+        e->recolor = draw_dsc->recolor;
+        e->recolor_opa = draw_dsc->recolor_opa;
+        e->antialias = draw_dsc->antialias;
+        e->area.x1 = 1;     /*Empty: matches no drawn area*/
+        e->area.x2 = 0;
+        e->state = TRANSFORM_CACHE_SEEN;
+    }
+    e->last_use = ++transform_cache_clock;
+    if(e->state == TRANSFORM_CACHE_SKIP) return LV_RES_INV;
+
+    lv_area_t area_abs;
+    _lv_img_buf_get_transformed_area(&area_abs, lv_area_get_width(coords), lv_area_get_height(coords),
+                                     draw_dsc->angle, draw_dsc->zoom, &draw_dsc->pivot);
+    lv_area_move(&area_abs, coords->x1, coords->y1);
+    lv_area_t clip_com;
+    if(!_lv_area_intersect(&clip_com, draw_ctx->clip_area, &area_abs)) return LV_RES_OK;
+
+    /*The transformation steps through the source by the width of the area drawn, so the cached pixels are the
+     *ones drawn only for the same columns. Rows don't depend on each other*/
+    lv_area_t area;
+    lv_area_copy(&area, &clip_com);
+    lv_area_move(&area, -coords->x1, -coords->y1);
+    bool same_cols = area.x1 == e->area.x1 && area.x2 == e->area.x2;
+    if(e->state == TRANSFORM_CACHE_READY && same_cols && area.y1 >= e->area.y1 && area.y2 <= e->area.y2) {
+        transform_cache_hits++;
+    }
+    else {
+        /*Rendered when the same columns are drawn the second time, e.g. not while sliding in.
+         *Layers are blended once and invalidated, so they are never rendered*/
+        transform_cache_misses++;
+        if(!same_cols) {
+            if(e->buf) {
+                lv_mem_free(e->buf);
+                transform_cache_size -= e->size;
+                e->buf = NULL;
+                e->state = TRANSFORM_CACHE_SEEN;
+            }
+            e->area = area;
+            return LV_RES_INV;
+        }
+        area.y1 = LV_MIN(area.y1, e->area.y1);
+        area.y2 = LV_MAX(area.y2, e->area.y2);
+        if(!transform_cache_render(draw_ctx, draw_dsc, coords, &area, e)) {
+            e->state = TRANSFORM_CACHE_SKIP;
+            return LV_RES_INV;
+        }
+    }
+
+    lv_draw_img_dsc_t dsc = *draw_dsc;
+    dsc.angle = 0;
+    dsc.zoom = LV_IMG_ZOOM_NONE;
+    dsc.recolor_opa = LV_OPA_TRANSP;
+
+    lv_area_copy(&area_abs, &e->area);
+    lv_area_move(&area_abs, coords->x1, coords->y1);
+    const lv_area_t * clip_area_ori = draw_ctx->clip_area;
+    draw_ctx->clip_area = &clip_com;
+    lv_draw_img_decoded(draw_ctx, &dsc, &area_abs, e->buf, LV_IMG_CF_RGB565A8);
+    draw_ctx->clip_area = clip_area_ori;
+    return LV_RES_OK;
+}
+
+/**
+ * Transform and recolor `area` of the image once into `e->buf` as RGB565A8, the way lv_draw_sw_img_decoded does
+ * it for the area drawn. Makes room by freeing the least recently used images.
+ * @param area      the area to render, relative to the image's coordinates
+ * @return true: `e` is ready; false: the image can't be cached
+ */
+static bool transform_cache_render(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * draw_dsc,
+                                   const lv_area_t * coords, const lv_area_t * area, transform_cache_entry_t * e)
+{
+    if(e->buf) {
+        lv_mem_free(e->buf);
+        transform_cache_size -= e->size;
+        e->buf = NULL;
+    }
+
+    uint32_t px_cnt = lv_area_get_size(area);
+    uint32_t size = px_cnt * (sizeof(lv_color_t) + 1);
+    if(size > LV_IMG_TRANSFORM_CACHE_MAX_IMG || size > LV_IMG_TRANSFORM_CACHE_SIZE) return false;
+
+    _lv_img_cache_entry_t * cdsc = _lv_img_cache_open(e->src, draw_dsc->recolor, draw_dsc->frame_id);
+    if(cdsc == NULL) return false;
+
+    /*Only the formats the transformation reads whole, as decode_and_draw passes them*/
+    lv_img_cf_t cf = cdsc->dec_dsc.header.cf;
+    if(lv_img_cf_is_chroma_keyed(cf)) cf = LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED;
+    else if(cf != LV_IMG_CF_RGB565A8 && cf != LV_IMG_CF_TRUE_COLOR && cf != LV_IMG_CF_TRUE_COLOR_ALPHA) cf = LV_IMG_CF_UNKNOWN;
+    if(cf == LV_IMG_CF_UNKNOWN || cdsc->dec_dsc.img_data == NULL || cdsc->dec_dsc.error_msg != NULL) {
+        draw_cleanup(cdsc);
+        return false;
+    }
+
+    while(transform_cache_size + size > LV_IMG_TRANSFORM_CACHE_SIZE) {
+        transform_cache_entry_t * lru = NULL;
+        uint32_t i;
+        for(i = 0; i < TRANSFORM_CACHE_SLOTS; i++) {
+            transform_cache_entry_t * t = &transform_cache[i];
+            if(t->state == TRANSFORM_CACHE_READY && (lru == NULL || t->last_use < lru->last_use)) lru = t;
+        }
+        transform_cache_drop(lru);
+    }
+
+    e->buf = lv_mem_alloc(size);
+    if(e->buf == NULL) {
+        draw_cleanup(cdsc);
+        return false;
+    }
+
+    lv_coord_t src_w = lv_area_get_width(coords);
+    lv_coord_t src_h = lv_area_get_height(coords);
+    lv_color_t * cbuf = (lv_color_t *)e->buf;
+    lv_opa_t * abuf = e->buf + px_cnt * sizeof(lv_color_t);
+    lv_draw_transform(draw_ctx, area, cdsc->dec_dsc.img_data, src_w, src_h, src_w, draw_dsc, cf, cbuf, abuf);
+    draw_cleanup(cdsc);
+
+    if(draw_dsc->recolor_opa > LV_OPA_MIN) {
+        uint16_t premult_v[3];
+        lv_color_premult(draw_dsc->recolor, draw_dsc->recolor_opa, premult_v);
+        lv_opa_t mix = 255 - draw_dsc->recolor_opa;
+        uint32_t i;
+        for(i = 0; i < px_cnt; i++) {
+            cbuf[i] = lv_color_mix_premult(premult_v, cbuf[i], mix);
+        }
+    }
+
+    e->area = *area;
+    e->size = size;
+    e->state = TRANSFORM_CACHE_READY;
+    transform_cache_size += size;
+    return true;
+}
+
+static void transform_cache_drop(transform_cache_entry_t * e)
+{
+    if(e->buf) {
+        lv_mem_free(e->buf);
+        transform_cache_size -= e->size;
+    }
+    lv_memset_00(e, sizeof(transform_cache_entry_t));
+}
+#endif /*TRANSFORM_CACHE*/
@@ -45,6 +45,12 @@ typedef struct {
     uint8_t antialias       : 1;
 } lv_draw_img_dsc_t;
 
+typedef struct {
+    uint32_t hits;      /*Zoomed or rotated images blended from their cached final form*/
+    uint32_t misses;    /*Zoomed or rotated images transformed while drawing them*/
+    uint32_t size;      /*Bytes of images in the cache now*/
+} lv_draw_img_cache_stat_t;
+
 struct _lv_draw_ctx_t;
 
 /**********************
@@ -66,6 +72,25 @@ void lv_draw_img(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc
 void lv_draw_img_decoded(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc,
                          const lv_area_t * coords, const uint8_t * map_p, lv_img_cf_t color_format);
 
+/**
+ * Enable or disable the cache of transformed images (`LV_IMG_TRANSFORM_CACHE_SIZE`). Enabled by default.
+ * Disabling frees the cached images. The rendered pixels are the same either way.
+ * @param en        true: blend zoomed or rotated images from their cached final form; false: transform them on every draw
+ */
+void lv_draw_img_enable_transform_cache(bool en);
+
+/**
+ * Get the hit and miss counters and the size of the transformed image cache. The counters only ever grow (and wrap).
+ * @param stat      the counters are copied here
+ */
+void lv_draw_img_get_transform_cache_stat(lv_draw_img_cache_stat_t * stat);
+
+/**
+ * Drop an image source from the transformed image cache. Called by `lv_img_cache_invalidate_src`.
+ * @param src       pointer to an `lv_img_dsc_t` variable, or NULL to drop every image
+ */
+void _lv_draw_img_transform_cache_invalidate(const void * src);
+
 /**
  * Get the type of an image source
  * @param src pointer to an image source:
@@ -43,6 +43,12 @@ typedef struct {
     uint32_t has_alpha : 1;
 } lv_draw_sw_layer_ctx_t;
 
+typedef struct {
+    uint32_t hits;      /*Glyphs drawn from a cached raster*/
+    uint32_t misses;    /*Glyphs decoded from the font and added to the cache*/
+    uint32_t size;      /*Bytes of rasters in the cache now*/
+} lv_draw_sw_glyph_cache_stat_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -58,9 +64,31 @@ void lv_draw_sw_arc(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, con
 void lv_draw_sw_rect(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords);
 
 void lv_draw_sw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords);
+
+/**
+ * Enable or disable caching the masks of rounded corners (`LV_RECT_MASK_CACHE_SIZE`). Enabled by default.
+ * Disabling frees the cached masks. The rendered pixels are the same either way.
+ * @param en        true: reuse the corner masks of the same size, radius and border; false: compute them on every draw
+ */
+void lv_draw_sw_rect_enable_mask_cache(bool en);
+
 void lv_draw_sw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos_p,
                        uint32_t letter);
 
+/**
+ * Enable or disable the glyph raster cache (`LV_GLYPH_CACHE_SIZE`). Enabled by default.
+ * Disabling frees the cached glyphs, e.g. after freeing a font loaded at run time.
+ * The rendered pixels are the same either way.
+ * @param en        true: draw glyphs from their cached A8 rasters; false: decode them from the font on every draw
+ */
+void lv_draw_sw_letter_enable_cache(bool en);
+
+/**
+ * Get the hit and miss counters and the size of the glyph raster cache. The counters only ever grow (and wrap).
+ * @param stat      the counters are copied here
+ */
+void lv_draw_sw_letter_get_cache_stat(lv_draw_sw_glyph_cache_stat_t * stat);
+
 void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_img_decoded(struct _lv_draw_ctx_t * draw_ctx,
                                                         const lv_draw_img_dsc_t * draw_dsc,
                                                         const lv_area_t * coords, const uint8_t * src_buf,
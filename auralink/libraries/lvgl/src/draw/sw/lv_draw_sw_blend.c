@@ -14,6 +14,7 @@
 /*********************
  *      DEFINES
  *********************/
+#define BLEND_SWAR (LV_DRAW_SW_BLEND_SWAR && LV_COLOR_DEPTH == 16)
 
 /**********************
  *      TYPEDEFS
@@ -69,9 +70,18 @@ static inline lv_color_t color_blend_true_color_subtractive(lv_color_t fg, lv_co
 static inline lv_color_t color_blend_true_color_multiply(lv_color_t fg, lv_color_t bg, lv_opa_t opa);
 #endif /*LV_DRAW_COMPLEX*/
 
+#if BLEND_SWAR
+static void fill_opa_swar(lv_color_t * dest_buf, int32_t w, int32_t h, lv_coord_t dest_stride,
+                          const uint16_t * color_premult, lv_opa_t opa_inv,
+                          lv_color_t last_dest_color, lv_color_t last_res_color);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if BLEND_SWAR
+static bool swar_en = true;
+#endif
 
 /**********************
  *      MACROS
@@ -89,6 +99,9 @@ static inline lv_color_t color_blend_true_color_multiply(lv_color_t fg, lv_color
     }                                                                                               \
     mask_tmp_x++;
 
+/*A 16 bit color in both halves of a word*/
+#define COLOR_PAIR(c) ((uint32_t)(c).full * 0x10001U)
+
 
 /**********************
  *   GLOBAL FUNCTIONS
@@ -107,6 +120,15 @@ void lv_draw_sw_blend(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * d
     ((lv_draw_sw_ctx_t *)draw_ctx)->blend(draw_ctx, dsc);
 }
 
+void lv_draw_sw_blend_enable_swar(bool en)
+{
+#if BLEND_SWAR
+    swar_en = en;
+#else
+    LV_UNUSED(en);
+#endif
+}
+
 void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_basic(lv_draw_ctx_t * draw_ctx,
                                                   const lv_draw_sw_blend_dsc_t * dsc)
 {
@@ -279,6 +301,13 @@ static LV_ATTRIBUTE_FAST_MEM void fill_normal(lv_color_t * dest_buf, const lv_ar
             lv_color_premult(color, opa, color_premult);
             lv_opa_t opa_inv = 255 - opa;
 
+#if BLEND_SWAR
+            if(swar_en) {
+                fill_opa_swar(dest_buf, w, h, dest_stride, color_premult, opa_inv, last_dest_color, last_res_color);
+                return;
+            }
+#endif
+
             for(y = 0; y < h; y++) {
                 for(x = 0; x < w; x++) {
                     if(last_dest_color.full != dest_buf[x].full) {
@@ -1020,7 +1049,7 @@ static inline lv_color_t color_blend_true_color_subtractive(lv_color_t fg, lv_co
     tmp = bg.ch.green - fg.ch.green;
     fg.ch.green = LV_MAX(tmp, 0);
 #else
-    tmp = (bg.ch.green_h << 3) + bg.ch.green_l + (fg.ch.green_h << 3) + fg.ch.green_l;
+    tmp = ((bg.ch.green_h << 3) + bg.ch.green_l) - ((fg.ch.green_h << 3) + fg.ch.green_l);
     tmp = LV_MAX(tmp, 0);
     fg.ch.green_h = tmp >> 3;
     fg.ch.green_l = tmp & 0x7;
@@ -1059,3 +1088,101 @@ static inline lv_color_t color_blend_true_color_multiply(lv_color_t fg, lv_color
 
 #endif
 
+#if BLEND_SWAR
+
+/*The color channels of the two pixels of a word, each in a 16 bit lane of its own*/
+#define SWAR_LANE5  0x001F001FU
+#if LV_COLOR_16_SWAP == 0
+#define SWAR_LANE6  0x003F003FU
+#define SWAR_R(p)   (((p) >> 11) & SWAR_LANE5)
+#define SWAR_G(p)   (((p) >> 5) & SWAR_LANE6)
+#define SWAR_B(p)   ((p) & SWAR_LANE5)
+#define SWAR_PACK(r, g, b) ((((r) & SWAR_LANE5) << 11) | (((g) & SWAR_LANE6) << 5) | ((b) & SWAR_LANE5))
+#else
+/*GGGBBBBB RRRRRGGG: the two halves of green are taken apart and put back*/
+#define SWAR_LANE3  0x00070007U
+#define SWAR_R(p)   (((p) >> 3) & SWAR_LANE5)
+#define SWAR_G(p)   ((((p) & SWAR_LANE3) << 3) | (((p) >> 13) & SWAR_LANE3))
+#define SWAR_B(p)   (((p) >> 8) & SWAR_LANE5)
+#define SWAR_PACK(r, g, b) ((((r) & SWAR_LANE5) << 3) | (((b) & SWAR_LANE5) << 8) | \
+                            (((g) >> 3) & SWAR_LANE3) | (((g) & SWAR_LANE3) << 13))
+#endif
+
+/*`LV_UDIV255` in both lanes. Exact below 32132; a mixed channel reaches 63 * 255 at most.*/
+#define SWAR_UDIV255(x) (((x) + 0x00010001U + (((x) >> 8) & 0x00FF00FFU)) >> 8)
+
+/**
+ * `lv_color_mix_premult` on the two pixels of a word. A channel times `opa_inv` plus its premultiplied
+ * color stays below 16 bits, so each channel of both pixels is mixed with one multiplication.
+ * @param premult   the premultiplied channels of `lv_color_premult`, repeated in both lanes
+ */
+static inline uint32_t LV_ATTRIBUTE_FAST_MEM mix_premult_pair(const uint32_t * premult, uint32_t dest,
+                                                             uint32_t opa_inv)
+{
+    uint32_t r = SWAR_UDIV255(premult[0] + SWAR_R(dest) * opa_inv);
+    uint32_t g = SWAR_UDIV255(premult[1] + SWAR_G(dest) * opa_inv);
+    uint32_t b = SWAR_UDIV255(premult[2] + SWAR_B(dest) * opa_inv);
+    return SWAR_PACK(r, g, b);
+}
+
+/**
+ * `fill_normal` with opacity and no mask, two pixels per word. A pair that matches the last
+ * destination color is stored from the cached result, any other is mixed in one go. Keeps the
+ * cache of the one pixel loop: it starts with black mixed by `lv_color_mix`, which can differ
+ * from the premultiplied mix, so it writes the same colors.
+ */
+static void LV_ATTRIBUTE_FAST_MEM fill_opa_swar(lv_color_t * dest_buf, int32_t w, int32_t h, lv_coord_t dest_stride,
+                                                const uint16_t * color_premult, lv_opa_t opa_inv,
+                                                lv_color_t last_dest_color, lv_color_t last_res_color)
+{
+#define FILL_OPA_PX(x)                                                                  \
+    if(last_dest_color.full != dest_buf[x].full) {                                      \
+        last_dest_color = dest_buf[x];                                                  \
+        last_res_color = lv_color_mix_premult((uint16_t *)color_premult, dest_buf[x], opa_inv); \
+    }                                                                                   \
+    dest_buf[x] = last_res_color;
+
+    uint32_t premult[3] = {color_premult[0] * 0x10001U, color_premult[1] * 0x10001U, color_premult[2] * 0x10001U};
+    uint32_t last_dest32;
+    uint32_t last_res32;
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        x = 0;
+        if(((lv_uintptr_t)dest_buf & 0x3) && w > 0) {
+            FILL_OPA_PX(0)
+            x = 1;
+        }
+        last_dest32 = COLOR_PAIR(last_dest_color);
+        last_res32 = COLOR_PAIR(last_res_color);
+
+        for(; x < w - 1; x += 2) {
+            uint32_t * d32 = (uint32_t *)&dest_buf[x];
+            uint32_t d = *d32;
+            if(d == last_dest32) {
+                *d32 = last_res32;
+                continue;
+            }
+
+            uint32_t res = mix_premult_pair(premult, d, opa_inv);
+            /*Where the one pixel loop would take the cached result*/
+            if((d & 0xFFFF) == last_dest_color.full) {
+                res = (res & 0xFFFF0000) | last_res_color.full;
+                if((d >> 16) == last_dest_color.full) res = last_res32;
+            }
+            *d32 = res;
+            last_dest_color.full = (uint16_t)(d >> 16);
+            last_res_color.full = (uint16_t)(res >> 16);
+            last_dest32 = COLOR_PAIR(last_dest_color);
+            last_res32 = COLOR_PAIR(last_res_color);
+        }
+
+        if(x < w) {
+            FILL_OPA_PX(x)
+        }
+        dest_buf += dest_stride;
+    }
+#undef FILL_OPA_PX
+}
+
+#endif /*BLEND_SWAR*/
@@ -59,6 +59,13 @@ void lv_draw_sw_blend(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_d
 void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_basic(struct _lv_draw_ctx_t * draw_ctx,
                                                         const lv_draw_sw_blend_dsc_t * dsc);
 
+/**
+ * Enable or disable the word wide fill loop (`LV_DRAW_SW_BLEND_SWAR`). It's enabled by default.
+ * Both ways give the same pixels, so turning it off is only useful to compare the two.
+ * @param en        true: fill with opacity two pixels per word; false: one pixel at a time
+ */
+void lv_draw_sw_blend_enable_swar(bool en);
+
 /**********************
  *      MACROS
  **********************/
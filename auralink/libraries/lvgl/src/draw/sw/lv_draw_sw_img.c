@@ -28,6 +28,8 @@
  **********************/
 static void convert_cb(const lv_area_t * dest_area, const void * src_buf, lv_coord_t src_w, lv_coord_t src_h,
                        lv_coord_t src_stride, const lv_draw_img_dsc_t * draw_dsc, lv_img_cf_t cf, lv_color_t * cbuf, lv_opa_t * abuf);
+static void blend_alpha_mask(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * draw_dsc, const lv_area_t * coords,
+                             const uint8_t * src_buf, lv_img_cf_t cf, bool mask_any);
 
 /**********************
  *  STATIC VARIABLES
@@ -82,6 +84,10 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_img_decoded(struct _lv_draw_ctx_t * draw_c
         blend_dsc.blend_area = coords;
         lv_draw_sw_blend(draw_ctx, &blend_dsc);
     }
+    /*Masked A8 and any A4: unpack the alpha line by line and blend the recolor through it*/
+    else if(!transform && (cf == LV_IMG_CF_ALPHA_8BIT || cf == LV_IMG_CF_ALPHA_4BIT)) {
+        blend_alpha_mask(draw_ctx, draw_dsc, coords, src_buf, cf, mask_any);
+    }
 #if LV_COLOR_DEPTH == 16
     else if(!mask_any && !transform && cf == LV_IMG_CF_RGB565A8 && draw_dsc->recolor_opa == LV_OPA_TRANSP) {
         lv_coord_t src_w = lv_area_get_width(coords);
@@ -200,6 +206,74 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_img_decoded(struct _lv_draw_ctx_t * draw_c
  *   STATIC FUNCTIONS
  **********************/
 
+/* Alpha-only images are a solid recolor seen through the mask: no color buffer is needed*/
+static void blend_alpha_mask(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * draw_dsc, const lv_area_t * coords,
+                             const uint8_t * src_buf, lv_img_cf_t cf, bool mask_any)
+{
+#if LV_DRAW_COMPLEX == 0
+    LV_UNUSED(mask_any);
+#endif
+    lv_area_t blend_area;
+    if(!_lv_area_intersect(&blend_area, coords, draw_ctx->clip_area)) return;
+
+    lv_coord_t src_w = lv_area_get_width(coords);
+    lv_coord_t src_stride = cf == LV_IMG_CF_ALPHA_4BIT ? (src_w + 1) >> 1 : src_w;
+    lv_coord_t blend_w = lv_area_get_width(&blend_area);
+    lv_coord_t x_ofs = blend_area.x1 - coords->x1;
+    lv_coord_t y_last = blend_area.y2;
+
+    /*Round to full lines*/
+    uint32_t buf_h = MAX_BUF_SIZE / (uint32_t)blend_w;
+    if(buf_h == 0) buf_h = 1;
+    lv_opa_t * mask_buf = lv_mem_buf_get(blend_w * buf_h);
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memset_00(&blend_dsc, sizeof(lv_draw_sw_blend_dsc_t));
+    blend_dsc.opa = draw_dsc->opa;
+    blend_dsc.blend_mode = draw_dsc->blend_mode;
+    blend_dsc.color = draw_dsc->recolor;
+    blend_dsc.src_buf = NULL;
+    blend_dsc.mask_buf = mask_buf;
+    blend_dsc.mask_area = &blend_area;
+    blend_dsc.blend_area = &blend_area;
+
+    blend_area.y2 = LV_MIN(blend_area.y1 + (lv_coord_t)buf_h - 1, y_last);
+    while(blend_area.y1 <= y_last) {
+        lv_opa_t * mask_tmp = mask_buf;
+        lv_coord_t y;
+        for(y = blend_area.y1; y <= blend_area.y2; y++) {
+            const uint8_t * src_row = src_buf + (y - coords->y1) * src_stride;
+            if(cf == LV_IMG_CF_ALPHA_8BIT) {
+                lv_memcpy(mask_tmp, src_row + x_ofs, blend_w);
+            }
+            else {
+                /*High nibble first; 0..15 maps to 0..255 like the decoder's opacity table*/
+                lv_coord_t x;
+                for(x = 0; x < blend_w; x++) {
+                    lv_coord_t sx = x_ofs + x;
+                    uint8_t v = src_row[sx >> 1];
+                    mask_tmp[x] = (uint8_t)(((sx & 1) ? (v & 0x0F) : (v >> 4)) * 17);
+                }
+            }
+#if LV_DRAW_COMPLEX
+            if(mask_any) {
+                lv_draw_mask_res_t mask_res_line = lv_draw_mask_apply(mask_tmp, blend_area.x1, y, blend_w);
+                if(mask_res_line == LV_DRAW_MASK_RES_TRANSP) lv_memset_00(mask_tmp, blend_w);
+            }
+#endif
+            mask_tmp += blend_w;
+        }
+
+        blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+        lv_draw_sw_blend(draw_ctx, &blend_dsc);
+
+        blend_area.y1 = blend_area.y2 + 1;
+        blend_area.y2 = LV_MIN(blend_area.y1 + (lv_coord_t)buf_h - 1, y_last);
+    }
+
+    lv_mem_buf_release(mask_buf);
+}
+
 /* Separate the image channels to RGB and Alpha to match LV_COLOR_DEPTH settings*/
 static void convert_cb(const lv_area_t * dest_area, const void * src_buf, lv_coord_t src_w, lv_coord_t src_h,
                        lv_coord_t src_stride, const lv_draw_img_dsc_t * draw_dsc, lv_img_cf_t cf, lv_color_t * cbuf, lv_opa_t * abuf)
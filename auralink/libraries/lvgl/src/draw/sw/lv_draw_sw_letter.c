@@ -14,14 +14,31 @@
 #include "../../misc/lv_style.h"
 #include "../../font/lv_font.h"
 #include "../../core/lv_refr.h"
+#include "../../misc/lv_lru.h"
 
 /*********************
  *      DEFINES
  *********************/
+#if LV_GLYPH_CACHE_SIZE
+    #define GLYPH_CACHE             1
+    #define GLYPH_CACHE_AVG_SIZE    64      /*Sizes the hash table of the LRU*/
+#else
+    #define GLYPH_CACHE             0
+#endif
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if GLYPH_CACHE
+/*Zeroed before filling, as the LRU hashes and compares the padding too*/
+typedef struct {
+    const lv_font_t * font;
+    uint32_t letter;
+    uint16_t box_w;
+    uint16_t box_h;
+    lv_opa_t opa;
+} glyph_cache_key_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -36,9 +53,24 @@ static void draw_letter_subpx(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_
                               lv_font_glyph_dsc_t * g, const uint8_t * map_p);
 #endif /*LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX*/
 
+#if GLYPH_CACHE
+static const lv_opa_t * glyph_cache_get(const lv_draw_label_dsc_t * dsc, const lv_font_glyph_dsc_t * g,
+                                        uint32_t letter);
+static void glyph_raster_build(const lv_font_glyph_dsc_t * g, const uint8_t * map_p, lv_opa_t opa, lv_opa_t * out);
+static void /* LV_ATTRIBUTE_FAST_MEM */ draw_letter_raster(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                                                           const lv_point_t * pos, const lv_font_glyph_dsc_t * g,
+                                                           const lv_opa_t * raster);
+#endif /*GLYPH_CACHE*/
+
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if GLYPH_CACHE
+    static lv_lru_t * glyph_cache;
+    static bool glyph_cache_en = true;
+    static uint32_t glyph_cache_hits;
+    static uint32_t glyph_cache_misses;
+#endif
 
 /**********************
  *  GLOBAL VARIABLES
@@ -140,6 +172,16 @@ void lv_draw_sw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc
         return;
     }
 
+#if GLYPH_CACHE
+    if(!g.resolved_font->subpx) {
+        const lv_opa_t * raster = glyph_cache_get(dsc, &g, letter);
+        if(raster) {
+            draw_letter_raster(draw_ctx, dsc, &gpos, &g, raster);
+            return;
+        }
+    }
+#endif
+
     const uint8_t * map_p = lv_font_get_glyph_bitmap(g.resolved_font, letter);
     if(map_p == NULL) {
         LV_LOG_WARN("lv_draw_letter: character's bitmap not found");
@@ -158,6 +200,30 @@ void lv_draw_sw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc
     }
 }
 
+void lv_draw_sw_letter_enable_cache(bool en)
+{
+#if GLYPH_CACHE
+    glyph_cache_en = en;
+    if(!en && glyph_cache) {
+        lv_lru_del(glyph_cache);
+        glyph_cache = NULL;
+    }
+#else
+    LV_UNUSED(en);
+#endif
+}
+
+void lv_draw_sw_letter_get_cache_stat(lv_draw_sw_glyph_cache_stat_t * stat)
+{
+#if GLYPH_CACHE
+    stat->hits = glyph_cache_hits;
+    stat->misses = glyph_cache_misses;
+    stat->size = glyph_cache ? (uint32_t)(glyph_cache->total_memory - glyph_cache->free_memory) : 0;
+#else
+    lv_memset_00(stat, sizeof(lv_draw_sw_glyph_cache_stat_t));
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -571,3 +637,206 @@ static void draw_letter_subpx(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_
 }
 #endif /*LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX*/
 
+#if GLYPH_CACHE
+/**
+ * Get the A8 raster of a glyph from the cache, decoding and adding it on a miss
+ * @param dsc       the label's draw descriptor (the raster has its opacity applied)
+ * @param g         the glyph's descriptor
+ * @param letter    the letter to draw
+ * @return          `g->box_w * g->box_h` opacities row by row, or NULL if the glyph isn't cached
+ *                  (cache disabled, an image font glyph, larger than `LV_GLYPH_CACHE_MAX_GLYPH` or no memory)
+ */
+static const lv_opa_t * glyph_cache_get(const lv_draw_label_dsc_t * dsc, const lv_font_glyph_dsc_t * g,
+                                        uint32_t letter)
+{
+    if(!glyph_cache_en) return NULL;
+
+    uint32_t bpp = g->bpp;
+    if(bpp != 1 && bpp != 2 && bpp != 3 && bpp != 4 && bpp != 8) return NULL;  /*E.g. an image font*/
+    uint32_t size = (uint32_t)g->box_w * g->box_h;
+    if(size > LV_GLYPH_CACHE_MAX_GLYPH) return NULL;
+
+    if(glyph_cache == NULL) {
+        glyph_cache = lv_lru_create(LV_GLYPH_CACHE_SIZE, GLYPH_CACHE_AVG_SIZE, NULL, NULL);
+        if(glyph_cache == NULL) return NULL;
+    }
+
+    glyph_cache_key_t key;
+    lv_memset_00(&key, sizeof(key));
+    key.font = g->resolved_font;
+    key.letter = letter;
+    key.box_w = g->box_w;
+    key.box_h = g->box_h;
+    key.opa = dsc->opa;
+
+    lv_opa_t * raster = NULL;
+    lv_lru_get(glyph_cache, &key, sizeof(key), (void **)&raster);
+    if(raster) {
+        glyph_cache_hits++;
+        return raster;
+    }
+
+    const uint8_t * map_p = lv_font_get_glyph_bitmap(g->resolved_font, letter);
+    if(map_p == NULL) return NULL;
+    raster = lv_mem_alloc(size);
+    if(raster == NULL) return NULL;
+    glyph_raster_build(g, map_p, dsc->opa, raster);
+    if(lv_lru_set(glyph_cache, &key, sizeof(key), raster, size) != LV_LRU_OK) {
+        lv_mem_free(raster);
+        return NULL;
+    }
+    glyph_cache_misses++;
+    return raster;
+}
+
+/**
+ * Decode a whole glyph to opacities with the same tables as `draw_letter_normal`
+ * @param g         the glyph's descriptor
+ * @param map_p     the glyph's bitmap
+ * @param opa       the opacity of the text
+ * @param out       `g->box_w * g->box_h` opacities are written here
+ */
+static void glyph_raster_build(const lv_font_glyph_dsc_t * g, const uint8_t * map_p, lv_opa_t opa, lv_opa_t * out)
+{
+    uint32_t bpp = g->bpp == 3 ? 4 : g->bpp;
+    const uint8_t * bpp_opa_table_p;
+    switch(bpp) {
+        case 1:
+            bpp_opa_table_p = _lv_bpp1_opa_table;
+            break;
+        case 2:
+            bpp_opa_table_p = _lv_bpp2_opa_table;
+            break;
+        case 4:
+            bpp_opa_table_p = _lv_bpp4_opa_table;
+            break;
+        default:
+            bpp_opa_table_p = _lv_bpp8_opa_table;
+            break;
+    }
+
+    lv_opa_t opa_table[256];
+    uint32_t shades = 1 << bpp;
+    uint32_t i;
+    for(i = 0; i < shades; i++) {
+        if(opa < LV_OPA_MAX) {
+            opa_table[i] = bpp_opa_table_p[i] == LV_OPA_COVER ? opa : ((bpp_opa_table_p[i] * opa) >> 8);
+        }
+        else {
+            opa_table[i] = bpp_opa_table_p[i];
+        }
+    }
+    opa_table[0] = 0;
+
+    /*The rows are packed without padding*/
+    uint32_t px_cnt = (uint32_t)g->box_w * g->box_h;
+    uint32_t px_mask = (1 << bpp) - 1;
+    uint32_t bit = 0;
+    for(i = 0; i < px_cnt; i++) {
+        uint32_t letter_px = (map_p[bit >> 3] >> (8 - bpp - (bit & 0x7))) & px_mask;
+        out[i] = opa_table[letter_px];
+        bit += bpp;
+    }
+}
+
+/**
+ * Blend a glyph from its cached raster. Gives the same pixels as `draw_letter_normal`.
+ * @param draw_ctx  the draw context
+ * @param dsc       the label's draw descriptor
+ * @param pos       top left corner of the glyph's box
+ * @param g         the glyph's descriptor
+ * @param raster    the glyph's opacities from `glyph_cache_get`
+ */
+static void LV_ATTRIBUTE_FAST_MEM draw_letter_raster(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                                                     const lv_point_t * pos, const lv_font_glyph_dsc_t * g,
+                                                     const lv_opa_t * raster)
+{
+    int32_t box_w = g->box_w;
+    int32_t box_h = g->box_h;
+
+    /*Calculate the col/row start/end on the raster*/
+    int32_t col_start = pos->x >= draw_ctx->clip_area->x1 ? 0 : draw_ctx->clip_area->x1 - pos->x;
+    int32_t col_end   = pos->x + box_w <= draw_ctx->clip_area->x2 ? box_w : draw_ctx->clip_area->x2 - pos->x + 1;
+    int32_t row_start = pos->y >= draw_ctx->clip_area->y1 ? 0 : draw_ctx->clip_area->y1 - pos->y;
+    int32_t row_end   = pos->y + box_h <= draw_ctx->clip_area->y2 ? box_h : draw_ctx->clip_area->y2 - pos->y + 1;
+    if(col_start >= col_end || row_start >= row_end) return;
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memset_00(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = dsc->color;
+    blend_dsc.opa = dsc->opa;
+    blend_dsc.blend_mode = dsc->blend_mode;
+    blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+
+    lv_area_t fill_area;
+    fill_area.x1 = col_start + pos->x;
+    fill_area.x2 = col_end  + pos->x - 1;
+    fill_area.y1 = row_start + pos->y;
+    fill_area.y2 = row_end + pos->y - 1;
+    blend_dsc.blend_area = &fill_area;
+    blend_dsc.mask_area = &fill_area;
+
+    lv_coord_t fill_w = lv_area_get_width(&fill_area);
+#if LV_DRAW_COMPLEX
+    lv_area_t mask_area;
+    lv_area_copy(&mask_area, &fill_area);
+    mask_area.y2 = mask_area.y1 + row_end;
+    bool mask_any = lv_draw_mask_is_any(&mask_area);
+#else
+    bool mask_any = false;
+#endif
+
+    /*Whole rows and nothing to apply: blend straight from the raster.
+     *Without anti-aliasing the blend rounds the mask in place, so it gets a copy*/
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    if(!mask_any && fill_w == box_w && disp->driver->antialiasing) {
+        blend_dsc.mask_buf = (lv_opa_t *)raster + row_start * box_w;
+        lv_draw_sw_blend(draw_ctx, &blend_dsc);
+        return;
+    }
+
+    /*Copy the visible part of the rows into a mask buffer of at most a line*/
+    lv_coord_t hor_res = lv_disp_get_hor_res(disp);
+    uint32_t mask_buf_size = box_w * box_h > hor_res ? hor_res : box_w * box_h;
+    lv_opa_t * mask_buf = lv_mem_buf_get(mask_buf_size);
+    blend_dsc.mask_buf = mask_buf;
+    uint32_t mask_p = 0;
+
+    fill_area.y2 = fill_area.y1;
+    const lv_opa_t * raster_p = raster + row_start * box_w + col_start;
+    int32_t row;
+    for(row = row_start; row < row_end; row++) {
+        lv_memcpy_small(mask_buf + mask_p, raster_p, fill_w);
+#if LV_DRAW_COMPLEX
+        /*Apply masks if any*/
+        if(mask_any) {
+            lv_draw_mask_res_t res = lv_draw_mask_apply(mask_buf + mask_p, fill_area.x1, fill_area.y2, fill_w);
+            if(res == LV_DRAW_MASK_RES_TRANSP) {
+                lv_memset_00(mask_buf + mask_p, fill_w);
+            }
+        }
+#endif
+        mask_p += fill_w;
+        raster_p += box_w;
+
+        if(mask_p + fill_w < mask_buf_size) {
+            fill_area.y2 ++;
+        }
+        else {
+            lv_draw_sw_blend(draw_ctx, &blend_dsc);
+
+            fill_area.y1 = fill_area.y2 + 1;
+            fill_area.y2 = fill_area.y1;
+            mask_p = 0;
+        }
+    }
+
+    /*Flush the last part*/
+    if(fill_area.y1 != fill_area.y2) {
+        fill_area.y2--;
+        lv_draw_sw_blend(draw_ctx, &blend_dsc);
+    }
+
+    lv_mem_buf_release(mask_buf);
+}
+#endif /*GLYPH_CACHE*/
@@ -20,10 +20,39 @@
 #define SHADOW_ENHANCE          1
 #define SPLIT_LIMIT             50
 
+#if LV_DRAW_COMPLEX && defined(LV_RECT_MASK_CACHE_SIZE) && LV_RECT_MASK_CACHE_SIZE > 0
+    #define RECT_MASK_CACHE     1
+    #define RECT_MASK_LIFE_MAX  1000
+#else
+    #define RECT_MASK_CACHE     0
+#endif
+
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if RECT_MASK_CACHE
+/*The coverage of a row in the rounded corners: two spans at the ends with one value between them*/
+typedef struct {
+    uint32_t ofs;               /*Start of the left span in `buf`. The right span follows it*/
+    lv_coord_t left;            /*Width of the left span*/
+    lv_coord_t right;           /*Width of the right span*/
+    lv_opa_t mid;               /*Coverage between the spans*/
+} rect_mask_row_t;
+
+/*The corner rows of a rounded background or border mask. They depend only on the geometry,
+ *not on the color or the position*/
+typedef struct {
+    lv_coord_t w;
+    lv_coord_t h;
+    lv_coord_t rout;
+    lv_coord_t rin;             /*-1: background, no inner mask*/
+    lv_area_t inner;            /*Insets of the inner area from the outer one (border only)*/
+    int32_t life;               /*How often the entry was used*/
+    rect_mask_row_t * rows;     /*`rout` rows from the top, then `rout` rows from the bottom (border only)*/
+    lv_opa_t * buf;
+} rect_mask_entry_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -48,6 +77,17 @@ void draw_border_generic(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area,
 static void draw_border_simple(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area, const lv_area_t * inner_area,
                                lv_color_t color, lv_opa_t opa);
 
+#if RECT_MASK_CACHE
+static rect_mask_entry_t * rect_mask_get(const lv_area_t * outer_area, const lv_area_t * inner_area, lv_coord_t rout,
+                                         lv_coord_t rin);
+static void rect_mask_free(rect_mask_entry_t * e);
+static void rect_mask_line(const rect_mask_entry_t * e, int32_t row, lv_coord_t x, lv_coord_t len, lv_opa_t opa,
+                           lv_opa_t * mask_buf);
+#endif
+#if LV_DRAW_COMPLEX
+static lv_draw_mask_res_t border_mask_line(const void * mask_cache, const lv_area_t * outer_area, lv_coord_t rout,
+                                           lv_opa_t * mask_buf, lv_coord_t abs_x, lv_coord_t abs_y, lv_coord_t len);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -58,6 +98,11 @@ static void draw_border_simple(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer
     static int32_t sh_cache_r = -1;
 #endif
 
+#if RECT_MASK_CACHE
+    static rect_mask_entry_t rect_mask_cache[LV_RECT_MASK_CACHE_SIZE];
+    static bool rect_mask_cache_en = true;
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -92,6 +137,21 @@ void lv_draw_sw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, con
     draw_bg_img(draw_ctx, dsc, coords);
 }
 
+void lv_draw_sw_rect_enable_mask_cache(bool en)
+{
+#if RECT_MASK_CACHE
+    rect_mask_cache_en = en;
+    if(!en) {
+        uint32_t i;
+        for(i = 0; i < LV_RECT_MASK_CACHE_SIZE; i++) {
+            rect_mask_free(&rect_mask_cache[i]);
+        }
+    }
+#else
+    LV_UNUSED(en);
+#endif
+}
+
 
 /**********************
  *   STATIC FUNCTIONS
@@ -155,6 +215,12 @@ static void draw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, co
         mask_rout_id = lv_draw_mask_add(&mask_rout_param, NULL);
     }
 
+#if RECT_MASK_CACHE
+    /*Only the radius mask is applied on the corners, so they can be reused*/
+    const rect_mask_entry_t * mask_cache = NULL;
+    if(!mask_any && rout > 0) mask_cache = rect_mask_get(&bg_coords, NULL, rout, -1);
+#endif
+
     int32_t h;
 
     lv_area_t blend_area;
@@ -245,11 +311,20 @@ static void draw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, co
         lv_coord_t bottom_y = bg_coords.y2 - h;
         if(top_y < clipped_coords.y1 && bottom_y > clipped_coords.y2) continue;   /*This line is clipped now*/
 
-        /* Initialize the mask to opa instead of 0xFF and blend with LV_OPA_COVER.
-         * It saves calculating the final opa in lv_draw_sw_blend*/
-        lv_memset(mask_buf, opa, clipped_w);
-        blend_dsc.mask_res = lv_draw_mask_apply(mask_buf, blend_area.x1, top_y, clipped_w);
-        if(blend_dsc.mask_res == LV_DRAW_MASK_RES_FULL_COVER) blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+#if RECT_MASK_CACHE
+        if(mask_cache) {
+            rect_mask_line(mask_cache, h, blend_area.x1 - bg_coords.x1, clipped_w, opa, mask_buf);
+            blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+        }
+        else
+#endif
+        {
+            /* Initialize the mask to opa instead of 0xFF and blend with LV_OPA_COVER.
+             * It saves calculating the final opa in lv_draw_sw_blend*/
+            lv_memset(mask_buf, opa, clipped_w);
+            blend_dsc.mask_res = lv_draw_mask_apply(mask_buf, blend_area.x1, top_y, clipped_w);
+            if(blend_dsc.mask_res == LV_DRAW_MASK_RES_FULL_COVER) blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+        }
 
         if(top_y >= clipped_coords.y1) {
             blend_area.y1 = top_y;
@@ -1190,6 +1265,13 @@ void draw_border_generic(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area,
     lv_draw_mask_radius_init(&mask_rin_param, inner_area, rin, true);
     int16_t mask_rin_id = lv_draw_mask_add(&mask_rin_param, NULL);
 
+    /*The rows in the corners of the outer radius can be reused if there are no other masks*/
+    const void * mask_cache = NULL;
+    lv_coord_t rout_mask = rout > 0 ? mask_rout_param.cfg.radius : 0;
+#if RECT_MASK_CACHE
+    if(!mask_any && rout_mask > 0) mask_cache = rect_mask_get(outer_area, inner_area, rout_mask, rin);
+#endif
+
     int32_t h;
     lv_area_t blend_area;
     blend_dsc.blend_area = &blend_area;
@@ -1293,8 +1375,8 @@ void draw_border_generic(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area,
             lv_coord_t bottom_y = outer_area->y2 - h;
             if(top_y < draw_area.y1 && bottom_y > draw_area.y2) continue;   /*This line is clipped now*/
 
-            lv_memset_ff(blend_dsc.mask_buf, draw_area_w);
-            blend_dsc.mask_res = lv_draw_mask_apply(blend_dsc.mask_buf, blend_area.x1, top_y, draw_area_w);
+            blend_dsc.mask_res = border_mask_line(mask_cache, outer_area, rout_mask, blend_dsc.mask_buf,
+                                                  blend_area.x1, top_y, draw_area_w);
 
             if(top_y >= draw_area.y1) {
                 blend_area.y1 = top_y;
@@ -1320,8 +1402,8 @@ void draw_border_generic(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area,
                     blend_area.y1 = h;
                     blend_area.y2 = h;
 
-                    lv_memset_ff(blend_dsc.mask_buf, blend_w);
-                    blend_dsc.mask_res = lv_draw_mask_apply(blend_dsc.mask_buf, blend_area.x1, h, blend_w);
+                    blend_dsc.mask_res = border_mask_line(mask_cache, outer_area, rout_mask, blend_dsc.mask_buf,
+                                                          blend_area.x1, h, blend_w);
                     lv_draw_sw_blend(draw_ctx, &blend_dsc);
                 }
             }
@@ -1331,8 +1413,8 @@ void draw_border_generic(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area,
                     blend_area.y1 = h;
                     blend_area.y2 = h;
 
-                    lv_memset_ff(blend_dsc.mask_buf, blend_w);
-                    blend_dsc.mask_res = lv_draw_mask_apply(blend_dsc.mask_buf, blend_area.x1, h, blend_w);
+                    blend_dsc.mask_res = border_mask_line(mask_cache, outer_area, rout_mask, blend_dsc.mask_buf,
+                                                          blend_area.x1, h, blend_w);
                     lv_draw_sw_blend(draw_ctx, &blend_dsc);
                 }
             }
@@ -1349,8 +1431,8 @@ void draw_border_generic(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area,
                     blend_area.y1 = h;
                     blend_area.y2 = h;
 
-                    lv_memset_ff(blend_dsc.mask_buf, blend_w);
-                    blend_dsc.mask_res = lv_draw_mask_apply(blend_dsc.mask_buf, blend_area.x1, h, blend_w);
+                    blend_dsc.mask_res = border_mask_line(mask_cache, outer_area, rout_mask, blend_dsc.mask_buf,
+                                                          blend_area.x1, h, blend_w);
                     lv_draw_sw_blend(draw_ctx, &blend_dsc);
                 }
             }
@@ -1360,8 +1442,8 @@ void draw_border_generic(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area,
                     blend_area.y1 = h;
                     blend_area.y2 = h;
 
-                    lv_memset_ff(blend_dsc.mask_buf, blend_w);
-                    blend_dsc.mask_res = lv_draw_mask_apply(blend_dsc.mask_buf, blend_area.x1, h, blend_w);
+                    blend_dsc.mask_res = border_mask_line(mask_cache, outer_area, rout_mask, blend_dsc.mask_buf,
+                                                          blend_area.x1, h, blend_w);
                     lv_draw_sw_blend(draw_ctx, &blend_dsc);
                 }
             }
@@ -1434,3 +1516,167 @@ static void draw_border_simple(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer
     }
 }
 
+#if LV_DRAW_COMPLEX
+/**
+ * Get the mask of a border line: from the cached corner rows if `mask_cache` has them,
+ * else by applying the outer and inner masks.
+ */
+static lv_draw_mask_res_t border_mask_line(const void * mask_cache, const lv_area_t * outer_area, lv_coord_t rout,
+                                           lv_opa_t * mask_buf, lv_coord_t abs_x, lv_coord_t abs_y, lv_coord_t len)
+{
+#if RECT_MASK_CACHE
+    if(mask_cache) {
+        int32_t row = -1;
+        if(abs_y - outer_area->y1 < rout) row = abs_y - outer_area->y1;
+        else if(outer_area->y2 - abs_y < rout) row = rout + outer_area->y2 - abs_y;
+
+        /*The outer radius mask always changes the corner rows*/
+        if(row >= 0) {
+            rect_mask_line(mask_cache, row, abs_x - outer_area->x1, len, LV_OPA_COVER, mask_buf);
+            return LV_DRAW_MASK_RES_CHANGED;
+        }
+    }
+#else
+    LV_UNUSED(mask_cache);
+    LV_UNUSED(outer_area);
+    LV_UNUSED(rout);
+#endif
+
+    lv_memset_ff(mask_buf, len);
+    return lv_draw_mask_apply(mask_buf, abs_x, abs_y, len);
+}
+#endif /*LV_DRAW_COMPLEX*/
+
+#if RECT_MASK_CACHE
+/**
+ * Find or create the cached corner rows of a rounded rectangle.
+ * The masks of the rectangle have to be added and no other masks can be active.
+ * @param outer_area    the rectangle
+ * @param inner_area    the inner area of a border, NULL for a background
+ * @param rout          radius of the rectangle
+ * @param rin           radius of the inner area, ignored for a background
+ * @return              the entry or NULL if the cache is disabled or out of memory
+ */
+static rect_mask_entry_t * rect_mask_get(const lv_area_t * outer_area, const lv_area_t * inner_area, lv_coord_t rout,
+                                         lv_coord_t rin)
+{
+    if(!rect_mask_cache_en) return NULL;
+
+    lv_coord_t w = lv_area_get_width(outer_area);
+    lv_coord_t h = lv_area_get_height(outer_area);
+    lv_area_t inner = {0};
+    if(inner_area) {
+        inner.x1 = inner_area->x1 - outer_area->x1;
+        inner.y1 = inner_area->y1 - outer_area->y1;
+        inner.x2 = outer_area->x2 - inner_area->x2;
+        inner.y2 = outer_area->y2 - inner_area->y2;
+    }
+    else {
+        rin = -1;
+    }
+
+    uint32_t i;
+    rect_mask_entry_t * entry = NULL;
+    for(i = 0; i < LV_RECT_MASK_CACHE_SIZE; i++) {
+        rect_mask_entry_t * e = &rect_mask_cache[i];
+        if(e->rows && e->w == w && e->h == h && e->rout == rout && e->rin == rin &&
+           _lv_area_is_equal(&e->inner, &inner)) {
+            if(e->life < RECT_MASK_LIFE_MAX) e->life++;
+            return e;
+        }
+        /*Prefer a free entry, else the least used one*/
+        if(entry == NULL || (entry->rows && (e->rows == NULL || e->life < entry->life))) entry = e;
+    }
+
+    /*Not found: replace that entry. Age the others so new shapes can get in too*/
+    for(i = 0; i < LV_RECT_MASK_CACHE_SIZE; i++) {
+        if(rect_mask_cache[i].life > 0) rect_mask_cache[i].life--;
+    }
+    rect_mask_free(entry);
+
+    int32_t row_cnt = inner_area ? 2 * rout : rout;
+    lv_opa_t * line = lv_mem_buf_get(w);
+    entry->rows = lv_mem_alloc(row_cnt * sizeof(rect_mask_row_t));
+    entry->buf = lv_mem_alloc(row_cnt * w);
+    if(entry->rows == NULL || entry->buf == NULL) {
+        rect_mask_free(entry);
+        lv_mem_buf_release(line);
+        return NULL;
+    }
+
+    uint32_t ofs = 0;
+    int32_t row;
+    for(row = 0; row < row_cnt; row++) {
+        lv_coord_t y = row < rout ? outer_area->y1 + row : outer_area->y2 - (row - rout);
+        lv_memset_ff(line, w);
+        lv_draw_mask_apply(line, outer_area->x1, y, w);
+
+        /*Grow the middle from the center while it has the same coverage*/
+        rect_mask_row_t * r = &entry->rows[row];
+        lv_coord_t mid_x1 = w >> 1;
+        lv_coord_t mid_x2 = w >> 1;
+        r->mid = line[mid_x1];
+        while(mid_x1 > 0 && line[mid_x1 - 1] == r->mid) mid_x1--;
+        while(mid_x2 < w - 1 && line[mid_x2 + 1] == r->mid) mid_x2++;
+
+        r->ofs = ofs;
+        r->left = mid_x1;
+        r->right = w - 1 - mid_x2;
+        lv_memcpy(entry->buf + ofs, line, r->left);
+        ofs += r->left;
+        lv_memcpy(entry->buf + ofs, line + mid_x2 + 1, r->right);
+        ofs += r->right;
+    }
+    lv_mem_buf_release(line);
+
+    /*Keep only the spans*/
+    lv_opa_t * buf = lv_mem_realloc(entry->buf, LV_MAX(ofs, 1));
+    if(buf) entry->buf = buf;
+
+    entry->w = w;
+    entry->h = h;
+    entry->rout = rout;
+    entry->rin = rin;
+    entry->inner = inner;
+    entry->life = 1;
+    return entry;
+}
+
+static void rect_mask_free(rect_mask_entry_t * e)
+{
+    if(e->rows) lv_mem_free(e->rows);
+    if(e->buf) lv_mem_free(e->buf);
+    lv_memset_00(e, sizeof(rect_mask_entry_t));
+}
+
+/**
+ * Write a part of a cached corner row to a mask buffer
+ * @param e         the cache entry
+ * @param row       index of the row in the entry
+ * @param x         first pixel to write, relative to the left side of the rectangle
+ * @param len       number of pixels to write
+ * @param opa       scale the coverage by this opacity (like the mask buffer was initialized to `opa`)
+ * @param mask_buf  store the result here
+ */
+static void rect_mask_line(const rect_mask_entry_t * e, int32_t row, lv_coord_t x, lv_coord_t len, lv_opa_t opa,
+                           lv_opa_t * mask_buf)
+{
+    const rect_mask_row_t * r = &e->rows[row];
+    const lv_opa_t * span = e->buf + r->ofs;
+    int32_t right_ofs = r->left - (e->w - r->right);    /*Index of pixel `x` of the right span is `right_ofs + x`*/
+    lv_coord_t mid_x1 = LV_CLAMP(0, r->left - x, len);
+    lv_coord_t mid_x2 = LV_CLAMP(mid_x1, e->w - r->right - x, len);
+    lv_coord_t i;
+
+    if(opa >= LV_OPA_COVER) {
+        if(mid_x1 > 0) lv_memcpy(mask_buf, span + x, mid_x1);
+        lv_memset(mask_buf + mid_x1, r->mid, mid_x2 - mid_x1);
+        if(len > mid_x2) lv_memcpy(mask_buf + mid_x2, span + right_ofs + x + mid_x2, len - mid_x2);
+    }
+    else {
+        for(i = 0; i < mid_x1; i++) mask_buf[i] = LV_UDIV255(span[x + i] * opa);
+        lv_memset(mask_buf + mid_x1, LV_UDIV255(r->mid * opa), mid_x2 - mid_x1);
+        for(i = mid_x2; i < len; i++) mask_buf[i] = LV_UDIV255(span[right_ofs + x + i] * opa);
+    }
+}
+#endif /*RECT_MASK_CACHE*/
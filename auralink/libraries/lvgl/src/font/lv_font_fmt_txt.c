@@ -32,7 +32,13 @@ typedef enum {
  *  STATIC PROTOTYPES
  **********************/
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+static uint32_t search_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter);
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
+static int8_t get_kern_class_value(const lv_font_fmt_txt_kern_classes_t * kdsc, uint8_t left_class,
+                                   uint8_t right_class);
+#if LV_FONT_FMT_TXT_LUT
+    static const lv_font_fmt_txt_lut_entry_t * get_lut(const lv_font_fmt_txt_dsc_t * fdsc);
+#endif
 static int32_t unicode_list_compare(const void * ref, const void * element);
 static int32_t kern_pair_8_compare(const void * ref, const void * element);
 static int32_t kern_pair_16_compare(const void * ref, const void * element);
@@ -58,6 +64,10 @@ static int32_t kern_pair_16_compare(const void * ref, const void * element);
     static rle_state_t rle_state;
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#if LV_FONT_FMT_TXT_LUT
+    static bool lut_en = true;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -159,9 +169,21 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
 
     int8_t kvalue = 0;
     if(fdsc->kern_dsc) {
-        uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
-        if(gid_next) {
-            kvalue = get_kern_value(font, gid, gid_next);
+#if LV_FONT_FMT_TXT_LUT
+        /*Both classes are in the table, so the next letter's glyph id isn't needed.
+         *A letter not in the font has class 0 like in `get_kern_value`*/
+        const lv_font_fmt_txt_lut_entry_t * lut = fdsc->kern_classes ? get_lut(fdsc) : NULL;
+        if(lut && unicode_letter < LV_FONT_FMT_TXT_LUT_SIZE && unicode_letter_next < LV_FONT_FMT_TXT_LUT_SIZE) {
+            kvalue = get_kern_class_value(fdsc->kern_dsc, lut[unicode_letter].left_class,
+                                          lut[unicode_letter_next].right_class);
+        }
+        else
+#endif
+        {
+            uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
+            if(gid_next) {
+                kvalue = get_kern_value(font, gid, gid_next);
+            }
         }
     }
 
@@ -202,6 +224,15 @@ void _lv_font_clean_up_fmt_txt(void)
 #endif
 }
 
+void lv_font_fmt_txt_enable_lut(bool en)
+{
+#if LV_FONT_FMT_TXT_LUT
+    lut_en = en;
+#else
+    LV_UNUSED(en);
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -212,9 +243,34 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
 
+#if LV_FONT_FMT_TXT_LUT
+    if(letter < LV_FONT_FMT_TXT_LUT_SIZE) {
+        const lv_font_fmt_txt_lut_entry_t * lut = get_lut(fdsc);
+        if(lut && lut[letter].glyph_id != UINT16_MAX) return lut[letter].glyph_id;
+    }
+#endif
+
     /*Check the cache first*/
     if(fdsc->cache && letter == fdsc->cache->last_letter) return fdsc->cache->last_glyph_id;
 
+    uint32_t glyph_id = search_glyph_dsc_id(fdsc, letter);
+
+    /*Update the cache*/
+    if(fdsc->cache) {
+        fdsc->cache->last_letter = letter;
+        fdsc->cache->last_glyph_id = glyph_id;
+    }
+    return glyph_id;
+}
+
+/**
+ * Find the glyph id of a letter in the cmaps
+ * @param fdsc      pointer to the font's descriptor
+ * @param letter    a UNICODE letter code
+ * @return          the glyph id or 0 if the letter is not in the font
+ */
+static uint32_t search_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter)
+{
     uint16_t i;
     for(i = 0; i < fdsc->cmap_num; i++) {
 
@@ -251,21 +307,44 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
             }
         }
 
-        /*Update the cache*/
-        if(fdsc->cache) {
-            fdsc->cache->last_letter = letter;
-            fdsc->cache->last_glyph_id = glyph_id;
-        }
         return glyph_id;
     }
 
-    if(fdsc->cache) {
-        fdsc->cache->last_letter = letter;
-        fdsc->cache->last_glyph_id = 0;
-    }
     return 0;
+}
+
+#if LV_FONT_FMT_TXT_LUT
+/**
+ * Get the glyph table of a font, building it on the first call
+ * @param fdsc      pointer to the font's descriptor
+ * @return          the table or NULL if it's disabled, the font has no cache or there is no memory for it
+ */
+static const lv_font_fmt_txt_lut_entry_t * get_lut(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    if(!lut_en || fdsc->cache == NULL) return NULL;
+    if(fdsc->cache->lut) return fdsc->cache->lut;
+
+    lv_font_fmt_txt_lut_entry_t * lut = lv_mem_alloc(LV_FONT_FMT_TXT_LUT_SIZE * sizeof(lv_font_fmt_txt_lut_entry_t));
+    LV_ASSERT_MALLOC(lut);
+    if(lut == NULL) return NULL;
+    lv_memset_00(lut, LV_FONT_FMT_TXT_LUT_SIZE * sizeof(lv_font_fmt_txt_lut_entry_t));
+
+    const lv_font_fmt_txt_kern_classes_t * kdsc = fdsc->kern_dsc && fdsc->kern_classes ? fdsc->kern_dsc : NULL;
+    uint32_t letter;
+    for(letter = 1; letter < LV_FONT_FMT_TXT_LUT_SIZE; letter++) {
+        uint32_t gid = search_glyph_dsc_id(fdsc, letter);
+        if(gid == 0) continue;
+        lut[letter].glyph_id = gid < UINT16_MAX ? (uint16_t)gid : UINT16_MAX;
+        if(kdsc) {
+            lut[letter].left_class = kdsc->left_class_mapping[gid];
+            lut[letter].right_class = kdsc->right_class_mapping[gid];
+        }
+    }
 
+    fdsc->cache->lut = lut;
+    return lut;
 }
+#endif /*LV_FONT_FMT_TXT_LUT*/
 
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right)
 {
@@ -310,19 +389,22 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
     else {
         /*Kern classes*/
         const lv_font_fmt_txt_kern_classes_t * kdsc = fdsc->kern_dsc;
-        uint8_t left_class = kdsc->left_class_mapping[gid_left];
-        uint8_t right_class = kdsc->right_class_mapping[gid_right];
-
-        /*If class = 0, kerning not exist for that glyph
-         *else got the value form `class_pair_values` 2D array*/
-        if(left_class > 0 && right_class > 0) {
-            value = kdsc->class_pair_values[(left_class - 1) * kdsc->right_class_cnt + (right_class - 1)];
-        }
-
+        value = get_kern_class_value(kdsc, kdsc->left_class_mapping[gid_left], kdsc->right_class_mapping[gid_right]);
     }
     return value;
 }
 
+static int8_t get_kern_class_value(const lv_font_fmt_txt_kern_classes_t * kdsc, uint8_t left_class,
+                                   uint8_t right_class)
+{
+    /*If class = 0, kerning not exist for that glyph
+     *else got the value form `class_pair_values` 2D array*/
+    if(left_class > 0 && right_class > 0) {
+        return kdsc->class_pair_values[(left_class - 1) * kdsc->right_class_cnt + (right_class - 1)];
+    }
+    return 0;
+}
+
 static int32_t kern_pair_8_compare(const void * ref, const void * element)
 {
     const uint8_t * ref8_p = ref;
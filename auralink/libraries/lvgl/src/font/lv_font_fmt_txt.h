@@ -22,6 +22,11 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#if LV_FONT_FMT_TXT_LUT
+/*Code points 0..LV_FONT_FMT_TXT_LUT_SIZE-1 are looked up in the font's table*/
+#define LV_FONT_FMT_TXT_LUT_SIZE 256
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -151,9 +156,21 @@ typedef enum {
     LV_FONT_FMT_TXT_COMPRESSED_NO_PREFILTER = 1,
 } lv_font_fmt_txt_bitmap_format_t;
 
+#if LV_FONT_FMT_TXT_LUT
+/*Glyph id and kerning classes of a code point below `LV_FONT_FMT_TXT_LUT_SIZE`*/
+typedef struct {
+    uint16_t glyph_id;      /*0: not in the font; 0xFFFF: too large, search the cmaps*/
+    uint8_t left_class;     /*Kerning classes, 0 if none or the font uses kerning pairs*/
+    uint8_t right_class;
+} lv_font_fmt_txt_lut_entry_t;
+#endif
+
 typedef struct {
     uint32_t last_letter;
     uint32_t last_glyph_id;
+#if LV_FONT_FMT_TXT_LUT
+    lv_font_fmt_txt_lut_entry_t * lut;  /*Built on the first lookup, NULL until then*/
+#endif
 } lv_font_fmt_txt_glyph_cache_t;
 
 /*Describe store additional data for fonts*/
@@ -225,6 +242,14 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
  */
 void _lv_font_clean_up_fmt_txt(void);
 
+/**
+ * Enable or disable the glyph tables of `LV_FONT_FMT_TXT_LUT`. Enabled by default.
+ * Disabling keeps the tables already built. The glyphs and kerning are the same either way.
+ * @param en        true: look up code points below `LV_FONT_FMT_TXT_LUT_SIZE` in the font's table;
+ *                  false: search the cmaps and kerning tables for every letter
+ */
+void lv_font_fmt_txt_enable_lut(bool en);
+
 /**********************
  *      MACROS
  **********************/
@@ -220,6 +220,26 @@
     #endif
 #endif
 
+/*Join invalidated areas by cost, not only when they overlap. An area costs its pixels plus
+ *LV_DISP_INV_AREA_COST per flushed chunk. With a full area buffer a new area is joined into
+ *the cheapest one instead of redrawing the whole screen*/
+#ifndef LV_DISP_INV_AREA_MERGE
+    #ifdef CONFIG_LV_DISP_INV_AREA_MERGE
+        #define LV_DISP_INV_AREA_MERGE CONFIG_LV_DISP_INV_AREA_MERGE
+    #else
+        #define LV_DISP_INV_AREA_MERGE 0
+    #endif
+#endif
+#if LV_DISP_INV_AREA_MERGE
+    #ifndef LV_DISP_INV_AREA_COST
+        #ifdef CONFIG_LV_DISP_INV_AREA_COST
+            #define LV_DISP_INV_AREA_COST CONFIG_LV_DISP_INV_AREA_COST
+        #else
+            #define LV_DISP_INV_AREA_COST 128   /*[px]*/
+        #endif
+    #endif
+#endif
+
 /*Input device read period in milliseconds*/
 #ifndef LV_INDEV_DEF_READ_PERIOD
     #ifdef CONFIG_LV_INDEV_DEF_READ_PERIOD
@@ -229,6 +249,17 @@
     #endif
 #endif
 
+/*Keep the timers in a min-heap by due time. `lv_timer_handler` then only looks at the timers that are due
+ *and tells the time until the next one without walking the list. Due timers run in due time order.
+ *Timer periods must stay below 2^31 ms*/
+#ifndef LV_TIMER_HEAP
+    #ifdef CONFIG_LV_TIMER_HEAP
+        #define LV_TIMER_HEAP CONFIG_LV_TIMER_HEAP
+    #else
+        #define LV_TIMER_HEAP 0
+    #endif
+#endif
+
 /*Use a custom tick source that tells the elapsed time in milliseconds.
  *It removes the need to manually update the tick with `lv_tick_inc()`)*/
 #ifndef LV_TICK_CUSTOM
@@ -313,8 +344,73 @@
             #define LV_CIRCLE_CACHE_SIZE 4
         #endif
     #endif
+
+    /* Set number of maximally cached rounded rectangle masks.
+    * The anti-aliased corner rows of backgrounds and borders are saved per size, radius and border width
+    * and reused when the same shape is drawn again in any color or position
+    * 0: to disable caching */
+    #ifndef LV_RECT_MASK_CACHE_SIZE
+        #ifdef CONFIG_LV_RECT_MASK_CACHE_SIZE
+            #define LV_RECT_MASK_CACHE_SIZE CONFIG_LV_RECT_MASK_CACHE_SIZE
+        #else
+            #define LV_RECT_MASK_CACHE_SIZE 0
+        #endif
+    #endif
 #endif /*LV_DRAW_COMPLEX*/
 
+/*Fill 16 bit colors with opacity two pixels per 32 bit word, each channel of both mixed in one multiplication.
+ *Gives the same pixels as the one pixel loop*/
+#ifndef LV_DRAW_SW_BLEND_SWAR
+    #ifdef CONFIG_LV_DRAW_SW_BLEND_SWAR
+        #define LV_DRAW_SW_BLEND_SWAR CONFIG_LV_DRAW_SW_BLEND_SWAR
+    #else
+        #define LV_DRAW_SW_BLEND_SWAR 0
+    #endif
+#endif
+
+/*Keep the anti-aliased glyphs drawn by the software renderer as ready to blend A8 rasters, least recently used
+ *out first. Keyed by font, letter and text opacity, so a glyph is decoded once in any color or position.
+ *LV_GLYPH_CACHE_SIZE: [bytes] of rasters in the cache, 0 to disable it
+ *LV_GLYPH_CACHE_MAX_GLYPH: [bytes] larger glyphs are drawn from the font every time*/
+#ifndef LV_GLYPH_CACHE_SIZE
+    #ifdef CONFIG_LV_GLYPH_CACHE_SIZE
+        #define LV_GLYPH_CACHE_SIZE CONFIG_LV_GLYPH_CACHE_SIZE
+    #else
+        #define LV_GLYPH_CACHE_SIZE 0
+    #endif
+#endif
+#if LV_GLYPH_CACHE_SIZE
+    #ifndef LV_GLYPH_CACHE_MAX_GLYPH
+        #ifdef CONFIG_LV_GLYPH_CACHE_MAX_GLYPH
+            #define LV_GLYPH_CACHE_MAX_GLYPH CONFIG_LV_GLYPH_CACHE_MAX_GLYPH
+        #else
+            #define LV_GLYPH_CACHE_MAX_GLYPH 512
+        #endif
+    #endif
+#endif
+
+/*Keep zoomed or rotated images in their final form: transformed and recolored RGB565A8 pixels, blended with
+ *the image's opacity on every draw. Keyed by image, zoom, angle, pivot and recolor, so a fade reuses the same entry.
+ *Images are cached when drawn the second time, least recently used out first. Needs LV_COLOR_DEPTH 16.
+ *LV_IMG_TRANSFORM_CACHE_SIZE: [bytes] of images in the cache, 0 to disable it
+ *LV_IMG_TRANSFORM_CACHE_MAX_IMG: [bytes] larger images are transformed on every draw*/
+#ifndef LV_IMG_TRANSFORM_CACHE_SIZE
+    #ifdef CONFIG_LV_IMG_TRANSFORM_CACHE_SIZE
+        #define LV_IMG_TRANSFORM_CACHE_SIZE CONFIG_LV_IMG_TRANSFORM_CACHE_SIZE
+    #else
+        #define LV_IMG_TRANSFORM_CACHE_SIZE 0
+    #endif
+#endif
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    #ifndef LV_IMG_TRANSFORM_CACHE_MAX_IMG
+        #ifdef CONFIG_LV_IMG_TRANSFORM_CACHE_MAX_IMG
+            #define LV_IMG_TRANSFORM_CACHE_MAX_IMG CONFIG_LV_IMG_TRANSFORM_CACHE_MAX_IMG
+        #else
+            #define LV_IMG_TRANSFORM_CACHE_MAX_IMG (4U * 1024U)
+        #endif
+    #endif
+#endif
+
 /**
  * "Simple layers" are used when a widget has `style_opa < 255` to buffer the widget into a layer
  * and blend it as an image with the given opacity.
@@ -848,6 +944,35 @@
     #endif
 #endif
 
+/*Cache the resolved style properties of objects per part and state*/
+#ifndef LV_OBJ_STYLE_CACHE
+    #ifdef CONFIG_LV_OBJ_STYLE_CACHE
+        #define LV_OBJ_STYLE_CACHE CONFIG_LV_OBJ_STYLE_CACHE
+    #else
+        #define LV_OBJ_STYLE_CACHE 0
+    #endif
+#endif
+#if LV_OBJ_STYLE_CACHE
+    /*Number of entries; a power of 2. An entry is 20 bytes on 32-bit targets*/
+    #ifndef LV_OBJ_STYLE_CACHE_SIZE
+        #ifdef CONFIG_LV_OBJ_STYLE_CACHE_SIZE
+            #define LV_OBJ_STYLE_CACHE_SIZE CONFIG_LV_OBJ_STYLE_CACHE_SIZE
+        #else
+            #define LV_OBJ_STYLE_CACHE_SIZE 256
+        #endif
+    #endif
+#endif
+
+/*Keep a mask of the event codes each object has handlers for. Events the object has no handler for
+ *then skip its list of handlers*/
+#ifndef LV_OBJ_EVENT_MASK
+    #ifdef CONFIG_LV_OBJ_EVENT_MASK
+        #define LV_OBJ_EVENT_MASK CONFIG_LV_OBJ_EVENT_MASK
+    #else
+        #define LV_OBJ_EVENT_MASK 0
+    #endif
+#endif
+
 /*Garbage Collector settings
  *Used if lvgl is bound to higher level language and the memory is managed by that language*/
 #ifndef LV_ENABLE_GC
@@ -1229,6 +1354,16 @@
     #endif
 #endif
 
+/*Look up the glyph ids and kerning classes of code points 0..255 in a table per font (1 kB each, built on first use)
+ *instead of searching the cmaps and kerning tables for every letter. Other code points are still searched.*/
+#ifndef LV_FONT_FMT_TXT_LUT
+    #ifdef CONFIG_LV_FONT_FMT_TXT_LUT
+        #define LV_FONT_FMT_TXT_LUT CONFIG_LV_FONT_FMT_TXT_LUT
+    #else
+        #define LV_FONT_FMT_TXT_LUT 0
+    #endif
+#endif
+
 /*Enable subpixel rendering*/
 #ifndef LV_USE_FONT_SUBPX
     #ifdef CONFIG_LV_USE_FONT_SUBPX
@@ -440,11 +440,7 @@ static inline lv_color_t LV_ATTRIBUTE_FAST_MEM lv_color_mix(lv_color_t c1, lv_co
 {
     lv_color_t ret;
 
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_MIX_ROUND_OFS == 0
-#if LV_COLOR_16_SWAP == 1
-    c1.full = c1.full << 8 | c1.full >> 8;
-    c2.full = c2.full << 8 | c2.full >> 8;
-#endif
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_MIX_ROUND_OFS == 0 && LV_COLOR_16_SWAP == 0
     /*Source: https://stackoverflow.com/a/50012418/1999969*/
     mix = (uint32_t)((uint32_t)mix + 4) >> 3;
     uint32_t bg = (uint32_t)((uint32_t)c2.full | ((uint32_t)c2.full << 16)) &
@@ -452,9 +448,17 @@ static inline lv_color_t LV_ATTRIBUTE_FAST_MEM lv_color_mix(lv_color_t c1, lv_co
     uint32_t fg = (uint32_t)((uint32_t)c1.full | ((uint32_t)c1.full << 16)) & 0x7E0F81F;
     uint32_t result = ((((fg - bg) * mix) >> 5) + bg) & 0x7E0F81F;
     ret.full = (uint16_t)((result >> 16) | result);
-#if LV_COLOR_16_SWAP == 1
-    ret.full = ret.full << 8 | ret.full >> 8;
-#endif
+#elif LV_COLOR_DEPTH == 16 && LV_COLOR_MIX_ROUND_OFS == 0
+    /*Same trick on the swapped layout (GGGBBBBB RRRRRGGG) without swapping back and forth.
+     *Doubling the word and shifting it right by 3 lines the fields up as R at bit 0,
+     *G (its low and high halves now adjacent) at bit 10 and B at bit 21,
+     *each with at least 5 bits of headroom above it.*/
+    mix = (uint32_t)((uint32_t)mix + 4) >> 3;
+    uint32_t bg = (((uint32_t)c2.full | ((uint32_t)c2.full << 16)) >> 3) &
+                  0x3E0FC1F; /*0b00000011111000001111110000011111*/
+    uint32_t fg = (((uint32_t)c1.full | ((uint32_t)c1.full << 16)) >> 3) & 0x3E0FC1F;
+    uint32_t result = ((((fg - bg) * mix) >> 5) + bg) & 0x3E0FC1F;
+    ret.full = (uint16_t)((result << 3) | (result >> 13));
 #elif LV_COLOR_DEPTH != 1
     /*LV_COLOR_DEPTH == 8, 16 or 32*/
     LV_COLOR_SET_R(ret, LV_UDIV255((uint16_t)LV_COLOR_GET_R(c1) * mix + LV_COLOR_GET_R(c2) *
@@ -25,8 +25,19 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static uint32_t lv_timer_run_list(void);
 static bool lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
+#if LV_TIMER_HEAP
+    static uint32_t lv_timer_run_heap(void);
+    static bool heap_reserve(uint32_t cnt);
+    static void heap_rebuild(void);
+    static void heap_insert(lv_timer_t * timer);
+    static void heap_remove(lv_timer_t * timer);
+    static void heap_update(lv_timer_t * timer);
+    static uint32_t heap_up(uint32_t idx);
+    static void heap_down(uint32_t idx);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -35,6 +46,14 @@ static bool lv_timer_run = false;
 static uint8_t idle_last = 0;
 static bool timer_deleted;
 static bool timer_created;
+#if LV_TIMER_HEAP
+    static bool heap_en = true;
+    static uint32_t heap_cnt;       /*Timers in `_lv_timer_heap`: the ones not paused*/
+    static uint32_t heap_ran_cnt;   /*Timers that ran in this `lv_timer_handler` call, kept after the heap*/
+    static uint32_t heap_cap;       /*Slots in `_lv_timer_heap`, kept at least `timer_cnt`*/
+    static uint32_t timer_cnt;
+    static uint32_t timer_seq;
+#endif
 
 /**********************
  *      MACROS
@@ -55,6 +74,13 @@ static bool timer_created;
 void _lv_timer_core_init(void)
 {
     _lv_ll_init(&LV_GC_ROOT(_lv_timer_ll), sizeof(lv_timer_t));
+#if LV_TIMER_HEAP
+    LV_GC_ROOT(_lv_timer_heap) = NULL;
+    heap_cnt = 0;
+    heap_ran_cnt = 0;
+    heap_cap = 0;
+    timer_cnt = 0;
+#endif
 
     /*Initially enable the lv_timer handling*/
     lv_timer_enable(true);
@@ -95,40 +121,11 @@ uint32_t LV_ATTRIBUTE_TIMER_HANDLER lv_timer_handler(void)
         }
     }
 
-    /*Run all timer from the list*/
-    lv_timer_t * next;
-    do {
-        timer_deleted             = false;
-        timer_created             = false;
-        LV_GC_ROOT(_lv_timer_act) = _lv_ll_get_head(&LV_GC_ROOT(_lv_timer_ll));
-        while(LV_GC_ROOT(_lv_timer_act)) {
-            /*The timer might be deleted if it runs only once ('repeat_count = 1')
-             *So get next element until the current is surely valid*/
-            next = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), LV_GC_ROOT(_lv_timer_act));
-
-            if(lv_timer_exec(LV_GC_ROOT(_lv_timer_act))) {
-                /*If a timer was created or deleted then this or the next item might be corrupted*/
-                if(timer_created || timer_deleted) {
-                    TIMER_TRACE("Start from the first timer again because a timer was created or deleted");
-                    break;
-                }
-            }
-
-            LV_GC_ROOT(_lv_timer_act) = next; /*Load the next timer*/
-        }
-    } while(LV_GC_ROOT(_lv_timer_act));
-
-    uint32_t time_till_next = LV_NO_TIMER_READY;
-    next = _lv_ll_get_head(&LV_GC_ROOT(_lv_timer_ll));
-    while(next) {
-        if(!next->paused) {
-            uint32_t delay = lv_timer_time_remaining(next);
-            if(delay < time_till_next)
-                time_till_next = delay;
-        }
-
-        next = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), next); /*Find the next timer*/
-    }
+#if LV_TIMER_HEAP
+    uint32_t time_till_next = heap_en ? lv_timer_run_heap() : lv_timer_run_list();
+#else
+    uint32_t time_till_next = lv_timer_run_list();
+#endif
 
     busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(idle_period_start);
@@ -179,6 +176,21 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
 
+#if LV_TIMER_HEAP
+    new_timer->heap_idx = LV_TIMER_HEAP_NONE;
+    new_timer->seq = timer_seq++;
+    timer_cnt++;
+    if(heap_en) {
+        if(!heap_reserve(timer_cnt)) {
+            timer_cnt--;
+            _lv_ll_remove(&LV_GC_ROOT(_lv_timer_ll), new_timer);
+            lv_mem_free(new_timer);
+            return NULL;
+        }
+        heap_insert(new_timer);
+    }
+#endif
+
     timer_created = true;
 
     return new_timer;
@@ -202,6 +214,14 @@ void lv_timer_del(lv_timer_t * timer)
 {
     _lv_ll_remove(&LV_GC_ROOT(_lv_timer_ll), timer);
     timer_deleted = true;
+#if LV_TIMER_HEAP
+    timer_cnt--;
+    if(heap_en) {
+        heap_remove(timer);
+        /*Tell `lv_timer_run_heap` that the running timer is gone*/
+        if(LV_GC_ROOT(_lv_timer_act) == timer) LV_GC_ROOT(_lv_timer_act) = NULL;
+    }
+#endif
 
     lv_mem_free(timer);
 }
@@ -213,11 +233,17 @@ void lv_timer_del(lv_timer_t * timer)
 void lv_timer_pause(lv_timer_t * timer)
 {
     timer->paused = true;
+#if LV_TIMER_HEAP
+    if(heap_en) heap_remove(timer);
+#endif
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     timer->paused = false;
+#if LV_TIMER_HEAP
+    if(heap_en) heap_insert(timer);
+#endif
 }
 
 /**
@@ -228,6 +254,9 @@ void lv_timer_resume(lv_timer_t * timer)
 void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     timer->period = period;
+#if LV_TIMER_HEAP
+    if(heap_en) heap_update(timer);
+#endif
 }
 
 /**
@@ -237,6 +266,9 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 void lv_timer_ready(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get() - timer->period - 1;
+#if LV_TIMER_HEAP
+    if(heap_en) heap_update(timer);
+#endif
 }
 
 /**
@@ -247,6 +279,10 @@ void lv_timer_ready(lv_timer_t * timer)
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     timer->repeat_count = repeat_count;
+#if LV_TIMER_HEAP
+    /*The list walk deletes a timer with no repeats left on the next call. Make it due for the same*/
+    if(heap_en && repeat_count == 0) lv_timer_ready(timer);
+#endif
 }
 
 /**
@@ -257,6 +293,9 @@ void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 void lv_timer_reset(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get();
+#if LV_TIMER_HEAP
+    if(heap_en) heap_update(timer);
+#endif
 }
 
 /**
@@ -288,10 +327,72 @@ lv_timer_t * lv_timer_get_next(lv_timer_t * timer)
     else return _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), timer);
 }
 
+void lv_timer_enable_heap(bool en)
+{
+#if LV_TIMER_HEAP
+    if(en == heap_en) return;
+    if(en) {
+        heap_rebuild();
+        return;
+    }
+    heap_en = false;
+    lv_mem_free(LV_GC_ROOT(_lv_timer_heap));
+    LV_GC_ROOT(_lv_timer_heap) = NULL;
+    heap_cnt = 0;
+    heap_cap = 0;
+#else
+    LV_UNUSED(en);
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Walk the list of timers and run the ones that are due
+ * @return the time until the next timer is due
+ */
+static uint32_t lv_timer_run_list(void)
+{
+    /*Run all timer from the list*/
+    lv_timer_t * next;
+    do {
+        timer_deleted             = false;
+        timer_created             = false;
+        LV_GC_ROOT(_lv_timer_act) = _lv_ll_get_head(&LV_GC_ROOT(_lv_timer_ll));
+        while(LV_GC_ROOT(_lv_timer_act)) {
+            /*The timer might be deleted if it runs only once ('repeat_count = 1')
+             *So get next element until the current is surely valid*/
+            next = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), LV_GC_ROOT(_lv_timer_act));
+
+            if(lv_timer_exec(LV_GC_ROOT(_lv_timer_act))) {
+                /*If a timer was created or deleted then this or the next item might be corrupted*/
+                if(timer_created || timer_deleted) {
+                    TIMER_TRACE("Start from the first timer again because a timer was created or deleted");
+                    break;
+                }
+            }
+
+            LV_GC_ROOT(_lv_timer_act) = next; /*Load the next timer*/
+        }
+    } while(LV_GC_ROOT(_lv_timer_act));
+
+    uint32_t time_till_next = LV_NO_TIMER_READY;
+    next = _lv_ll_get_head(&LV_GC_ROOT(_lv_timer_ll));
+    while(next) {
+        if(!next->paused) {
+            uint32_t delay = lv_timer_time_remaining(next);
+            if(delay < time_till_next)
+                time_till_next = delay;
+        }
+
+        next = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), next); /*Find the next timer*/
+    }
+
+    return time_till_next;
+}
+
 /**
  * Execute timer if its remaining time is zero
  * @param timer pointer to lv_timer
@@ -339,3 +440,185 @@ static uint32_t lv_timer_time_remaining(lv_timer_t * timer)
         return 0;
     return timer->period - elp;
 }
+
+#if LV_TIMER_HEAP
+/**
+ * Run the due timers from the top of the heap, each at most once like the list walk does
+ * @return the time until the next timer is due
+ */
+static uint32_t lv_timer_run_heap(void)
+{
+    while(heap_cnt) {
+        lv_timer_t * timer = LV_GC_ROOT(_lv_timer_heap)[0];
+        if(lv_timer_time_remaining(timer) != 0) break;
+
+        timer_deleted = false;
+        LV_GC_ROOT(_lv_timer_act) = timer;
+        lv_timer_exec(timer);
+
+        /*Still alive: delete it if the callback deleted an other timer before `lv_timer_exec` could,
+         *else set it aside until the end of the call. Even with a period of 0 it runs only once.*/
+        if(LV_GC_ROOT(_lv_timer_act) == NULL) continue;
+        if(timer->repeat_count == 0) {
+            lv_timer_del(timer);
+        }
+        else if(timer->heap_idx != LV_TIMER_HEAP_NONE) {
+            heap_remove(timer);
+            LV_GC_ROOT(_lv_timer_heap)[heap_cnt + heap_ran_cnt] = timer;
+            timer->heap_idx = heap_cnt + heap_ran_cnt;
+            heap_ran_cnt++;
+        }
+    }
+    LV_GC_ROOT(_lv_timer_act) = NULL;
+
+    /*Put the timers that ran back into the heap at their new due time*/
+    while(heap_ran_cnt) {
+        heap_ran_cnt--;
+        heap_cnt++;
+        heap_up(heap_cnt - 1);
+    }
+
+    return heap_cnt ? lv_timer_time_remaining(LV_GC_ROOT(_lv_timer_heap)[0]) : LV_NO_TIMER_READY;
+}
+
+/**
+ * Tell whether timer `a` runs before timer `b`
+ */
+static inline bool heap_less(const lv_timer_t * a, const lv_timer_t * b)
+{
+    int32_t d = (int32_t)((a->last_run + a->period) - (b->last_run + b->period));
+    if(d != 0) return d < 0;
+    return a->seq > b->seq;
+}
+
+/**
+ * Make room for `cnt` timers in the heap
+ * @param cnt   number of timers
+ * @return      true: there is room; false: out of memory
+ */
+static bool heap_reserve(uint32_t cnt)
+{
+    if(cnt <= heap_cap) return true;
+    uint32_t cap = heap_cap ? heap_cap * 2 : 8;
+    while(cap < cnt) cap *= 2;
+    lv_timer_t ** heap = lv_mem_realloc(LV_GC_ROOT(_lv_timer_heap), cap * sizeof(lv_timer_t *));
+    LV_ASSERT_MALLOC(heap);
+    if(heap == NULL) return false;
+    LV_GC_ROOT(_lv_timer_heap) = heap;
+    heap_cap = cap;
+    return true;
+}
+
+/**
+ * Put every timer that isn't paused into the heap and enable it. Stays with the list if out of memory.
+ */
+static void heap_rebuild(void)
+{
+    if(!heap_reserve(timer_cnt)) return;
+
+    heap_cnt = 0;
+    lv_timer_t * timer;
+    _LV_LL_READ(&LV_GC_ROOT(_lv_timer_ll), timer) {
+        timer->heap_idx = LV_TIMER_HEAP_NONE;
+        if(!timer->paused) heap_insert(timer);
+    }
+    heap_en = true;
+}
+
+static void heap_insert(lv_timer_t * timer)
+{
+    if(timer->heap_idx != LV_TIMER_HEAP_NONE) return;
+    LV_ASSERT(heap_cnt + heap_ran_cnt < heap_cap);
+
+    /*Make room before the timers set aside in `lv_timer_run_heap`*/
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    if(heap_ran_cnt) {
+        heap[heap_cnt + heap_ran_cnt] = heap[heap_cnt];
+        heap[heap_cnt + heap_ran_cnt]->heap_idx = heap_cnt + heap_ran_cnt;
+    }
+
+    heap[heap_cnt] = timer;
+    timer->heap_idx = heap_cnt;
+    heap_cnt++;
+    heap_up(timer->heap_idx);
+}
+
+static void heap_remove(lv_timer_t * timer)
+{
+    uint32_t idx = timer->heap_idx;
+    if(idx == LV_TIMER_HEAP_NONE) return;
+
+    timer->heap_idx = LV_TIMER_HEAP_NONE;
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    if(idx >= heap_cnt) {
+        /*Set aside in `lv_timer_run_heap`: fill the hole with the last one set aside*/
+        heap_ran_cnt--;
+        uint32_t last = heap_cnt + heap_ran_cnt;
+        if(idx != last) {
+            heap[idx] = heap[last];
+            heap[idx]->heap_idx = idx;
+        }
+        return;
+    }
+
+    heap_cnt--;
+    if(idx != heap_cnt) {
+        /*Fill the hole with the last timer*/
+        heap[idx] = heap[heap_cnt];
+        heap[idx]->heap_idx = idx;
+        heap_down(heap_up(idx));
+    }
+
+    /*Close the gap before the timers set aside*/
+    if(heap_ran_cnt) {
+        heap[heap_cnt] = heap[heap_cnt + heap_ran_cnt];
+        heap[heap_cnt]->heap_idx = heap_cnt;
+    }
+}
+
+/**
+ * Move a timer to its place after its due time has changed
+ */
+static void heap_update(lv_timer_t * timer)
+{
+    /*The timers set aside are placed at the end of `lv_timer_run_heap` anyway*/
+    if(timer->heap_idx == LV_TIMER_HEAP_NONE || timer->heap_idx >= heap_cnt) return;
+    heap_down(heap_up(timer->heap_idx));
+}
+
+/**
+ * @return the new index of the timer
+ */
+static uint32_t heap_up(uint32_t idx)
+{
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    lv_timer_t * timer = heap[idx];
+    while(idx > 0) {
+        uint32_t parent = (idx - 1) / 2;
+        if(!heap_less(timer, heap[parent])) break;
+        heap[idx] = heap[parent];
+        heap[idx]->heap_idx = idx;
+        idx = parent;
+    }
+    heap[idx] = timer;
+    timer->heap_idx = idx;
+    return idx;
+}
+
+static void heap_down(uint32_t idx)
+{
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    lv_timer_t * timer = heap[idx];
+    while(1) {
+        uint32_t child = idx * 2 + 1;
+        if(child >= heap_cnt) break;
+        if(child + 1 < heap_cnt && heap_less(heap[child + 1], heap[child])) child++;
+        if(!heap_less(heap[child], timer)) break;
+        heap[idx] = heap[child];
+        heap[idx]->heap_idx = idx;
+        idx = child;
+    }
+    heap[idx] = timer;
+    timer->heap_idx = idx;
+}
+#endif /*LV_TIMER_HEAP*/
@@ -27,6 +27,10 @@ extern "C" {
 
 #define LV_NO_TIMER_READY 0xFFFFFFFF
 
+#if LV_TIMER_HEAP
+#define LV_TIMER_HEAP_NONE 0xFFFFFFFF
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -48,6 +52,10 @@ typedef struct _lv_timer_t {
     void * user_data; /**< Custom user data*/
     int32_t repeat_count; /**< 1: One time;  -1 : infinity;  n>0: residual times*/
     uint32_t paused : 1;
+#if LV_TIMER_HEAP
+    uint32_t heap_idx; /**< Position in the due time heap, `LV_TIMER_HEAP_NONE` if it's not in the heap*/
+    uint32_t seq; /**< Creation order. Of two timers due at the same time the newer runs first, like in the list*/
+#endif
 } lv_timer_t;
 
 /**********************
@@ -172,6 +180,13 @@ uint8_t lv_timer_get_idle(void);
  */
 lv_timer_t * lv_timer_get_next(lv_timer_t * timer);
 
+/**
+ * Switch between the due time heap (`LV_TIMER_HEAP`) and walking the list of timers. Enabled by default.
+ * Disabling frees the heap, enabling rebuilds it from the list. Don't call it from a timer callback.
+ * @param en true: run the due timers from the heap; false: walk the list like without `LV_TIMER_HEAP`
+ */
+void lv_timer_enable_heap(bool en);
+
 /**********************
  *      MACROS
  **********************/
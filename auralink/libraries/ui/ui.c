@@ -8,6 +8,8 @@
 
 ///////////////////// VARIABLES ////////////////////
 
+lv_obj_t * ui_NotificationBar = NULL;
+
 // EVENTS
 lv_obj_t * ui____initial_actions0;
 
@@ -17,8 +19,8 @@ lv_obj_t * ui____initial_actions0;
 #if LV_COLOR_DEPTH != 16
     #error "LV_COLOR_DEPTH should be 16bit to match SquareLine Studio's settings"
 #endif
-#if LV_COLOR_16_SWAP !=0
-    #error "LV_COLOR_16_SWAP should be 0 to match SquareLine Studio's settings"
+#if LV_COLOR_16_SWAP !=1
+    #error "LV_COLOR_16_SWAP should be 1 to match SquareLine Studio's settings"
 #endif
 
 ///////////////////// ANIMATIONS ////////////////////
@@ -38,12 +40,20 @@ void ui_init(void)
     ui_SensorData_screen_init();
     ui_DailyQuote_screen_init();
     ui_EmailSummary_screen_init();
+    ui_NotificationBar = ui_NotificationBar_create(lv_layer_top());
+    lv_obj_set_x(ui_NotificationBar, 0);
+    lv_obj_set_y(ui_NotificationBar, -72);
+    // The top layer is not themed; inherit the text colour screens get
+    lv_obj_set_style_text_color(ui_NotificationBar, lv_obj_get_style_text_color(ui_SensorData, LV_PART_MAIN),
+                                LV_PART_MAIN | LV_STATE_DEFAULT);
     ui____initial_actions0 = lv_obj_create(NULL);
     lv_disp_load_scr(ui_SensorData);
 }
 
 void ui_destroy(void)
 {
+    if(ui_NotificationBar) lv_obj_del(ui_NotificationBar);
+    ui_NotificationBar = NULL;
     ui_SensorData_screen_destroy();
     ui_DailyQuote_screen_destroy();
     ui_EmailSummary_screen_destroy();
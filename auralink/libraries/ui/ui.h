@@ -35,6 +35,10 @@ extern "C" {
 
 ///////////////////// VARIABLES ////////////////////
 
+// One notification bar on lv_layer_top(), shared by every screen. Screens
+// are laid out for the area below it (see UI_COMP_NOTIFICATIONBAR_HEIGHT).
+extern lv_obj_t * ui_NotificationBar;
+
 
 // EVENTS
 
@@ -51,6 +55,10 @@ LV_IMG_DECLARE(ui_img_pressure_png);    // assets/pressure.png
 LV_IMG_DECLARE(ui_img_rh_png);    // assets/rh.png
 LV_IMG_DECLARE(ui_img_light_png);    // assets/light.png
 LV_IMG_DECLARE(ui_img_uv_png);    // assets/uv.png
+LV_IMG_DECLARE(ui_img_pub_a8);    // ui_img_pub_png as drawn, alpha mask (auralink_iconconv)
+LV_IMG_DECLARE(ui_img_sub_a8);    // ui_img_sub_png as drawn, alpha mask (auralink_iconconv)
+LV_IMG_DECLARE(ui_img_wifi_a8);    // ui_img_wifiicon_png as drawn, alpha mask (auralink_iconconv)
+LV_IMG_DECLARE(ui_img_charging_a8);    // ui_img_chargingicon_png as drawn, alpha mask (auralink_iconconv)
 
 // UI INIT
 void ui_init(void);
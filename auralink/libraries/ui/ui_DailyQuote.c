@@ -8,7 +8,6 @@
 lv_obj_t * uic_QuoteLabel;
 lv_obj_t * uic_DailyQuote;
 lv_obj_t * ui_DailyQuote = NULL;
-lv_obj_t * ui_DQNotificationBar = NULL;
 lv_obj_t * ui_QuoteContainer = NULL;
 lv_obj_t * ui_QuoteLabel = NULL;
 lv_obj_t * ui_Navigation2 = NULL;
@@ -27,16 +26,12 @@ void ui_DailyQuote_screen_init(void)
     ui_DailyQuote = lv_obj_create(NULL);
     lv_obj_clear_flag(ui_DailyQuote, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
 
-    ui_DQNotificationBar = ui_NotificationBar_create(ui_DailyQuote);
-    lv_obj_set_x(ui_DQNotificationBar, 0);
-    lv_obj_set_y(ui_DQNotificationBar, -72);
-
     ui_QuoteContainer = lv_obj_create(ui_DailyQuote);
     lv_obj_remove_style_all(ui_QuoteContainer);
     lv_obj_set_height(ui_QuoteContainer, 132);
     lv_obj_set_width(ui_QuoteContainer, lv_pct(100));
     lv_obj_set_x(ui_QuoteContainer, 0);
-    lv_obj_set_y(ui_QuoteContainer, 2);
+    lv_obj_set_y(ui_QuoteContainer, -14);
     lv_obj_set_align(ui_QuoteContainer, LV_ALIGN_CENTER);
     lv_obj_set_flex_flow(ui_QuoteContainer, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(ui_QuoteContainer, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START);
@@ -64,7 +59,7 @@ void ui_DailyQuote_screen_init(void)
     lv_obj_set_height(ui_Navigation2, 12);
     lv_obj_set_width(ui_Navigation2, lv_pct(100));
     lv_obj_set_x(ui_Navigation2, 0);
-    lv_obj_set_y(ui_Navigation2, 74);
+    lv_obj_set_y(ui_Navigation2, 58);
     lv_obj_set_align(ui_Navigation2, LV_ALIGN_CENTER);
     lv_obj_set_flex_flow(ui_Navigation2, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(ui_Navigation2, LV_FLEX_ALIGN_SPACE_AROUND, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
@@ -144,7 +139,6 @@ void ui_DailyQuote_screen_destroy(void)
     // NULL screen variables
     uic_DailyQuote = NULL;
     ui_DailyQuote = NULL;
-    ui_DQNotificationBar = NULL;
     ui_QuoteContainer = NULL;
     uic_QuoteLabel = NULL;
     ui_QuoteLabel = NULL;
@@ -14,7 +14,6 @@ extern "C" {
 extern void ui_DailyQuote_screen_init(void);
 extern void ui_DailyQuote_screen_destroy(void);
 extern lv_obj_t * ui_DailyQuote;
-extern lv_obj_t * ui_DQNotificationBar;
 extern lv_obj_t * ui_QuoteContainer;
 extern lv_obj_t * ui_QuoteLabel;
 extern lv_obj_t * ui_Navigation2;
@@ -9,7 +9,6 @@ lv_obj_t * uic_EmailSummaryLabel;
 lv_obj_t * uic_EmailSummaryContainer;
 lv_obj_t * uic_EmailSummary;
 lv_obj_t * ui_EmailSummary = NULL;
-lv_obj_t * ui_ESNotificationBar = NULL;
 lv_obj_t * ui_EmailSummaryContainer = NULL;
 lv_obj_t * ui_EmailSummaryLabel = NULL;
 lv_obj_t * ui_Navigation3 = NULL;
@@ -28,16 +27,12 @@ void ui_EmailSummary_screen_init(void)
     ui_EmailSummary = lv_obj_create(NULL);
     lv_obj_clear_flag(ui_EmailSummary, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
 
-    ui_ESNotificationBar = ui_NotificationBar_create(ui_EmailSummary);
-    lv_obj_set_x(ui_ESNotificationBar, 0);
-    lv_obj_set_y(ui_ESNotificationBar, -72);
-
     ui_EmailSummaryContainer = lv_obj_create(ui_EmailSummary);
     lv_obj_remove_style_all(ui_EmailSummaryContainer);
     lv_obj_set_height(ui_EmailSummaryContainer, 132);
     lv_obj_set_width(ui_EmailSummaryContainer, lv_pct(100));
     lv_obj_set_x(ui_EmailSummaryContainer, 0);
-    lv_obj_set_y(ui_EmailSummaryContainer, 2);
+    lv_obj_set_y(ui_EmailSummaryContainer, -14);
     lv_obj_set_align(ui_EmailSummaryContainer, LV_ALIGN_CENTER);
     lv_obj_set_flex_flow(ui_EmailSummaryContainer, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(ui_EmailSummaryContainer, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START);
@@ -65,7 +60,7 @@ void ui_EmailSummary_screen_init(void)
     lv_obj_set_height(ui_Navigation3, 12);
     lv_obj_set_width(ui_Navigation3, lv_pct(100));
     lv_obj_set_x(ui_Navigation3, 0);
-    lv_obj_set_y(ui_Navigation3, 74);
+    lv_obj_set_y(ui_Navigation3, 58);
     lv_obj_set_align(ui_Navigation3, LV_ALIGN_CENTER);
     lv_obj_set_flex_flow(ui_Navigation3, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(ui_Navigation3, LV_FLEX_ALIGN_SPACE_AROUND, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
@@ -146,7 +141,6 @@ void ui_EmailSummary_screen_destroy(void)
     // NULL screen variables
     uic_EmailSummary = NULL;
     ui_EmailSummary = NULL;
-    ui_ESNotificationBar = NULL;
     uic_EmailSummaryContainer = NULL;
     ui_EmailSummaryContainer = NULL;
     uic_EmailSummaryLabel = NULL;
@@ -14,7 +14,6 @@ extern "C" {
 extern void ui_EmailSummary_screen_init(void);
 extern void ui_EmailSummary_screen_destroy(void);
 extern lv_obj_t * ui_EmailSummary;
-extern lv_obj_t * ui_ESNotificationBar;
 extern lv_obj_t * ui_EmailSummaryContainer;
 extern lv_obj_t * ui_EmailSummaryLabel;
 extern lv_obj_t * ui_Navigation3;
@@ -14,7 +14,6 @@ lv_obj_t * uic_AirQualityLabel;
 lv_obj_t * uic_AirQualityContainer;
 lv_obj_t * uic_SensorData;
 lv_obj_t * ui_SensorData = NULL;
-lv_obj_t * ui_SDNotificationBar = NULL;
 lv_obj_t * ui_Body = NULL;
 lv_obj_t * ui_AirQualityContainer = NULL;
 lv_obj_t * ui_AirQualityLabel = NULL;
@@ -70,16 +69,12 @@ void ui_SensorData_screen_init(void)
     lv_obj_set_style_bg_color(ui_SensorData, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_bg_opa(ui_SensorData, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
 
-    ui_SDNotificationBar = ui_NotificationBar_create(ui_SensorData);
-    lv_obj_set_x(ui_SDNotificationBar, 0);
-    lv_obj_set_y(ui_SDNotificationBar, -72);
-
     ui_Body = lv_obj_create(ui_SensorData);
     lv_obj_remove_style_all(ui_Body);
     lv_obj_set_width(ui_Body, 128);
     lv_obj_set_height(ui_Body, 144);
     lv_obj_set_x(ui_Body, 0);
-    lv_obj_set_y(ui_Body, 8);
+    lv_obj_set_y(ui_Body, -8);
     lv_obj_set_align(ui_Body, LV_ALIGN_CENTER);
     lv_obj_set_flex_flow(ui_Body, LV_FLEX_FLOW_ROW_WRAP);
     lv_obj_set_flex_align(ui_Body, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START);
@@ -423,7 +418,7 @@ void ui_SensorData_screen_init(void)
     lv_obj_set_height(ui_Navigation, 12);
     lv_obj_set_width(ui_Navigation, lv_pct(100));
     lv_obj_set_x(ui_Navigation, 0);
-    lv_obj_set_y(ui_Navigation, 74);
+    lv_obj_set_y(ui_Navigation, 58);
     lv_obj_set_align(ui_Navigation, LV_ALIGN_CENTER);
     lv_obj_set_flex_flow(ui_Navigation, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(ui_Navigation, LV_FLEX_ALIGN_SPACE_AROUND, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
@@ -509,7 +504,6 @@ void ui_SensorData_screen_destroy(void)
     // NULL screen variables
     uic_SensorData = NULL;
     ui_SensorData = NULL;
-    ui_SDNotificationBar = NULL;
     ui_Body = NULL;
     uic_AirQualityContainer = NULL;
     ui_AirQualityContainer = NULL;
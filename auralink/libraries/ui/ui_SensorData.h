@@ -14,7 +14,6 @@ extern "C" {
 extern void ui_SensorData_screen_init(void);
 extern void ui_SensorData_screen_destroy(void);
 extern lv_obj_t * ui_SensorData;
-extern lv_obj_t * ui_SDNotificationBar;
 extern lv_obj_t * ui_Body;
 extern lv_obj_t * ui_AirQualityContainer;
 extern lv_obj_t * ui_AirQualityLabel;
@@ -14,7 +14,7 @@ lv_obj_t * ui_NotificationBar_create(lv_obj_t * comp_parent)
     cui_NotificationBar = lv_obj_create(comp_parent);
     lv_obj_remove_style_all(cui_NotificationBar);
     lv_obj_set_width(cui_NotificationBar, 128);
-    lv_obj_set_height(cui_NotificationBar, 16);
+    lv_obj_set_height(cui_NotificationBar, UI_COMP_NOTIFICATIONBAR_HEIGHT);
     lv_obj_set_x(cui_NotificationBar, 0);
     lv_obj_set_y(cui_NotificationBar, -72);
     lv_obj_set_align(cui_NotificationBar, LV_ALIGN_CENTER);
@@ -61,32 +61,27 @@ lv_obj_t * ui_NotificationBar_create(lv_obj_t * comp_parent)
 
     lv_obj_t * cui_PubIcon;
     cui_PubIcon = lv_img_create(cui_PubSubContainer);
-    lv_img_set_src(cui_PubIcon, &ui_img_pub_png);
-    lv_obj_set_width(cui_PubIcon, 20);
-    lv_obj_set_height(cui_PubIcon, 23);
-    lv_obj_set_x(cui_PubIcon, -14);
-    lv_obj_set_y(cui_PubIcon, -5);
-    lv_obj_set_align(cui_PubIcon, LV_ALIGN_CENTER);
+    lv_img_set_src(cui_PubIcon, &ui_img_pub_a8);
+    lv_obj_set_width(cui_PubIcon, 7);
+    lv_obj_set_height(cui_PubIcon, 9);
+    lv_obj_set_x(cui_PubIcon, -11);
+    lv_obj_set_y(cui_PubIcon, 4);
     lv_obj_add_flag(cui_PubIcon, LV_OBJ_FLAG_ADV_HITTEST | LV_OBJ_FLAG_IGNORE_LAYOUT);     /// Flags
     lv_obj_clear_flag(cui_PubIcon, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
-    lv_img_set_zoom(cui_PubIcon, 96);
     lv_obj_set_style_img_recolor(cui_PubIcon, lv_color_hex(0xFF0070), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_img_recolor_opa(cui_PubIcon, 999, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_img_recolor_opa(cui_PubIcon, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
 
     lv_obj_t * cui_SubIcon;
     cui_SubIcon = lv_img_create(cui_PubSubContainer);
-    lv_img_set_src(cui_SubIcon, &ui_img_sub_png);
-    lv_obj_set_width(cui_SubIcon, 27);
-    lv_obj_set_height(cui_SubIcon, 30);
-    lv_obj_set_x(cui_SubIcon, 11);
-    lv_obj_set_y(cui_SubIcon, 9);
-    lv_obj_set_align(cui_SubIcon, LV_ALIGN_CENTER);
+    lv_img_set_src(cui_SubIcon, &ui_img_sub_a8);
+    lv_obj_set_width(cui_SubIcon, 7);
+    lv_obj_set_height(cui_SubIcon, 9);
+    lv_obj_set_x(cui_SubIcon, -5);
+    lv_obj_set_y(cui_SubIcon, 4);
     lv_obj_add_flag(cui_SubIcon, LV_OBJ_FLAG_ADV_HITTEST | LV_OBJ_FLAG_FLOATING);     /// Flags
     lv_obj_clear_flag(cui_SubIcon, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
-    lv_img_set_pivot(cui_SubIcon, -10, 0);
-    lv_img_set_zoom(cui_SubIcon, 96);
     lv_obj_set_style_img_recolor(cui_SubIcon, lv_color_hex(0xFF0070), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_img_recolor_opa(cui_SubIcon, 999, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_img_recolor_opa(cui_SubIcon, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
 
     lv_obj_t * cui_WifiContainer;
     cui_WifiContainer = lv_obj_create(cui_NotificationBar);
@@ -103,18 +98,15 @@ lv_obj_t * ui_NotificationBar_create(lv_obj_t * comp_parent)
 
     lv_obj_t * cui_WifiIcon;
     cui_WifiIcon = lv_img_create(cui_WifiContainer);
-    lv_img_set_src(cui_WifiIcon, &ui_img_wifiicon_png);
-    lv_obj_set_width(cui_WifiIcon, 20);
-    lv_obj_set_height(cui_WifiIcon, 23);
-    lv_obj_set_x(cui_WifiIcon, -15);
-    lv_obj_set_y(cui_WifiIcon, 1);
-    lv_obj_set_align(cui_WifiIcon, LV_ALIGN_CENTER);
-    lv_obj_add_flag(cui_WifiIcon, LV_OBJ_FLAG_ADV_HITTEST);     /// Flags
+    lv_img_set_src(cui_WifiIcon, &ui_img_wifi_a8);
+    lv_obj_set_width(cui_WifiIcon, 12);
+    lv_obj_set_height(cui_WifiIcon, 18);
+    lv_obj_set_x(cui_WifiIcon, 2);
+    lv_obj_set_y(cui_WifiIcon, 3);
+    lv_obj_add_flag(cui_WifiIcon, LV_OBJ_FLAG_ADV_HITTEST | LV_OBJ_FLAG_IGNORE_LAYOUT);     /// Flags
     lv_obj_clear_flag(cui_WifiIcon, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
-    lv_img_set_pivot(cui_WifiIcon, -10, 6);
-    lv_img_set_zoom(cui_WifiIcon, 190);
     lv_obj_set_style_img_recolor(cui_WifiIcon, lv_color_hex(0xFF0070), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_img_recolor_opa(cui_WifiIcon, 999, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_img_recolor_opa(cui_WifiIcon, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
 
     lv_obj_t * cui_BatteryContainer;
     cui_BatteryContainer = lv_obj_create(cui_NotificationBar);
@@ -156,15 +148,15 @@ lv_obj_t * ui_NotificationBar_create(lv_obj_t * comp_parent)
 
     lv_obj_t * cui_ChargingIcon;
     cui_ChargingIcon = lv_img_create(cui_BatteryContainer);
-    lv_img_set_src(cui_ChargingIcon, &ui_img_chargingicon_png);
-    lv_obj_set_width(cui_ChargingIcon, 16);
-    lv_obj_set_height(cui_ChargingIcon, 16);
-    lv_obj_set_x(cui_ChargingIcon, 12);
-    lv_obj_set_y(cui_ChargingIcon, 0);
-    lv_obj_set_align(cui_ChargingIcon, LV_ALIGN_CENTER);
+    lv_img_set_src(cui_ChargingIcon, &ui_img_charging_a8);
+    lv_obj_set_width(cui_ChargingIcon, 8);
+    lv_obj_set_height(cui_ChargingIcon, 12);
+    lv_obj_set_x(cui_ChargingIcon, 30);
+    lv_obj_set_y(cui_ChargingIcon, 2);
     lv_obj_add_flag(cui_ChargingIcon, LV_OBJ_FLAG_ADV_HITTEST | LV_OBJ_FLAG_IGNORE_LAYOUT);     /// Flags
     lv_obj_clear_flag(cui_ChargingIcon, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
-    lv_img_set_zoom(cui_ChargingIcon, 192);
+    lv_obj_set_style_img_recolor(cui_ChargingIcon, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_img_recolor_opa(cui_ChargingIcon, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
 
     lv_obj_t ** children = lv_mem_alloc(sizeof(lv_obj_t *) * _UI_COMP_NOTIFICATIONBAR_NUM);
     children[UI_COMP_NOTIFICATIONBAR_NOTIFICATIONBAR] = cui_NotificationBar;
@@ -26,6 +26,7 @@ extern "C" {
 #define UI_COMP_NOTIFICATIONBAR_BATTERYCONTAINER_BATTERY 10
 #define UI_COMP_NOTIFICATIONBAR_BATTERYCONTAINER_CHARGINGICON 11
 #define _UI_COMP_NOTIFICATIONBAR_NUM 12
+#define UI_COMP_NOTIFICATIONBAR_HEIGHT 16
 lv_obj_t * ui_NotificationBar_create(lv_obj_t * comp_parent);
 
 #ifdef __cplusplus
@@ -0,0 +1,34 @@
+// This file was generated by auralink_iconconv (host/src/iconconv_main.cpp)
+// LVGL version: 8.3.11
+// Project name: AuraLink
+
+#include "ui.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+// IMAGE DATA: charging at zoom 192 in a 16x16 object, as an alpha mask drawn
+// 1:1 at (+4,+2) from that object's top-left. The colour is img_recolor.
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_charging_a8_data[] = {
+    0x00,0x00,0x00,0x00,0x00,0x56,0x54,0x00,
+    0x00,0x00,0x00,0x00,0x56,0xFF,0x54,0x00,
+    0x00,0x00,0x00,0x58,0xFF,0xAA,0x00,0x00,
+    0x00,0x00,0x00,0xAB,0xFF,0xA9,0x00,0x00,
+    0x00,0x00,0xAB,0xFF,0xFF,0x55,0x55,0x55,
+    0x00,0xAB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xAC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
+    0x57,0xAA,0xAA,0xFF,0xFF,0xFF,0x54,0x00,
+    0x00,0x00,0x55,0xFF,0xFF,0x54,0x00,0x00,
+    0x00,0x00,0x55,0xFF,0xFF,0x00,0x00,0x00,
+    0x00,0x00,0xA9,0xAB,0x00,0x00,0x00,0x00,
+    0x00,0x00,0xA9,0x00,0x00,0x00,0x00,0x00,
+};
+const lv_img_dsc_t ui_img_charging_a8 = {
+    .header.always_zero = 0,
+    .header.w = 8,
+    .header.h = 12,
+    .data_size = sizeof(ui_img_charging_a8_data),
+    .header.cf = LV_IMG_CF_ALPHA_8BIT,
+    .data = ui_img_charging_a8_data
+};
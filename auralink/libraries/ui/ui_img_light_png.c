@@ -11,23 +11,23 @@
 
 // IMAGE DATA: assets/light.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_light_png_data[] = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x1B,0xDF,0xFF,0x40,0xFF,0xFF,0x35,0xFF,0xFF,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x05,0x5D,0xEF,0xC1,0x1C,0xE7,0xFF,0xFB,0xDE,0xF9,0xDB,0xDE,0xEF,0xFB,0xDE,0xF7,0x1C,0xE7,0xFF,0x7D,0xEF,0xFC,0xFF,0xFF,0x65,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0x36,0x1C,0xE7,0xFF,0xD3,0x9C,0x9F,0x04,0x21,0x58,0x24,0x21,0x56,0x04,0x21,0x57,0xE3,0x18,0x59,0x82,0x10,0x5D,0xAE,0x73,0x8E,0x3C,0xE7,0xFD,0xBE,0xF7,0xE4,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0x2F,0x1C,0xE7,0xFA,0x28,0x42,0x52,0x49,0x4A,0x47,0x8A,0x52,0x45,0x69,0x4A,0x45,0x49,0x4A,0x48,0x08,0x42,0x4C,0x86,0x31,0x51,0x04,0x21,0x57,0x82,0x10,0x5F,0xFB,0xDE,0xEC,0xBE,0xF7,0xEA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x4A,0x07,0x3C,0xE7,0xFE,0xAE,0x73,0x45,0xCF,0x7B,0x35,0xEF,0x7B,0x33,0xCF,0x7B,0x34,0xAE,0x73,0x36,0x4D,0x6B,0x3A,0x0C,0x63,0x40,0x69,0x4A,0x46,0xE7,0x39,0x4D,0x24,0x21,0x55,0x82,0x10,0x5E,0x5D,0xEF,0xFA,0xFF,0xFF,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0x05,0xB6,0xB5,0xB9,0x1C,0xE7,0xA6,0x14,0xA5,0x24,0x34,0xA5,0x22,0x34,0xA5,0x22,0xF3,0x9C,0x25,0xB2,0x94,0x29,0x51,0x8C,0x2E,0xCF,0x7B,0x34,0x2C,0x63,0x3C,0x8A,0x52,0x44,0xE7,0x39,0x4D,0x24,0x21,0x57,0xAA,0x52,0x7A,0x9E,0xF7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x04,0x86,0x31,0x50,0x3C,0xE7,0xFD,0xDB,0xDE,0x1C,0x79,0xCE,0x10,0x9A,0xD6,0x11,0x59,0xCE,0x13,0xF7,0xBD,0x17,0x96,0xB5,0x1D,0x14,0xA5,0x23,0x92,0x94,0x2A,0x10,0x84,0x32,0x4D,0x6B,0x3B,0x8A,0x52,0x45,0xA6,0x31,0x50,0xA2,0x10,0x5C,0x7D,0xEF,0xFB,0xFF,0xFF,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x02,0xEB,0x5A,0x3E,0x04,0x21,0x5C,0x7D,0xEF,0xFF,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x10,0x84,0x02,0xBA,0xD6,0x06,0x9A,0xD6,0x0B,0x9A,0xD6,0x11,0xD7,0xBD,0x19,0x55,0xAD,0x21,0x92,0x94,0x2A,0xCF,0x7B,0x34,0x0C,0x63,0x3F,0x08,0x42,0x4A,0x04,0x21,0x57,0x9A,0xD6,0xD5,0xDF,0xFF,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x51,0x8C,0x2D,0x28,0x42,0x49,0x65,0x29,0x65,0x7E,0xEF,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xDB,0xDE,0x07,0x79,0xCE,0x0F,0xF7,0xBD,0x18,0x34,0xA5,0x22,0x71,0x8C,0x2D,0x8E,0x73,0x39,0x69,0x4A,0x46,0x45,0x29,0x54,0xD7,0xBD,0xB8,0xDF,0xFF,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0x1B,0x6D,0x6B,0x37,0xE7,0x39,0x4C,0x04,0x21,0x62,0x9E,0xF7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDB,0xDE,0x07,0x9A,0xD6,0x11,0xB6,0xB5,0x1C,0xB2,0x94,0x27,0xCF,0x7B,0x34,0xCB,0x5A,0x43,0x65,0x29,0x53,0x79,0xCE,0xC9,0xFF,0xFF,0x7D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xCE,0x0A,0xD3,0x9C,0x26,0x4D,0x6B,0x3B,0xE7,0x39,0x4C,0xA2,0x10,0x5C,0x7E,0xEF,0xFF,0xFF,0xFF,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x79,0xCE,0x0A,0x38,0xC6,0x16,0x14,0xA5,0x23,0x10,0x84,0x31,0xCB,0x5A,0x41,0x45,0x29,0x53,0x7D,0xEF,0xF3,0xFF,0xFF,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0x14,0xB2,0x94,0x29,0x4D,0x6B,0x3B,0x08,0x42,0x4B,0x04,0x21,0x59,0xBA,0xD6,0xDB,0xFF,0xFF,0xB7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0x04,0x9A,0xD6,0x11,0x34,0xA5,0x20,0x51,0x8C,0x2F,0xCB,0x5A,0x42,0xA6,0x31,0x5E,0xDF,0xFF,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xAD,0x03,0xF7,0xBD,0x17,0xB2,0x94,0x29,0x4D,0x6B,0x39,0x49,0x4A,0x47,0x45,0x29,0x54,0x86,0x31,0x6A,0xBE,0xF7,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x59,0xCE,0x0E,0x55,0xAD,0x1E,0x30,0x84,0x30,0x49,0x4A,0x47,0x3C,0xE7,0xE0,0xFF,0xFF,0x5D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0x06,0xF7,0xBD,0x18,0xD3,0x9C,0x28,0xAE,0x73,0x36,0xAA,0x52,0x43,0xA6,0x31,0x4F,0xE3,0x18,0x5A,0xD7,0xBD,0xB8,0xDF,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0x0C,0x75,0xAD,0x1F,0xCF,0x7B,0x35,0xB2,0x94,0x81,0xFF,0xFF,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0x06,0x38,0xC6,0x16,0xF3,0x9C,0x24,0x10,0x84,0x31,0x2C,0x63,0x3D,0x28,0x42,0x48,0x65,0x29,0x53,0x82,0x10,0x5E,0xBE,0xF7,0xFD,0xFF,0xFF,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDB,0xDE,0x0D,0x14,0xA5,0x24,0x49,0x4A,0x46,0xDF,0xFF,0xFC,0xFF,0xFF,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xCE,0x05,0x59,0xCE,0x13,0x34,0xA5,0x20,0x51,0x8C,0x2C,0xAE,0x73,0x37,0xCB,0x5A,0x41,0xE7,0x39,0x4C,0x04,0x21,0x58,0x34,0xA5,0xA7,0xDF,0xFF,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xC6,0x12,0xAE,0x73,0x34,0xAE,0x73,0x7C,0xDF,0xFF,0xE2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x02,0x59,0xCE,0x0E,0xD7,0xBD,0x1A,0xF3,0x9C,0x25,0x30,0x84,0x30,0x4D,0x6B,0x3B,0x69,0x4A,0x46,0x65,0x29,0x52,0xC3,0x18,0x61,0xBE,0xF7,0xFF,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x14,0xA5,0x23,0x08,0x42,0x4B,0x1C,0xE7,0xDD,0xFF,0xFF,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x09,0x79,0xCE,0x14,0x55,0xAD,0x1E,0xB2,0x94,0x29,0xCF,0x7B,0x35,0xCB,0x5A,0x41,0xE7,0x39,0x4D,0xE3,0x18,0x5A,0x7D,0xEF,0xF9,0xFF,0xFF,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0x11,0x4D,0x6B,0x39,0x24,0x21,0x55,0xBE,0xF7,0xFE,0xFF,0xFF,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xAD,0x03,0xDB,0xDE,0x0D,0xF7,0xBD,0x18,0x14,0xA5,0x23,0x51,0x8C,0x2F,0x2C,0x63,0x3C,0x28,0x42,0x49,0x04,0x21,0x57,0xBA,0xD6,0xDC,0xFF,0xFF,0x75,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0x04,0xD3,0x9C,0x28,0xAA,0x52,0x43,0xE3,0x18,0x5B,0xBE,0xF7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0x06,0x38,0xC6,0x12,0x96,0xB5,0x1E,0x92,0x94,0x2A,0xAE,0x73,0x37,0x8A,0x52,0x46,0x45,0x29,0x55,0xB6,0xB5,0xBB,0xDF,0xFF,0xD7,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0x18,0xC6,0x19,0x30,0x84,0x34,0x49,0x4A,0x4B,0x69,0x4A,0x71,0x9E,0xF7,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xBA,0xD6,0x0C,0xD7,0xBD,0x19,0xD3,0x9C,0x26,0xCF,0x7B,0x34,0xAA,0x52,0x43,0x65,0x29,0x53,0xA2,0x10,0x61,0x1C,0xE7,0xF6,0x5D,0xEF,0xFF,0x7D,0xEF,0xFF,0x7D,0xEF,0xFF,0x7D,0xEF,0xFF,0x7D,0xEF,0xFF,0x7D,0xEF,0xFB,0x9E,0xF7,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDB,0xDE,0x07,0xF7,0xBD,0x14,0x55,0xAD,0x23,0x10,0x84,0x32,0xCB,0x5A,0x41,0xC7,0x39,0x4E,0x45,0x29,0x57,0x1C,0xE7,0xFF,0x1C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x5D,0xEF,0xFF,0xFF,0xFF,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xAD,0x03,0x9A,0xD6,0x11,0x34,0xA5,0x20,0x30,0x84,0x30,0x2C,0x63,0x3C,0x8A,0x52,0x45,0xC3,0x18,0x5B,0x79,0xCE,0xFA,0x9A,0xD6,0xFF,0xBA,0xD6,0xFF,0xBA,0xD6,0xFF,0xBA,0xD6,0xFF,0xBA,0xD6,0xFF,0xBA,0xD6,0xFF,0xFF,0xFF,0x5C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x59,0xCE,0x0E,0x55,0xAD,0x1E,0x71,0x8C,0x2B,0xEF,0x7B,0x33,0x28,0x42,0x49,0xC3,0x18,0x5B,0x38,0xC6,0xF8,0x59,0xCE,0xFF,0x59,0xCE,0xFF,0x59,0xCE,0xFF,0x79,0xCE,0xFF,0x79,0xCE,0xFF,0x7A,0xCE,0xFF,0xFF,0xFF,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDB,0xDE,0x0D,0xD7,0xBD,0x19,0x34,0xA5,0x22,0x8E,0x73,0x38,0x28,0x42,0x49,0xE3,0x18,0x5A,0x18,0xC6,0xE4,0x59,0xCE,0xFC,0x79,0xCE,0xFF,0x7A,0xCE,0xFF,0x7A,0xCE,0xFF,0x7A,0xCE,0xFF,0x59,0xC6,0xE7,0x5E,0xEF,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0x08,0x79,0xCE,0x10,0xD3,0x9C,0x26,0x8E,0x73,0x38,0x28,0x42,0x48,0x45,0x29,0x55,0x04,0x21,0x58,0x59,0xC6,0xFD,0x59,0xCE,0xFF,0x59,0xCE,0xFF,0x79,0xCE,0xFF,0x59,0xCE,0xFE,0x7D,0xEF,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0x15,0xD3,0x9C,0x26,0x8E,0x73,0x36,0x8A,0x52,0x44,0x69,0x4A,0x46,0x04,0x21,0x57,0x04,0x21,0x59,0xD7,0xBD,0xF1,0x18,0xC6,0xFF,0x18,0xC6,0xFF,0x0C,0x63,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0x04,0xF7,0xBD,0x14,0xF3,0x9C,0x25,0x10,0x84,0x32,0xCF,0x7B,0x35,0x8A,0x52,0x46,0x49,0x4A,0x47,0x24,0x21,0x56,0xC3,0x18,0x5B,0xC3,0x18,0x5B,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0x04,0x59,0xCE,0x13,0x55,0xAD,0x21,0x14,0xA5,0x23,0xCF,0x7B,0x34,0xAE,0x73,0x36,0x8A,0x52,0x44,0x28,0x42,0x4A,0x28,0x42,0x4A,0x86,0x31,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0x04,0x79,0xCE,0x0F,0x38,0xC6,0x12,0x55,0xAD,0x23,0x14,0xA5,0x24,0xEF,0x7B,0x33,0x6D,0x6B,0x38,0x6D,0x6B,0x38,0x2C,0x63,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x02,0x9A,0xD6,0x11,0x59,0xCE,0x13,0x14,0xA5,0x21,0xB2,0x94,0x27,0xB2,0x94,0x27,0x55,0xAD,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x10,0x84,0x02,0x79,0xCE,0x10,0x18,0xC6,0x15,0x18,0xC6,0x15,0x10,0x84,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xF7,0xBD,0x04,0xF7,0xBD,0x04,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x1B,0xFF,0xDF,0x40,0xFF,0xFF,0x35,0xFF,0xFF,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x05,0xEF,0x5D,0xC1,0xE7,0x1C,0xFF,0xDE,0xFB,0xF9,0xDE,0xDB,0xEF,0xDE,0xFB,0xF7,0xE7,0x1C,0xFF,0xEF,0x7D,0xFC,0xFF,0xFF,0x65,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x3C,0x36,0xE7,0x1C,0xFF,0x9C,0xD3,0x9F,0x21,0x04,0x58,0x21,0x24,0x56,0x21,0x04,0x57,0x18,0xE3,0x59,0x10,0x82,0x5D,0x73,0xAE,0x8E,0xE7,0x3C,0xFD,0xF7,0xBE,0xE4,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x3C,0x2F,0xE7,0x1C,0xFA,0x42,0x28,0x52,0x4A,0x49,0x47,0x52,0x8A,0x45,0x4A,0x69,0x45,0x4A,0x49,0x48,0x42,0x08,0x4C,0x31,0x86,0x51,0x21,0x04,0x57,0x10,0x82,0x5F,0xDE,0xFB,0xEC,0xF7,0xBE,0xEA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x49,0x07,0xE7,0x3C,0xFE,0x73,0xAE,0x45,0x7B,0xCF,0x35,0x7B,0xEF,0x33,0x7B,0xCF,0x34,0x73,0xAE,0x36,0x6B,0x4D,0x3A,0x63,0x0C,0x40,0x4A,0x69,0x46,0x39,0xE7,0x4D,0x21,0x24,0x55,0x10,0x82,0x5E,0xEF,0x5D,0xFA,0xFF,0xFF,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x2C,0x05,0xB5,0xB6,0xB9,0xE7,0x1C,0xA6,0xA5,0x14,0x24,0xA5,0x34,0x22,0xA5,0x34,0x22,0x9C,0xF3,0x25,0x94,0xB2,0x29,0x8C,0x51,0x2E,0x7B,0xCF,0x34,0x63,0x2C,0x3C,0x52,0x8A,0x44,0x39,0xE7,0x4D,0x21,0x24,0x57,0x52,0xAA,0x7A,0xF7,0x9E,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x04,0x31,0x86,0x50,0xE7,0x3C,0xFD,0xDE,0xDB,0x1C,0xCE,0x79,0x10,0xD6,0x9A,0x11,0xCE,0x59,0x13,0xBD,0xF7,0x17,0xB5,0x96,0x1D,0xA5,0x14,0x23,0x94,0x92,0x2A,0x84,0x10,0x32,0x6B,0x4D,0x3B,0x52,0x8A,0x45,0x31,0xA6,0x50,0x10,0xA2,0x5C,0xEF,0x7D,0xFB,0xFF,0xFF,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x5A,0xEB,0x3E,0x21,0x04,0x5C,0xEF,0x7D,0xFF,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x84,0x10,0x02,0xD6,0xBA,0x06,0xD6,0x9A,0x0B,0xD6,0x9A,0x11,0xBD,0xD7,0x19,0xAD,0x55,0x21,0x94,0x92,0x2A,0x7B,0xCF,0x34,0x63,0x0C,0x3F,0x42,0x08,0x4A,0x21,0x04,0x57,0xD6,0x9A,0xD5,0xFF,0xDF,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x8C,0x51,0x2D,0x42,0x28,0x49,0x29,0x65,0x65,0xEF,0x7E,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xDE,0xDB,0x07,0xCE,0x79,0x0F,0xBD,0xF7,0x18,0xA5,0x34,0x22,0x8C,0x71,0x2D,0x73,0x8E,0x39,0x4A,0x69,0x46,0x29,0x45,0x54,0xBD,0xD7,0xB8,0xFF,0xDF,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB5,0x96,0x1B,0x6B,0x6D,0x37,0x39,0xE7,0x4C,0x21,0x04,0x62,0xF7,0x9E,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDE,0xDB,0x07,0xD6,0x9A,0x11,0xB5,0xB6,0x1C,0x94,0xB2,0x27,0x7B,0xCF,0x34,0x5A,0xCB,0x43,0x29,0x65,0x53,0xCE,0x79,0xC9,0xFF,0xFF,0x7D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCE,0x79,0x0A,0x9C,0xD3,0x26,0x6B,0x4D,0x3B,0x39,0xE7,0x4C,0x10,0xA2,0x5C,0xEF,0x7E,0xFF,0xFF,0xFF,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xCE,0x79,0x0A,0xC6,0x38,0x16,0xA5,0x14,0x23,0x84,0x10,0x31,0x5A,0xCB,0x41,0x29,0x45,0x53,0xEF,0x7D,0xF3,0xFF,0xFF,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x14,0x94,0xB2,0x29,0x6B,0x4D,0x3B,0x42,0x08,0x4B,0x21,0x04,0x59,0xD6,0xBA,0xDB,0xFF,0xFF,0xB7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0xD6,0x9A,0x11,0xA5,0x34,0x20,0x8C,0x51,0x2F,0x5A,0xCB,0x42,0x31,0xA6,0x5E,0xFF,0xDF,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0xBD,0xF7,0x17,0x94,0xB2,0x29,0x6B,0x4D,0x39,0x4A,0x49,0x47,0x29,0x45,0x54,0x31,0x86,0x6A,0xF7,0xBE,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xCE,0x59,0x0E,0xAD,0x55,0x1E,0x84,0x30,0x30,0x4A,0x49,0x47,0xE7,0x3C,0xE0,0xFF,0xFF,0x5D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xBA,0x06,0xBD,0xF7,0x18,0x9C,0xD3,0x28,0x73,0xAE,0x36,0x52,0xAA,0x43,0x31,0xA6,0x4F,0x18,0xE3,0x5A,0xBD,0xD7,0xB8,0xFF,0xDF,0xF5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xBA,0x0C,0xAD,0x75,0x1F,0x7B,0xCF,0x35,0x94,0xB2,0x81,0xFF,0xFF,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xBA,0x06,0xC6,0x38,0x16,0x9C,0xF3,0x24,0x84,0x10,0x31,0x63,0x2C,0x3D,0x42,0x28,0x48,0x29,0x65,0x53,0x10,0x82,0x5E,0xF7,0xBE,0xFD,0xFF,0xFF,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDE,0xDB,0x0D,0xA5,0x14,0x24,0x4A,0x49,0x46,0xFF,0xDF,0xFC,0xFF,0xFF,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCE,0x79,0x05,0xCE,0x59,0x13,0xA5,0x34,0x20,0x8C,0x51,0x2C,0x73,0xAE,0x37,0x5A,0xCB,0x41,0x39,0xE7,0x4C,0x21,0x04,0x58,0xA5,0x34,0xA7,0xFF,0xDF,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x38,0x12,0x73,0xAE,0x34,0x73,0xAE,0x7C,0xFF,0xDF,0xE2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0xCE,0x59,0x0E,0xBD,0xD7,0x1A,0x9C,0xF3,0x25,0x84,0x30,0x30,0x6B,0x4D,0x3B,0x4A,0x69,0x46,0x29,0x65,0x52,0x18,0xC3,0x61,0xF7,0xBE,0xFF,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0xA5,0x14,0x23,0x42,0x08,0x4B,0xE7,0x1C,0xDD,0xFF,0xFF,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x1C,0x09,0xCE,0x79,0x14,0xAD,0x55,0x1E,0x94,0xB2,0x29,0x7B,0xCF,0x35,0x5A,0xCB,0x41,0x39,0xE7,0x4D,0x18,0xE3,0x5A,0xEF,0x7D,0xF9,0xFF,0xFF,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x18,0x11,0x6B,0x4D,0x39,0x21,0x24,0x55,0xF7,0xBE,0xFE,0xFF,0xFF,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0xDE,0xDB,0x0D,0xBD,0xF7,0x18,0xA5,0x14,0x23,0x8C,0x51,0x2F,0x63,0x2C,0x3C,0x42,0x28,0x49,0x21,0x04,0x57,0xD6,0xBA,0xDC,0xFF,0xFF,0x75,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x9C,0xD3,0x28,0x52,0xAA,0x43,0x18,0xE3,0x5B,0xF7,0xBE,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xBA,0x06,0xC6,0x38,0x12,0xB5,0x96,0x1E,0x94,0x92,0x2A,0x73,0xAE,0x37,0x52,0x8A,0x46,0x29,0x45,0x55,0xB5,0xB6,0xBB,0xFF,0xDF,0xD7,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xC6,0x18,0x19,0x84,0x30,0x34,0x4A,0x49,0x4B,0x4A,0x69,0x71,0xF7,0x9E,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xD6,0xBA,0x0C,0xBD,0xD7,0x19,0x9C,0xD3,0x26,0x7B,0xCF,0x34,0x52,0xAA,0x43,0x29,0x65,0x53,0x10,0xA2,0x61,0xE7,0x1C,0xF6,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFB,0xF7,0x9E,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDE,0xDB,0x07,0xBD,0xF7,0x14,0xAD,0x55,0x23,0x84,0x10,0x32,0x5A,0xCB,0x41,0x39,0xC7,0x4E,0x29,0x45,0x57,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xEF,0x5D,0xFF,0xFF,0xFF,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0xD6,0x9A,0x11,0xA5,0x34,0x20,0x84,0x30,0x30,0x63,0x2C,0x3C,0x52,0x8A,0x45,0x18,0xC3,0x5B,0xCE,0x79,0xFA,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xFF,0xFF,0x5C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xCE,0x59,0x0E,0xAD,0x55,0x1E,0x8C,0x71,0x2B,0x7B,0xEF,0x33,0x42,0x28,0x49,0x18,0xC3,0x5B,0xC6,0x38,0xF8,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xFF,0xFF,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDE,0xDB,0x0D,0xBD,0xD7,0x19,0xA5,0x34,0x22,0x73,0x8E,0x38,0x42,0x28,0x49,0x18,0xE3,0x5A,0xC6,0x18,0xE4,0xCE,0x59,0xFC,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xC6,0x59,0xE7,0xEF,0x5E,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDE,0xFB,0x08,0xCE,0x79,0x10,0x9C,0xD3,0x26,0x73,0x8E,0x38,0x42,0x28,0x48,0x29,0x45,0x55,0x21,0x04,0x58,0xC6,0x59,0xFD,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x59,0xFE,0xEF,0x7D,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x18,0x15,0x9C,0xD3,0x26,0x73,0x8E,0x36,0x52,0x8A,0x44,0x4A,0x69,0x46,0x21,0x04,0x57,0x21,0x04,0x59,0xBD,0xD7,0xF1,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0x63,0x0C,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0xBD,0xF7,0x14,0x9C,0xF3,0x25,0x84,0x10,0x32,0x7B,0xCF,0x35,0x52,0x8A,0x46,0x4A,0x49,0x47,0x21,0x24,0x56,0x18,0xC3,0x5B,0x18,0xC3,0x5B,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0xCE,0x59,0x13,0xAD,0x55,0x21,0xA5,0x14,0x23,0x7B,0xCF,0x34,0x73,0xAE,0x36,0x52,0x8A,0x44,0x42,0x28,0x4A,0x42,0x28,0x4A,0x31,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0xCE,0x79,0x0F,0xC6,0x38,0x12,0xAD,0x55,0x23,0xA5,0x14,0x24,0x7B,0xEF,0x33,0x6B,0x6D,0x38,0x6B,0x6D,0x38,0x63,0x2C,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0xD6,0x9A,0x11,0xCE,0x59,0x13,0xA5,0x14,0x21,0x94,0xB2,0x27,0x94,0xB2,0x27,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x84,0x10,0x02,0xCE,0x79,0x10,0xC6,0x18,0x15,0xC6,0x18,0x15,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xBD,0xF7,0x04,0xBD,0xF7,0x04,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
     
 };
 const lv_img_dsc_t ui_img_light_png = {
@@ -0,0 +1,31 @@
+// This file was generated by auralink_iconconv (host/src/iconconv_main.cpp)
+// LVGL version: 8.3.11
+// Project name: AuraLink
+
+#include "ui.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+// IMAGE DATA: pub at zoom 96 in a 20x23 object, as an alpha mask drawn
+// 1:1 at (+13,+12) from that object's top-left. The colour is img_recolor.
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_pub_a8_data[] = {
+    0x00,0x00,0xAD,0xFF,0x00,0x00,0x00,
+    0x00,0xAC,0xFF,0xFF,0xFF,0x01,0x00,
+    0xAC,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
+    0xFF,0xFF,0x55,0xFF,0x54,0xFF,0xFF,
+    0x00,0x00,0x55,0xFF,0x00,0x00,0x00,
+    0x00,0x00,0x55,0xFF,0x00,0x00,0x00,
+    0x00,0x00,0x55,0xFF,0x00,0x00,0x00,
+    0x00,0x00,0x55,0xFF,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x56,0x00,0x00,0x00,
+};
+const lv_img_dsc_t ui_img_pub_a8 = {
+    .header.always_zero = 0,
+    .header.w = 7,
+    .header.h = 9,
+    .data_size = sizeof(ui_img_pub_a8_data),
+    .header.cf = LV_IMG_CF_ALPHA_8BIT,
+    .data = ui_img_pub_a8_data
+};
@@ -0,0 +1,31 @@
+// This file was generated by auralink_iconconv (host/src/iconconv_main.cpp)
+// LVGL version: 8.3.11
+// Project name: AuraLink
+
+#include "ui.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+// IMAGE DATA: sub at zoom 96 in a 27x30 object, as an alpha mask drawn
+// 1:1 at (-3,+2) from that object's top-left. The colour is img_recolor.
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_sub_a8_data[] = {
+    0x00,0x00,0xFA,0xFF,0x00,0x00,0x00,
+    0x00,0x00,0xFA,0xFF,0x00,0x00,0x00,
+    0x00,0x00,0xFA,0xFF,0x00,0x00,0x00,
+    0x00,0x00,0xFA,0xFF,0x00,0x00,0x00,
+    0xA3,0x00,0xFA,0xFF,0x00,0xF5,0x00,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,
+    0x56,0xFF,0xFF,0xFF,0xFF,0xAF,0x00,
+    0x00,0x54,0xFF,0xFF,0xB1,0x00,0x00,
+    0x00,0x00,0x5A,0x5A,0x00,0x00,0x00,
+};
+const lv_img_dsc_t ui_img_sub_a8 = {
+    .header.always_zero = 0,
+    .header.w = 7,
+    .header.h = 9,
+    .data_size = sizeof(ui_img_sub_a8_data),
+    .header.cf = LV_IMG_CF_ALPHA_8BIT,
+    .data = ui_img_sub_a8_data
+};
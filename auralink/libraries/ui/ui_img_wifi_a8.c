@@ -0,0 +1,40 @@
+// This file was generated by auralink_iconconv (host/src/iconconv_main.cpp)
+// LVGL version: 8.3.11
+// Project name: AuraLink
+
+#include "ui.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+// IMAGE DATA: wifi at zoom 190 in a 20x23 object, as an alpha mask drawn
+// 1:1 at (+2,+3) from that object's top-left. The colour is img_recolor.
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_wifi_a8_data[] = {
+    0x00,0x00,0x00,0x1C,0xAA,0xED,0xF0,0xBF,0x2F,0x00,0x00,0x00,
+    0x00,0x21,0xC1,0xD8,0xAE,0xA0,0x9C,0xAA,0xC7,0xCD,0x4E,0x00,
+    0x29,0xB8,0x81,0x41,0x68,0xA6,0xA7,0x97,0x36,0x76,0xB8,0x5B,
+    0x09,0x29,0x3D,0xFF,0xF7,0xB9,0xB0,0xF0,0xFF,0x7D,0x21,0x07,
+    0x00,0x11,0xA9,0x77,0x5B,0x58,0x58,0x2A,0x5F,0xAE,0x44,0x00,
+    0x00,0x00,0x25,0x45,0xFA,0xB5,0xA9,0xC6,0x83,0x19,0x00,0x00,
+    0x00,0x00,0x00,0x1E,0x52,0x39,0x54,0x34,0x3B,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x2E,0xE1,0xF1,0x55,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x1D,0xBD,0xC8,0x06,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x1C,0xAA,0xED,0xF0,0xBF,0x2F,0x00,0x00,0x00,
+};
+const lv_img_dsc_t ui_img_wifi_a8 = {
+    .header.always_zero = 0,
+    .header.w = 12,
+    .header.h = 18,
+    .data_size = sizeof(ui_img_wifi_a8_data),
+    .header.cf = LV_IMG_CF_ALPHA_8BIT,
+    .data = ui_img_wifi_a8_data
+};
@@ -35,4 +35,4 @@ static inline void LV_WATCH_DELETE(lv_obj_t *o, lv_obj_t **slot) {
     LV_SAFE((o), do {                                                        \
         lv_obj_set_style_img_recolor((o), (col), LV_PART_MAIN);              \
         lv_obj_set_style_img_recolor_opa((o), LV_OPA_COVER, LV_PART_MAIN);   \
-    } while (0))
\ No newline at end of file
+    } while (0))
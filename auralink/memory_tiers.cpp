@@ -0,0 +1,138 @@
+#include "memory_tiers.h"
+
+#include <lvgl.h>
+
+#include "User_Setup.h"
+
+namespace {
+
+// Prepended to every block; 8 bytes keeps the payload as aligned as the heap's
+struct Header {
+    uint32_t size;
+    uint8_t  tier;
+    uint8_t  pad[3];
+};
+static_assert(sizeof(Header) == 8, "header must keep 8-byte alignment");
+
+const uint32_t kCaps[kMemTierCount] = {
+    MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL,
+    MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT,
+    MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT,
+};
+const char* const kNames[kMemTierCount] = {"dma", "internal", "psram"};
+// Where a request goes when its tier is full
+const MemTier kFallback[kMemTierCount][2] = {
+    {MemTier::Internal, MemTier::Psram},
+    {MemTier::Psram, MemTier::Psram},
+    {MemTier::Internal, MemTier::Internal},
+};
+
+MemTierStats gStats[kMemTierCount];
+
+inline Header* headerOf(void* ptr) { return reinterpret_cast<Header*>(ptr) - 1; }
+
+void account(MemTier tier, size_t size) {
+    MemTierStats& s = gStats[(uint8_t)tier];
+    s.inUse += size;
+    s.allocs++;
+    if (s.inUse > s.peak) s.peak = s.inUse;
+}
+
+void* place(Header* h, MemTier tier, size_t size) {
+    h->size = (uint32_t)size;
+    h->tier = (uint8_t)tier;
+    account(tier, size);
+    return h + 1;
+}
+
+// Tries `tier` and then its fallbacks with `fn(caps)`; returns the tier that served it
+template <typename F>
+Header* tryTiers(MemTier tier, F&& fn, MemTier& got) {
+    MemTier order[3] = {tier, kFallback[(uint8_t)tier][0], kFallback[(uint8_t)tier][1]};
+    for (uint8_t i = 0; i < 3; ++i) {
+        if (i && order[i] == order[i - 1]) break;
+        if (Header* h = static_cast<Header*>(fn(kCaps[(uint8_t)order[i]]))) {
+            if (i) gStats[(uint8_t)tier].fallbacks++;
+            got = order[i];
+            return h;
+        }
+    }
+    gStats[(uint8_t)tier].failures++;
+    return nullptr;
+}
+
+class TierJsonAllocator : public ArduinoJson::Allocator {
+   public:
+    void* allocate(size_t size) override { return memAlloc(MemTier::Psram, size); }
+    void deallocate(void* ptr) override { memFree(ptr); }
+    void* reallocate(void* ptr, size_t size) override { return memRealloc(MemTier::Psram, ptr, size); }
+};
+
+MemTier lvTier(size_t size) {
+    if (_lv_refr_get_disp_refreshing()) return MemTier::Internal;
+    return size >= LVGL_PSRAM_MIN_BYTES ? MemTier::Psram : MemTier::Internal;
+}
+
+}  // namespace
+
+void* memAlloc(MemTier tier, size_t size) {
+    MemTier got = tier;
+    Header* h = tryTiers(tier, [&](uint32_t caps) { return heap_caps_malloc(sizeof(Header) + size, caps); }, got);
+    return h ? place(h, got, size) : nullptr;
+}
+
+void* memCalloc(MemTier tier, size_t n, size_t size) {
+    if (size && n > (SIZE_MAX - sizeof(Header)) / size) return nullptr;
+    void* p = memAlloc(tier, n * size);
+    if (p) memset(p, 0, n * size);
+    return p;
+}
+
+void* memRealloc(MemTier tier, void* ptr, size_t size) {
+    if (!ptr) return memAlloc(tier, size);
+    if (!size) {
+        memFree(ptr);
+        return nullptr;
+    }
+    Header* old = headerOf(ptr);
+    const MemTier own = (MemTier)old->tier;
+    const size_t oldSize = old->size;
+
+    // In place (or moved by the heap) within the block's own tier
+    if (Header* h = static_cast<Header*>(heap_caps_realloc(old, sizeof(Header) + size, kCaps[(uint8_t)own]))) {
+        MemTierStats& s = gStats[(uint8_t)own];
+        s.inUse = s.inUse - oldSize + size;
+        if (s.inUse > s.peak) s.peak = s.inUse;
+        h->size = (uint32_t)size;
+        return h + 1;
+    }
+    // Own tier is full: copy down the fallback chain
+    void* p = memAlloc(own, size);
+    if (!p) return nullptr;
+    memcpy(p, ptr, oldSize < size ? oldSize : size);
+    memFree(ptr);
+    return p;
+}
+
+void memFree(void* ptr) {
+    if (!ptr) return;
+    Header* h = headerOf(ptr);
+    gStats[h->tier].inUse -= h->size;
+    heap_caps_free(h);
+}
+
+const MemTierStats& memTierStats(MemTier tier) { return gStats[(uint8_t)tier]; }
+const char* memTierName(MemTier tier) { return kNames[(uint8_t)tier]; }
+size_t memTierFree(MemTier tier) { return heap_caps_get_free_size(kCaps[(uint8_t)tier]); }
+size_t memTierLargestFree(MemTier tier) { return heap_caps_get_largest_free_block(kCaps[(uint8_t)tier]); }
+
+ArduinoJson::Allocator* jsonAllocator() {
+    static TierJsonAllocator allocator;
+    return &allocator;
+}
+
+extern "C" {
+void* lv_tier_alloc(size_t size) { return memAlloc(lvTier(size), size); }
+void lv_tier_free(void* ptr) { memFree(ptr); }
+void* lv_tier_realloc(void* ptr, size_t size) { return memRealloc(lvTier(size), ptr, size); }
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Placement tiers for the firmware's heap allocations, so that large and
+// long-lived blocks stay out of the internal RAM that WiFi, DMA and the
+// renderer need. Each tier falls back to the next one when it is full
+// (Dma -> Internal -> Psram, Psram -> Internal); boards without PSRAM simply
+// end up in internal RAM. Every block carries a small header so usage and
+// high-water marks can be kept per tier. Not thread safe: allocate from the
+// loop task only.
+enum class MemTier : uint8_t {
+    Dma,       // internal, DMA-capable: panel flush buffers
+    Internal,  // internal SRAM: LVGL objects and per-frame draw scratch
+    Psram,     // external PSRAM: snapshots, JSON documents, sensor history
+};
+static constexpr uint8_t kMemTierCount = 3;
+
+struct MemTierStats {
+    size_t   inUse     = 0;  // bytes currently allocated (payload only)
+    size_t   peak      = 0;  // high-water mark of inUse
+    uint32_t allocs    = 0;  // successful allocations served by this tier
+    uint32_t fallbacks = 0;  // requests for this tier served by another one
+    uint32_t failures  = 0;  // requests no tier could serve
+};
+
+void* memAlloc(MemTier tier, size_t size);
+void* memCalloc(MemTier tier, size_t n, size_t size);
+// Grows or shrinks in the block's own tier, moving it down the fallback
+// chain if that tier is full; a null ptr allocates from `tier`
+void* memRealloc(MemTier tier, void* ptr, size_t size);
+void  memFree(void* ptr);
+
+const MemTierStats& memTierStats(MemTier tier);
+const char* memTierName(MemTier tier);
+// Free bytes and largest free block of the heap behind the tier
+size_t memTierFree(MemTier tier);
+size_t memTierLargestFree(MemTier tier);
+
+// ArduinoJson documents: JsonDocument doc(jsonAllocator());
+ArduinoJson::Allocator* jsonAllocator();
+
+// LVGL allocates through lv_tier_alloc/free/realloc (LV_MEM_CUSTOM, declared
+// in lv_conf.h). Blocks allocated while a frame is being drawn are per-frame
+// scratch and stay internal; others of LVGL_PSRAM_MIN_BYTES or more (image
+// and font caches) go to PSRAM.
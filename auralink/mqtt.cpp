@@ -9,22 +9,13 @@
 #include "User_Setup.h"
 
 void updateMqttUI(bool force, bool isConnected, bool isSub, bool isPub) {
-    static lv_obj_t* ui_sd_MQTTSubIcon = nullptr;
-    static lv_obj_t* ui_sd_MQTTPubIcon = nullptr;
-    static lv_obj_t* ui_dq_MQTTSubIcon = nullptr;
-    static lv_obj_t* ui_dq_MQTTPubIcon = nullptr;
-    static lv_obj_t* ui_es_MQTTSubIcon = nullptr;
-    static lv_obj_t* ui_es_MQTTPubIcon = nullptr;
-
-    LV_TRY_FIND(ui_es_MQTTPubIcon, ui_ESNotificationBar, UI_COMP_NOTIFICATIONBAR_PUBSUBCONTAINER_PUBICON);
-    LV_TRY_FIND(ui_dq_MQTTPubIcon, ui_DQNotificationBar, UI_COMP_NOTIFICATIONBAR_PUBSUBCONTAINER_PUBICON);
-    LV_TRY_FIND(ui_sd_MQTTPubIcon, ui_SDNotificationBar, UI_COMP_NOTIFICATIONBAR_PUBSUBCONTAINER_PUBICON);
-    LV_TRY_FIND(ui_es_MQTTSubIcon, ui_ESNotificationBar, UI_COMP_NOTIFICATIONBAR_PUBSUBCONTAINER_SUBICON);
-    LV_TRY_FIND(ui_dq_MQTTSubIcon, ui_DQNotificationBar, UI_COMP_NOTIFICATIONBAR_PUBSUBCONTAINER_SUBICON);
-    LV_TRY_FIND(ui_sd_MQTTSubIcon, ui_SDNotificationBar, UI_COMP_NOTIFICATIONBAR_PUBSUBCONTAINER_SUBICON);
-
-    if (!lv_obj_ok(ui_sd_MQTTSubIcon) && !lv_obj_ok(ui_dq_MQTTSubIcon) && !lv_obj_ok(ui_es_MQTTSubIcon) &&
-        !lv_obj_ok(ui_sd_MQTTPubIcon) && !lv_obj_ok(ui_dq_MQTTPubIcon) && !lv_obj_ok(ui_es_MQTTPubIcon)) {
+    static lv_obj_t* ui_MQTTSubIcon = nullptr;
+    static lv_obj_t* ui_MQTTPubIcon = nullptr;
+
+    LV_TRY_FIND(ui_MQTTPubIcon, ui_NotificationBar, UI_COMP_NOTIFICATIONBAR_PUBSUBCONTAINER_PUBICON);
+    LV_TRY_FIND(ui_MQTTSubIcon, ui_NotificationBar, UI_COMP_NOTIFICATIONBAR_PUBSUBCONTAINER_SUBICON);
+
+    if (!lv_obj_ok(ui_MQTTSubIcon) && !lv_obj_ok(ui_MQTTPubIcon)) {
         return;
     }
 
@@ -48,13 +39,8 @@ void updateMqttUI(bool force, bool isConnected, bool isSub, bool isPub) {
     const lv_color_t colorPub = pubPulsing ? lv_color_hex(0x00FF1B) : base;
 
     /* Apply safely; no crashes if an icon vanished mid-update */
-    LV_ICON_RECOLOR_SAFE(ui_sd_MQTTSubIcon, colorSub);
-    LV_ICON_RECOLOR_SAFE(ui_dq_MQTTSubIcon, colorSub);
-    LV_ICON_RECOLOR_SAFE(ui_es_MQTTSubIcon, colorSub);
-
-    LV_ICON_RECOLOR_SAFE(ui_sd_MQTTPubIcon, colorPub);
-    LV_ICON_RECOLOR_SAFE(ui_dq_MQTTPubIcon, colorPub);
-    LV_ICON_RECOLOR_SAFE(ui_es_MQTTPubIcon, colorPub);
+    LV_ICON_RECOLOR_SAFE(ui_MQTTSubIcon, colorSub);
+    LV_ICON_RECOLOR_SAFE(ui_MQTTPubIcon, colorPub);
 
     if (!pulseActive) lastUpdate = now;
 }
@@ -101,7 +87,9 @@ void MqttClient::_applyServer() {
     auto& c = static_cast<_MqttHolder*>(_psClient)->client;
     c.setServer(_host, _port);
     c.setCallback(&_psCallback);
-    // c.setBufferSize(1024);
+    if (!c.setBufferSize(_p.bufferSize)) {
+        Serial.printf("[MQTT] no memory for a %u B buffer\n", (unsigned)_p.bufferSize);
+    }
 }
 
 bool MqttClient::connected() const {
@@ -25,13 +25,18 @@ public:
     uint32_t firstRetryMs;
     uint32_t maxRetryMs;
 
+    // Largest packet in or out; a sensor report (ReportPublisher::kMaxReport)
+    // plus topic and header must fit or publish() refuses it
+    uint16_t bufferSize;
+
     Params()
     : clientId(nullptr),
       username(nullptr), password(nullptr),
       willTopic(nullptr), willPayload(nullptr),
       willQos(0), willRetain(false),
       cleanSession(true), keepAliveSec(15),
-      firstRetryMs(1000), maxRetryMs(15000) {}
+      firstRetryMs(1000), maxRetryMs(15000),
+      bufferSize(512) {}
   };
 
   using MessageHandler = void(*)(const String& topic, const uint8_t* payload, size_t len);
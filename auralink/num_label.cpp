@@ -0,0 +1,422 @@
+#include "num_label.h"
+
+#include <Arduino.h>
+#include <draw/sw/lv_draw_sw.h>
+#include <math.h>
+
+#include "memory_tiers.h"
+
+namespace {
+
+constexpr char kChars[] = "0123456789.,-+:% ";
+constexpr uint8_t kCharCount = sizeof(kChars) - 1;
+constexpr uint8_t kMaxFonts = 4;
+constexpr uint8_t kMaxText = 15;
+
+struct Glyph {
+  int16_t  x, y;    // box position from the pen, y from the top of the line
+  uint8_t  w, h;
+  uint8_t  adv;
+  uint32_t offset;  // into Atlas::alpha
+};
+
+struct Atlas {
+  const lv_font_t* font = nullptr;
+  uint8_t   digitAdv = 0;
+  int8_t    slot[128];  // ASCII -> glyphs[], -1 if not in the atlas
+  Glyph     glyphs[kCharCount];
+  lv_opa_t* alpha = nullptr;
+};
+
+Atlas gAtlases[kMaxFonts];
+bool  gDiff = true;  // numLabelEnableDiff
+
+struct NumLabel {
+  lv_obj_t obj;
+  char     text[kMaxText + 1];
+  char     widest[kMaxText + 1];
+};
+
+inline bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+lv_opa_t unpack(const uint8_t* bitmap, uint32_t px, uint8_t bpp) {
+  uint32_t bit = px * bpp;
+  uint8_t v = (uint8_t)(bitmap[bit >> 3] >> (8 - bpp - (bit & 7))) & (uint8_t)((1u << bpp) - 1);
+  switch (bpp) {
+    case 1:  return v ? LV_OPA_COVER : LV_OPA_TRANSP;
+    case 2:  return (lv_opa_t)(v * 85);
+    case 4:  return (lv_opa_t)(v * 17);  // same shades as _lv_bpp4_opa_table
+    default: return v;
+  }
+}
+
+// Rasterises the atlas for `font` on first use
+const Atlas* atlasFor(const lv_font_t* font) {
+  if (!font) return nullptr;
+  Atlas* a = nullptr;
+  for (auto& s : gAtlases) {
+    if (s.font == font) return &s;
+    if (!s.font && !a) a = &s;
+  }
+  if (!a) {
+    Serial.println("[NUMLABEL] WARN: atlas table full; value not drawn.");
+    return nullptr;
+  }
+
+  lv_font_glyph_dsc_t g[kCharCount];
+  uint32_t total = 0;
+  uint8_t digitAdv = 0;
+  for (uint8_t i = 0; i < kCharCount; ++i) {
+    if (!lv_font_get_glyph_dsc(font, &g[i], (uint8_t)kChars[i], '\0')) lv_memset_00(&g[i], sizeof(g[i]));
+    total += (uint32_t)g[i].box_w * g[i].box_h;
+    if (isDigit(kChars[i]) && g[i].adv_w > digitAdv) digitAdv = (uint8_t)g[i].adv_w;
+  }
+  a->alpha = (lv_opa_t*)memAlloc(MemTier::Internal, total ? total : 1);
+  if (!a->alpha) return nullptr;
+
+  memset(a->slot, -1, sizeof(a->slot));
+  uint32_t offset = 0;
+  for (uint8_t i = 0; i < kCharCount; ++i) {
+    Glyph& gl = a->glyphs[i];
+    const bool digit = isDigit(kChars[i]);
+    gl.w = (uint8_t)g[i].box_w;
+    gl.h = (uint8_t)g[i].box_h;
+    gl.adv = digit ? digitAdv : (uint8_t)g[i].adv_w;
+    // Digits are centred in the common advance
+    gl.x = (int16_t)(g[i].ofs_x + (digit ? (digitAdv - g[i].adv_w) / 2 : 0));
+    gl.y = (int16_t)(font->line_height - font->base_line - g[i].box_h - g[i].ofs_y);
+    gl.offset = offset;
+    a->slot[(uint8_t)kChars[i]] = (int8_t)i;
+
+    const uint32_t px = (uint32_t)gl.w * gl.h;
+    if (!px) continue;
+    const uint8_t* bitmap = lv_font_get_glyph_bitmap(font, (uint8_t)kChars[i]);
+    const uint8_t bpp = g[i].bpp == 3 ? 4 : g[i].bpp;
+    for (uint32_t p = 0; p < px; ++p) a->alpha[offset + p] = bitmap ? unpack(bitmap, p, bpp) : 0;
+    offset += px;
+  }
+  a->digitAdv = digitAdv;
+  a->font = font;
+  Serial.printf("[NUMLABEL] atlas for %dpx font: %lu B\n", (int)font->line_height, (unsigned long)total);
+  return a;
+}
+
+const Glyph* glyphOf(const Atlas* a, char c) {
+  int8_t i = ((uint8_t)c < 128) ? a->slot[(uint8_t)c] : -1;
+  return i < 0 ? nullptr : &a->glyphs[i];
+}
+
+lv_coord_t textWidth(const Atlas* a, const char* text) {
+  lv_coord_t w = 0;
+  for (const char* p = text; *p; ++p) {
+    const Glyph* g = glyphOf(a, *p);
+    w += g ? g->adv : a->digitAdv;
+  }
+  return w;
+}
+
+// Pen position of the first character, as the widget draws `text`
+lv_coord_t penStart(lv_obj_t* obj, const Atlas* a, const char* text, const lv_area_t& content) {
+  const lv_coord_t tw = textWidth(a, text);
+  switch (lv_obj_get_style_text_align(obj, LV_PART_MAIN)) {
+    case LV_TEXT_ALIGN_CENTER: return content.x1 + (lv_area_get_width(&content) - tw) / 2;
+    case LV_TEXT_ALIGN_RIGHT:  return content.x2 + 1 - tw;
+    default:                   return content.x1;
+  }
+}
+
+// Invalidates the boxes of the characters that differ between `from` and
+// `to`, in either the character or its position. Together they cover every
+// pixel that changes; the tile under the rest of the text isn't redrawn.
+void invalidateChanged(lv_obj_t* obj, const Atlas* a, const char* from, const char* to) {
+  lv_area_t content;
+  lv_obj_get_content_coords(obj, &content);
+  lv_coord_t xf = penStart(obj, a, from, content);
+  lv_coord_t xt = penStart(obj, a, to, content);
+  auto invalidate = [&](char c, lv_coord_t x) {
+    const Glyph* g = glyphOf(a, c);
+    if (!g || !g->w || !g->h) return;
+    lv_area_t box = {(lv_coord_t)(x + g->x), (lv_coord_t)(content.y1 + g->y), (lv_coord_t)(x + g->x + g->w - 1),
+                     (lv_coord_t)(content.y1 + g->y + g->h - 1)};
+    lv_obj_invalidate_area(obj, &box);
+  };
+  auto advance = [&](char c) {
+    const Glyph* g = glyphOf(a, c);
+    return g ? g->adv : a->digitAdv;
+  };
+  while (*from || *to) {
+    if (*from != *to || xf != xt) {
+      if (*from) invalidate(*from, xf);
+      if (*to) invalidate(*to, xt);
+    }
+    if (*from) xf += advance(*from++);
+    if (*to) xt += advance(*to++);
+  }
+}
+
+// One alpha-masked fill of the glyph's box
+void blit(lv_draw_ctx_t* ctx, const Atlas* a, const Glyph& g, lv_coord_t x, lv_coord_t y,
+          const lv_draw_label_dsc_t& ld) {
+  lv_area_t box = {x, y, (lv_coord_t)(x + g.w - 1), (lv_coord_t)(y + g.h - 1)};
+  lv_area_t vis;
+  if (!_lv_area_intersect(&vis, &box, ctx->clip_area)) return;
+
+  lv_draw_sw_blend_dsc_t bd;
+  lv_memset_00(&bd, sizeof(bd));
+  bd.color = ld.color;
+  bd.opa = ld.opa;
+  bd.blend_mode = ld.blend_mode;
+  bd.mask_res = LV_DRAW_MASK_RES_CHANGED;
+  lv_opa_t* mask = a->alpha + g.offset;
+
+  // The blend clips the box itself; it only writes to the mask without anti-aliasing
+  lv_disp_t* disp = _lv_refr_get_disp_refreshing();
+  if (!lv_draw_mask_is_any(&vis) && disp->driver->antialiasing) {
+    bd.blend_area = &box;
+    bd.mask_area = &box;
+    bd.mask_buf = mask;
+    lv_draw_sw_blend(ctx, &bd);
+    return;
+  }
+
+  // Clip masks (rounded parents) or no anti-aliasing: row by row through a scratch copy
+  const lv_coord_t w = lv_area_get_width(&vis);
+  lv_opa_t* row = (lv_opa_t*)lv_mem_buf_get(w);
+  lv_area_t line = vis;
+  bd.blend_area = &line;
+  bd.mask_area = &line;
+  bd.mask_buf = row;
+  for (lv_coord_t ry = vis.y1; ry <= vis.y2; ++ry) {
+    line.y1 = line.y2 = ry;
+    memcpy(row, mask + (ry - box.y1) * g.w + (vis.x1 - box.x1), w);
+#if LV_DRAW_COMPLEX
+    if (lv_draw_mask_apply(row, vis.x1, ry, w) == LV_DRAW_MASK_RES_TRANSP) continue;
+#endif
+    bd.mask_res = LV_DRAW_MASK_RES_CHANGED;
+    lv_draw_sw_blend(ctx, &bd);
+  }
+  lv_mem_buf_release(row);
+}
+
+void drawMain(lv_obj_t* obj, lv_draw_ctx_t* ctx) {
+  NumLabel* n = (NumLabel*)obj;
+  if (!n->text[0]) return;
+  const Atlas* a = atlasFor(lv_obj_get_style_text_font(obj, LV_PART_MAIN));
+  if (!a) return;
+
+  lv_draw_label_dsc_t ld;
+  lv_draw_label_dsc_init(&ld);
+  lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &ld);
+  if (ld.opa <= LV_OPA_MIN) return;
+
+  lv_area_t content;
+  lv_obj_get_content_coords(obj, &content);
+  lv_area_t clip;
+  if (!_lv_area_intersect(&clip, &obj->coords, ctx->clip_area)) return;
+
+  lv_coord_t x = penStart(obj, a, n->text, content);
+
+  const lv_area_t* clipOrig = ctx->clip_area;
+  ctx->clip_area = &clip;
+  for (const char* p = n->text; *p; ++p) {
+    const Glyph* g = glyphOf(a, *p);
+    if (!g) {
+      x += a->digitAdv;
+      continue;
+    }
+    if (g->w && g->h) blit(ctx, a, *g, x + g->x, content.y1 + g->y, ld);
+    x += g->adv;
+  }
+  ctx->clip_area = clipOrig;
+}
+
+void constructorCb(const lv_obj_class_t* /*cls*/, lv_obj_t* obj) {
+  lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE);
+  NumLabel* n = (NumLabel*)obj;
+  n->text[0] = '\0';
+  n->widest[0] = '\0';
+}
+
+void eventCb(const lv_obj_class_t* cls, lv_event_t* e);
+
+lv_obj_class_t makeClass() {
+  lv_obj_class_t c;
+  lv_memset_00(&c, sizeof(c));
+  c.base_class = &lv_obj_class;
+  c.constructor_cb = constructorCb;
+  c.event_cb = eventCb;
+  c.width_def = LV_SIZE_CONTENT;
+  c.height_def = LV_SIZE_CONTENT;
+  c.instance_size = sizeof(NumLabel);
+  return c;
+}
+
+const lv_obj_class_t kNumLabelClass = makeClass();
+
+void eventCb(const lv_obj_class_t* /*cls*/, lv_event_t* e) {
+  if (lv_obj_event_base(&kNumLabelClass, e) != LV_RES_OK) return;
+
+  lv_obj_t* obj = lv_event_get_target(e);
+  switch (lv_event_get_code(e)) {
+    case LV_EVENT_GET_SELF_SIZE: {
+      const lv_font_t* font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+      const Atlas* a = atlasFor(font);
+      if (!a) break;
+      NumLabel* n = (NumLabel*)obj;
+      lv_point_t* size = (lv_point_t*)lv_event_get_param(e);
+      size->x = LV_MAX(size->x, textWidth(a, n->widest[0] ? n->widest : n->text));
+      size->y = LV_MAX(size->y, font->line_height);
+      break;
+    }
+    case LV_EVENT_STYLE_CHANGED:
+      lv_obj_refresh_self_size(obj);
+      break;
+    case LV_EVENT_DRAW_MAIN:
+      drawMain(obj, lv_event_get_draw_ctx(e));
+      break;
+    default:
+      break;
+  }
+}
+
+lv_text_align_t textAlignFor(lv_align_t align) {
+  switch (align) {
+    case LV_ALIGN_TOP_MID:
+    case LV_ALIGN_BOTTOM_MID:
+    case LV_ALIGN_CENTER:
+      return LV_TEXT_ALIGN_CENTER;
+    case LV_ALIGN_TOP_RIGHT:
+    case LV_ALIGN_BOTTOM_RIGHT:
+    case LV_ALIGN_RIGHT_MID:
+      return LV_TEXT_ALIGN_RIGHT;
+    default:
+      return LV_TEXT_ALIGN_LEFT;
+  }
+}
+
+size_t append(char* out, size_t cap, size_t n, const char* s) {
+  while (*s && n + 1 < cap) out[n++] = *s++;
+  if (cap) out[n < cap ? n : cap - 1] = '\0';
+  return n;
+}
+
+}  // namespace
+
+lv_obj_t* numLabelCreate(lv_obj_t* parent, const lv_font_t* font, const char* widest) {
+  lv_obj_t* obj = lv_obj_class_create_obj(&kNumLabelClass, parent);
+  lv_obj_class_init_obj(obj);
+  if (font) lv_obj_set_style_text_font(obj, font, LV_PART_MAIN);
+  if (widest) strlcpy(((NumLabel*)obj)->widest, widest, kMaxText + 1);
+  lv_obj_refresh_self_size(obj);
+  return obj;
+}
+
+lv_obj_t* numLabelReplace(lv_obj_t* label, const char* widest) {
+  if (!label || !lv_obj_is_valid(label)) return nullptr;
+  lv_obj_t* obj = numLabelCreate(lv_obj_get_parent(label), lv_obj_get_style_text_font(label, LV_PART_MAIN), widest);
+  lv_obj_set_style_text_color(obj, lv_obj_get_style_text_color(label, LV_PART_MAIN), LV_PART_MAIN);
+  lv_obj_set_style_text_opa(obj, lv_obj_get_style_text_opa(label, LV_PART_MAIN), LV_PART_MAIN);
+  const lv_align_t align = (lv_align_t)lv_obj_get_style_align(label, LV_PART_MAIN);
+  const lv_coord_t width = lv_obj_get_style_width(label, LV_PART_MAIN);
+  lv_text_align_t textAlign = (lv_text_align_t)lv_obj_get_style_text_align(label, LV_PART_MAIN);
+  if (width == LV_SIZE_CONTENT && (textAlign == LV_TEXT_ALIGN_AUTO || textAlign == LV_TEXT_ALIGN_LEFT)) {
+    // A content-sized label is anchored by its alignment point; keep the
+    // text on that point now that the box is sized for the widest value
+    textAlign = textAlignFor(align);
+  }
+  lv_obj_set_style_text_align(obj, textAlign, LV_PART_MAIN);
+  lv_obj_set_size(obj, width, lv_obj_get_style_height(label, LV_PART_MAIN));
+  lv_obj_set_align(obj, align);
+  lv_obj_set_pos(obj, lv_obj_get_style_x(label, LV_PART_MAIN), lv_obj_get_style_y(label, LV_PART_MAIN));
+  lv_obj_add_flag(obj, (lv_obj_flag_t)(label->flags & (LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_IGNORE_LAYOUT |
+                                                       LV_OBJ_FLAG_FLOATING)));
+  numLabelSetText(obj, lv_label_get_text(label));
+  lv_obj_move_to_index(obj, lv_obj_get_index(label));
+  lv_obj_del(label);
+  return obj;
+}
+
+bool numLabelIs(const lv_obj_t* obj) { return obj && lv_obj_check_type(obj, &kNumLabelClass); }
+
+void numLabelSetText(lv_obj_t* obj, const char* text) {
+  if (!obj) return;
+  if (!numLabelIs(obj)) {
+    if (lv_obj_check_type(obj, &lv_label_class)) lv_label_set_text(obj, text);
+    return;
+  }
+  NumLabel* n = (NumLabel*)obj;
+  if (strncmp(n->text, text, kMaxText) == 0) return;
+  char old[kMaxText + 1];
+  memcpy(old, n->text, sizeof(old));
+  strlcpy(n->text, text, sizeof(n->text));
+
+  const Atlas* a = atlasFor(lv_obj_get_style_text_font(obj, LV_PART_MAIN));
+  if (!n->widest[0] && (!a || textWidth(a, old) != textWidth(a, n->text))) {
+    // Sized by its text, and that changed
+    lv_obj_refresh_self_size(obj);
+    lv_obj_invalidate(obj);
+  } else if (!a || !gDiff) {
+    lv_obj_invalidate(obj);
+  } else {
+    invalidateChanged(obj, a, old, n->text);
+  }
+}
+
+void numLabelEnableDiff(bool en) { gDiff = en; }
+
+void numLabelSetFloat(lv_obj_t* obj, float value, uint8_t decimals, const char* suffix) {
+  char buf[kMaxText + 1];
+  size_t n = formatFixed(buf, sizeof(buf), value, decimals);
+  append(buf, sizeof(buf), n, suffix);
+  numLabelSetText(obj, buf);
+}
+
+void numLabelSetInt(lv_obj_t* obj, int32_t value, const char* suffix) {
+  char buf[kMaxText + 1];
+  size_t n = formatInt(buf, sizeof(buf), value);
+  append(buf, sizeof(buf), n, suffix);
+  numLabelSetText(obj, buf);
+}
+
+size_t formatInt(char* out, size_t cap, int32_t value) {
+  char tmp[12];
+  size_t n = 0;
+  uint32_t u = value < 0 ? 0u - (uint32_t)value : (uint32_t)value;
+  do {
+    tmp[n++] = (char)('0' + u % 10);
+    u /= 10;
+  } while (u);
+  if (value < 0) tmp[n++] = '-';
+  if (n + 1 > cap) return append(out, cap, 0, "");
+  for (size_t i = 0; i < n; ++i) out[i] = tmp[n - 1 - i];
+  out[n] = '\0';
+  return n;
+}
+
+size_t formatFixed(char* out, size_t cap, float value, uint8_t decimals) {
+  static const uint32_t kPow10[] = {1, 10, 100, 1000, 10000, 100000, 1000000};
+  if (decimals > 6) decimals = 6;
+  const double scaled = fabs((double)value) * kPow10[decimals];
+  if (!isfinite(value) || scaled >= 1e15) return append(out, cap, 0, "--");
+
+  uint64_t q = (uint64_t)(scaled + 0.5);
+  char tmp[24];
+  size_t n = 0;
+  for (uint8_t i = 0; i < decimals; ++i) {
+    tmp[n++] = (char)('0' + q % 10);
+    q /= 10;
+  }
+  if (decimals) tmp[n++] = '.';
+  do {
+    tmp[n++] = (char)('0' + q % 10);
+    q /= 10;
+  } while (q);
+  // No "-0.0": only values that still round to non-zero keep the sign
+  bool nonZero = false;
+  for (size_t i = 0; i < n; ++i) nonZero |= (tmp[i] > '0');
+  if (value < 0 && nonZero) tmp[n++] = '-';
+  if (n + 1 > cap) return append(out, cap, 0, "");
+  for (size_t i = 0; i < n; ++i) out[i] = tmp[n - 1 - i];
+  out[n] = '\0';
+  return n;
+}
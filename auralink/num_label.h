@@ -0,0 +1,37 @@
+#pragma once
+#include <lvgl.h>
+
+// Numeric readout drawn from a pre-rasterised glyph atlas. The first time a
+// font is used, its "0123456789.,-+:% " glyphs are unpacked into 8-bit alpha
+// masks that any text colour can be applied to. Drawing a value is then one
+// alpha-masked fill per character: no text layout, kerning lookup or glyph
+// decoding. Digits share the advance of the widest one, so a value does
+// not shift sideways as it changes. Unless the label had a fixed width, the
+// widget's width is set at creation from the `widest` text it will show.
+//
+// The setters format without printf and redraw only the characters that
+// changed: "23.4" -> "23.5" invalidates the boxes of the old and the new
+// last digit, not the whole readout. Without a `widest` text, the widget is
+// laid out again when the width of its text changes. They also accept a
+// plain lv_label, so callers work the same before and after
+// numLabelReplace().
+
+lv_obj_t* numLabelCreate(lv_obj_t* parent, const lv_font_t* font, const char* widest);
+// Puts a numeric label where `label` was (parent, index, alignment, offset,
+// size, font, colour and text alignment) and deletes `label`
+lv_obj_t* numLabelReplace(lv_obj_t* label, const char* widest);
+bool numLabelIs(const lv_obj_t* obj);
+
+// Characters outside the atlas are drawn as blanks of the digit width
+void numLabelSetText(lv_obj_t* obj, const char* text);
+// NaN and infinities show as "--"
+void numLabelSetFloat(lv_obj_t* obj, float value, uint8_t decimals, const char* suffix = "");
+void numLabelSetInt(lv_obj_t* obj, int32_t value, const char* suffix = "");
+
+// Enabled by default. Disabled, every change invalidates the whole widget;
+// the panel shows the same either way.
+void numLabelEnableDiff(bool en);
+
+// printf-free formatting behind the setters; return the length written
+size_t formatFixed(char* out, size_t cap, float value, uint8_t decimals);
+size_t formatInt(char* out, size_t cap, int32_t value);
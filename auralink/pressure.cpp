@@ -2,6 +2,9 @@
 #include "pressure.h"
 #include "danger.h"
 #include "lv_functions.h"
+#include "memory_tiers.h"
+#include "num_label.h"
+#include "trace.h"
 
 #include "TFT_eSPI.h"
 #include <lvgl.h>
@@ -24,25 +27,27 @@ void updatePressureUI(bool force) {
 
     const ColorOpacity co = getDangerColorPressure(pres_avg);
 
-    LV_SAFE(ui_PressureContainer, {
-        lv_obj_set_style_bg_color(ui_PressureContainer, co.color, LV_PART_MAIN | LV_STATE_DEFAULT);
-        lv_obj_set_style_bg_opa  (ui_PressureContainer, co.opacity, LV_PART_MAIN | LV_STATE_DEFAULT);
-    });
+    LV_SAFE(ui_PressureContainer, setDangerTile(ui_PressureContainer, co));
 
     LV_SAFE(ui_Pressure, {
-        lv_label_set_text_fmt(ui_Pressure, "%.2f", pres_avg);
+        numLabelSetFloat(ui_Pressure, pres_avg, 2);
     });
 
     Serial.printf("[PRESSURE]: pres_imm=%.2f pres_avg=%.2f temp_imm=%.2f temp_avg=%.2f\n", pres_imm, pres_avg, temp_imm, temp_avg);
 }
 
-Pressure::Pressure(size_t window) : _bmp(), _window(window) {
-    _buf = (_window > 0) ? new PressureTemperature[_window]() : nullptr;
+// Room pressure moves over minutes: 1 Hz on a door slam or HVAC swing,
+// one sample every 30 s otherwise
+static const AdaptiveSampler::Params PRESSURE_SAMPLING = {1000, 30000, 0.1f, 0.2f};
+
+Pressure::Pressure(size_t window) : _bmp(), _window(window), _sampler("pressure", PRESSURE_SAMPLING) {
+    _buf = (_window > 0) ? (PressureTemperature*)memCalloc(MemTier::Psram, _window, sizeof(PressureTemperature))
+                         : nullptr;
     reset();
 }
 
 Pressure::~Pressure() {
-    delete[] _buf;
+    memFree(_buf);
     _buf = nullptr;
 }
 
@@ -55,17 +60,29 @@ bool Pressure::begin() {
     return true;
 }
 
-void Pressure::read() {
+bool Pressure::read() {
     if (!_ok) {
         Serial.println("[BMP180] Sensor not initialized!");
-        return;
+        return false;
     }
 
     PressureTemperature pt;
     pt.temperature = _bmp.readTemperature();
-    pt.pressure = _bmp.readPressure() / 100.0f;  // convert to hPa
+    int32_t pa = _bmp.readPressure();
+    pt.pressure = pa / 100.0f;  // convert to hPa
+    sensorTrace.bmp180(PRESSURE_SENSOR_ADDRESS, pa, (int16_t)lroundf(pt.temperature * 100.0f));
+
+    // The driver has no error path; a missing device reads back as 0xFF.. garbage
+    if (pt.pressure < 300.0f || pt.pressure > 1100.0f || pt.temperature < -40.0f || pt.temperature > 85.0f) {
+        _sampler.missed(millis());
+        return false;
+    }
 
+    _last = pt;
+    // Samples taken at the slow rate would hold the average back
+    if (_sampler.update(pt.pressure, millis())) reset();
     add(pt);
+    return true;
 }
 
 void Pressure::reset() {
@@ -81,19 +98,16 @@ void Pressure::reset() {
     }
 }
 
-PressureTemperature Pressure::readImmediate() {
-    PressureTemperature pt;
-    pt.temperature = _bmp.readTemperature();
-    pt.pressure = _bmp.readPressure() / 100.0f;  // convert to hPa
-    return pt;
+PressureTemperature Pressure::readImmediate() const {
+    return _last;
 }
 
-float Pressure::readImmediatePressure() {
-    return _bmp.readPressure() / 100.0f;  // convert to hPa
+float Pressure::readImmediatePressure() const {
+    return _last.pressure;
 }
 
-float Pressure::readImmediateTemperature() {
-    return _bmp.readTemperature();
+float Pressure::readImmediateTemperature() const {
+    return _last.temperature;
 }
 
 PressureTemperature Pressure::average() const {
@@ -2,6 +2,8 @@
 #include <Adafruit_BMP085.h>
 #include <Adafruit_Sensor.h>
 
+#include "sampler.h"
+
 void updatePressureUI(bool force = false);
 
 struct PressureTemperature {
@@ -14,13 +16,17 @@ class Pressure {
     Pressure(size_t window = 20);
     ~Pressure();
     bool begin();
-    void read();
+    bool read();
+    // Whether the adaptive sampling policy wants a new reading
+    bool due() const { return _sampler.due(millis()); }
+    const AdaptiveSampler& sampler() const { return _sampler; }
     void reset();
     void readPressure();
     void readTemperature();
-    PressureTemperature readImmediate();
-    float readImmediatePressure();
-    float readImmediateTemperature();
+    // Last sample taken by read() (no new bus transaction)
+    PressureTemperature readImmediate() const;
+    float readImmediatePressure() const;
+    float readImmediateTemperature() const;
     PressureTemperature average() const;
     float averagePressure() const;
     float averageTemperature() const;
@@ -34,6 +40,8 @@ class Pressure {
     float _sumPressure = 0.0f;
     float _sumTemperature = 0.0f;
     bool _ok = false;
+    PressureTemperature _last{0.0f, 0.0f};
+    AdaptiveSampler _sampler;
 
     void add(PressureTemperature pt);
 };
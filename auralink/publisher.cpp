@@ -0,0 +1,120 @@
+#include "publisher.h"
+
+#include <ArduinoJson.h>
+#include <math.h>
+
+#include "memory_tiers.h"
+
+ReportPublisher::ReportPublisher() : ReportPublisher(Params{}) {}
+
+ReportPublisher::ReportPublisher(const Params& p) : _p(p) {}
+
+bool ReportPublisher::addField(const char* key, Getter get, float absDeadband, float relDeadband, LevelFn level,
+                               Format format) {
+  if (_count >= kMaxFields || !key || !get) return false;
+  Field& f = _fields[_count++];
+  f.key = key;
+  f.get = get;
+  f.level = level;
+  f.format = format;
+  f.absDeadband = absDeadband;
+  f.relDeadband = relDeadband;
+  return true;
+}
+
+bool ReportPublisher::_changed(const Field& f) const {
+  bool nowValid = !isnan(f.value);
+  bool sentValid = !isnan(f.sent);
+  if (nowValid != sentValid) return true;
+  if (!nowValid) return false;
+
+  float band = fmaxf(f.absDeadband, f.relDeadband * fabsf(f.sent));
+  float delta = fabsf(f.value - f.sent);
+  return (band > 0.0f) ? (delta >= band) : (delta > 0.0f);
+}
+
+// A reading leaves its band only once it is a deadband past the band's edge,
+// so a value sitting on an edge doesn't flap between two bands
+uint8_t ReportPublisher::_level(const Field& f) const {
+  uint8_t l = f.level(f.value);
+  if (!f.leveled || l == f.curLevel) return l;
+  float h = fmaxf(f.absDeadband, f.relDeadband * fabsf(f.value));
+  if (f.level(f.value - h) == f.curLevel || f.level(f.value + h) == f.curLevel) return f.curLevel;
+  return l;
+}
+
+void ReportPublisher::loop() {
+  if (!_publish || _count == 0) return;
+
+  uint32_t now = millis();
+  bool changed = false;
+  bool danger = false;
+
+  for (uint8_t i = 0; i < _count; ++i) {
+    Field& f = _fields[i];
+    f.value = f.get();
+    if (_changed(f)) changed = true;
+    if (!f.level || isnan(f.value)) continue;
+    f.curLevel = _level(f);
+    f.leveled = true;
+    if (isnan(f.sent)) continue;
+    if (f.curLevel > f.sentLevel) danger = true;        // escalation: publish at once
+    else if (f.curLevel < f.sentLevel) changed = true;  // back to a safer band
+  }
+
+  Reason reason;
+  if (!_everSent) {
+    reason = Reason::Startup;
+  } else if (danger) {
+    reason = Reason::Danger;  // no rate limit: alert latency is one sampling period
+  } else if (changed && (now - _lastSent) >= _p.minIntervalMs) {
+    reason = Reason::Change;
+  } else if ((now - _lastSent) >= _p.heartbeatMs) {
+    reason = Reason::Heartbeat;
+  } else {
+    return;
+  }
+
+  // Fields stay dirty until the transport takes a report; don't build one on
+  // every pass meanwhile
+  if (_retrying && (now - _lastTry) < _p.minIntervalMs) return;
+  _lastTry = now;
+  _retrying = (_ready && !_ready()) || !_send(reason);
+  if (_retrying) return;
+
+  _everSent = true;
+  _lastSent = now;
+  _published++;
+  if (reason == Reason::Danger) _alerts++;
+  if (reason == Reason::Heartbeat) _heartbeats++;
+
+  for (uint8_t i = 0; i < _count; ++i) {
+    Field& f = _fields[i];
+    f.sent = f.value;
+    if (f.leveled) f.sentLevel = f.curLevel;
+  }
+}
+
+bool ReportPublisher::_send(Reason reason) {
+  static const char* const kReasons[] = {"startup", "danger", "change", "heartbeat"};
+
+  JsonDocument doc(jsonAllocator());
+  for (uint8_t i = 0; i < _count; ++i) {
+    const Field& f = _fields[i];
+    if (isnan(f.value)) continue;
+    switch (f.format) {
+      case Format::Int:  doc[f.key] = lroundf(f.value); break;
+      case Format::Bool: doc[f.key] = f.value != 0.0f; break;
+      default:           doc[f.key] = f.value; break;
+    }
+  }
+  doc["reason"] = kReasons[(uint8_t)reason];
+
+  char buf[kMaxReport];
+  if (measureJson(doc) >= sizeof(buf)) {
+    Serial.println("[PUBLISH] report does not fit the buffer");
+    return false;
+  }
+  size_t n = serializeJson(doc, buf, sizeof(buf));
+  return _publish((const uint8_t*)buf, n);
+}
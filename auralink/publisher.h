@@ -0,0 +1,85 @@
+#pragma once
+#include <Arduino.h>
+
+// Report-by-exception sensor publisher. A snapshot of every field goes out
+// when any field moves past its deadband (rate-limited), immediately when a
+// field escalates into a worse danger band, and at least once per heartbeat.
+// A band only changes once the value is a deadband past its edge. While the
+// transport isn't ready, or refuses a report, no report is built and the
+// next try waits minIntervalMs.
+class ReportPublisher {
+public:
+  struct Params {
+    uint32_t heartbeatMs   = 60000;  // maximum silence
+    uint32_t minIntervalMs = 1000;   // floor between deadband-triggered reports and retries
+  };
+
+  enum class Format : uint8_t { Float, Int, Bool };
+
+  // Longest serialized report; a larger one is refused and retried. The MQTT
+  // buffer (MqttClient::Params::bufferSize) fits it plus topic and header.
+  static constexpr size_t kMaxReport = 384;
+
+  // Current value of a field; NAN leaves it out of the report
+  using Getter = float(*)();
+  // Danger band of a value (see danger.h); a change publishes immediately
+  using LevelFn = uint8_t(*)(float);
+  // Hands a serialized report to the transport; false = not sent, retry
+  using PublishFn = bool(*)(const uint8_t* payload, size_t len);
+  // Whether the transport can take a report now
+  using ReadyFn = bool(*)();
+
+  ReportPublisher();
+  ReportPublisher(const Params& p);
+  ~ReportPublisher() = default;
+
+  // A change counts once |v - last| >= max(absDeadband, relDeadband * |last|)
+  bool addField(const char* key, Getter get, float absDeadband, float relDeadband = 0.0f,
+                LevelFn level = nullptr, Format format = Format::Float);
+  void onPublish(PublishFn fn) { _publish = fn; }
+  void onReady(ReadyFn fn) { _ready = fn; }
+
+  // Evaluates every field and publishes if needed; call once per loop
+  void loop();
+
+  uint32_t published()    const { return _published; }
+  uint32_t alerts()       const { return _alerts; }
+  uint32_t heartbeats()   const { return _heartbeats; }
+
+private:
+  static constexpr uint8_t kMaxFields = 12;
+
+  enum class Reason : uint8_t { Startup, Danger, Change, Heartbeat };
+
+  struct Field {
+    const char* key = nullptr;
+    Getter   get = nullptr;
+    LevelFn  level = nullptr;
+    Format   format = Format::Float;
+    float    absDeadband = 0.0f;
+    float    relDeadband = 0.0f;
+    float    value = NAN;      // current reading
+    float    sent = NAN;       // last published
+    bool     leveled = false;  // curLevel holds a band
+    uint8_t  curLevel = 0;     // band of the current reading, with hysteresis
+    uint8_t  sentLevel = 0;
+  };
+
+  bool _changed(const Field& f) const;
+  uint8_t _level(const Field& f) const;
+  bool _send(Reason reason);
+
+  Params    _p;
+  Field     _fields[kMaxFields];
+  uint8_t   _count = 0;
+  PublishFn _publish = nullptr;
+  ReadyFn   _ready = nullptr;
+
+  bool      _everSent = false;
+  bool      _retrying = false;  // the last report due was not taken
+  uint32_t  _lastSent = 0;
+  uint32_t  _lastTry = 0;
+  uint32_t  _published = 0;
+  uint32_t  _alerts = 0;
+  uint32_t  _heartbeats = 0;
+};
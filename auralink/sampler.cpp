@@ -0,0 +1,56 @@
+#include "sampler.h"
+
+#include <math.h>
+
+AdaptiveSampler* AdaptiveSampler::_all[AdaptiveSampler::kMaxSamplers] = {};
+uint8_t AdaptiveSampler::_count = 0;
+
+// Weight of the newest sample in the rolling mean/variance
+static const float STAT_ALPHA = 0.25f;
+
+AdaptiveSampler::AdaptiveSampler(const char* name, const Params& p)
+    : _name(name), _p(p), _intervalMs(p.minIntervalMs) {
+  if (_p.maxIntervalMs < _p.minIntervalMs) _p.maxIntervalMs = _p.minIntervalMs;
+  if (_count < kMaxSamplers) _all[_count++] = this;
+}
+
+bool AdaptiveSampler::update(float value, uint32_t now) {
+  if (!isfinite(value)) {
+    missed(now);
+    return false;
+  }
+
+  if (_samples == 0) {
+    _started = true;
+    _mean = value;
+    _var = 0.0f;
+    _lastMs = now;
+    _samples = 1;
+    return false;
+  }
+
+  // Exponentially weighted mean/variance; the rate is taken on the mean so
+  // ADC noise at the fastest interval does not read as a transient
+  float dtSec = (float)(now - _lastMs) / 1000.0f;
+  float d = value - _mean;
+  float prevMean = _mean;
+  _mean += STAT_ALPHA * d;
+  _var = (1.0f - STAT_ALPHA) * (_var + STAT_ALPHA * d * d);
+  float rate = (dtSec > 0.0f) ? fabsf(_mean - prevMean) / dtSec : 0.0f;
+
+  float scale = _p.relative ? fmaxf(fabsf(_mean), 1.0f) : 1.0f;
+  bool moving = rate > _p.rateThreshold * scale || sqrtf(_var) > _p.stdThreshold * scale;
+
+  bool woke = moving && _intervalMs > _p.minIntervalMs;
+  if (moving) {
+    _intervalMs = _p.minIntervalMs;
+  } else {
+    // Back off by 25 % per steady sample
+    uint32_t next = _intervalMs + max<uint32_t>(1, _intervalMs / 4);
+    _intervalMs = min(next, _p.maxIntervalMs);
+  }
+
+  _lastMs = now;
+  _samples++;
+  return woke;
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <Arduino.h>
+
+// Per-sensor adaptive sampling policy. The interval drops to the floor as
+// soon as the signal moves (rate-of-change or rolling std dev above the
+// sensor's threshold) and grows back toward the ceiling while it is steady.
+// Every sampler registers itself so diagnostics can list the live rates.
+class AdaptiveSampler {
+public:
+  struct Params {
+    uint32_t minIntervalMs = 100;    // fastest rate, used during transients
+    uint32_t maxIntervalMs = 5000;   // slowest rate, reached when steady
+    float    rateThreshold = 1.0f;   // units/s that count as a transient
+    float    stdThreshold  = 1.0f;   // rolling std dev that counts as a transient
+    bool     relative      = false;  // thresholds are fractions of |mean| (e.g. lux)
+  };
+
+  AdaptiveSampler(const char* name, const Params& p);
+  ~AdaptiveSampler() = default;
+
+  // Whether the sensor should be read now
+  bool due(uint32_t now) const { return !_started || (now - _lastMs) >= _intervalMs; }
+  // Feed the new reading; picks the next interval. True when it drops to the
+  // floor from a slower rate: a transient started, and a window of samples
+  // taken at the slow rate spans far more time than the fast ones to come.
+  bool update(float value, uint32_t now);
+  // The read failed; retry after the current interval instead of every loop
+  void missed(uint32_t now) { _started = true; _lastMs = now; _misses++; }
+
+  const char* name()       const { return _name; }
+  uint32_t    intervalMs() const { return _intervalMs; }
+  float       rateHz()     const { return 1000.0f / (float)_intervalMs; }
+  uint32_t    samples()    const { return _samples; }
+  uint32_t    misses()     const { return _misses; }
+  bool        active()     const { return _intervalMs == _p.minIntervalMs; }
+
+  static uint8_t count() { return _count; }
+  static const AdaptiveSampler* at(uint8_t i) { return (i < _count) ? _all[i] : nullptr; }
+
+private:
+  static constexpr uint8_t kMaxSamplers = 12;
+  static AdaptiveSampler* _all[kMaxSamplers];
+  static uint8_t _count;
+
+  const char* _name;
+  Params   _p;
+  uint32_t _intervalMs;
+  bool     _started = false;
+  uint32_t _lastMs = 0;
+  uint32_t _samples = 0;
+  uint32_t _misses = 0;
+  float    _mean = 0.0f;
+  float    _var = 0.0f;
+};
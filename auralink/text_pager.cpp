@@ -0,0 +1,285 @@
+#include "text_pager.h"
+
+#include <Arduino.h>
+
+#include "User_Setup.h"
+#include "memory_tiers.h"
+
+namespace {
+
+struct TextPager {
+  lv_obj_t    obj;
+  char*       text;
+  uint16_t    len;
+  uint16_t*   lines;      // start of each line; lines[lineCount] == len
+  uint16_t    lineCount;
+  uint16_t    lineCap;
+  uint16_t    page;
+  lv_coord_t  wrapWidth;  // width `lines` was built for, -1 when stale
+};
+
+constexpr lv_opa_t kIndicatorOpa = LV_OPA_60;
+
+bool reserveLines(TextPager* t, uint32_t n) {
+  if (n <= t->lineCap) return true;
+  uint32_t cap = t->lineCap ? t->lineCap * 2u : 32u;
+  while (cap < n) cap *= 2u;
+  uint16_t* lines = (uint16_t*)memRealloc(MemTier::Psram, t->lines, cap * sizeof(uint16_t));
+  if (!lines) return false;
+  t->lines = lines;
+  t->lineCap = (uint16_t)LV_MIN(cap, 0xFFFFu);
+  return true;
+}
+
+// Same breaks as lv_draw_label: _lv_txt_get_next_line over the content width
+void wrap(TextPager* t, const lv_font_t* font, lv_coord_t letterSpace, lv_coord_t width) {
+  t->lineCount = 0;
+  t->wrapWidth = width;
+  if (!t->len || !reserveLines(t, 1)) return;
+
+  uint32_t start = 0;
+  while (start < t->len) {
+    uint32_t n = _lv_txt_get_next_line(&t->text[start], font, letterSpace, width, nullptr, LV_TEXT_FLAG_NONE);
+    if (n == 0) break;
+    if (!reserveLines(t, t->lineCount + 2u)) {
+      Serial.printf("[PAGER] WARN: line table full at %u lines; rest of the text dropped.\n", t->lineCount);
+      break;
+    }
+    t->lines[t->lineCount++] = (uint16_t)start;
+    start += n;
+  }
+  t->lines[t->lineCount] = (uint16_t)start;
+}
+
+struct Layout {
+  const lv_font_t* font;
+  lv_coord_t lineHeight;  // font line height + line space
+  uint16_t   rows;        // text lines per page
+  uint16_t   pages;
+};
+
+Layout layout(TextPager* t) {
+  lv_obj_t* obj = &t->obj;
+  Layout l;
+  l.font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+  const lv_coord_t lineSpace = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
+  const lv_coord_t width = lv_obj_get_content_width(obj);
+  if (t->wrapWidth != width) wrap(t, l.font, lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN), width);
+
+  l.lineHeight = lv_font_get_line_height(l.font) + lineSpace;
+  const lv_coord_t h = lv_obj_get_content_height(obj);
+  uint16_t fit = (uint16_t)LV_MAX(1, (h + lineSpace) / LV_MAX(1, l.lineHeight));
+  if (t->lineCount <= fit || fit < 2) {
+    l.rows = fit;
+  } else {
+    l.rows = fit - 1;  // the last row carries the page indicator
+  }
+  l.pages = (uint16_t)LV_MAX(1, (t->lineCount + l.rows - 1) / l.rows);
+  if (t->page >= l.pages) t->page = l.pages - 1;
+  return l;
+}
+
+void drawLine(lv_draw_ctx_t* ctx, const lv_draw_label_dsc_t& ld, const char* s, uint32_t n, lv_point_t pos,
+              lv_coord_t width) {
+  if (ld.align == LV_TEXT_ALIGN_CENTER || ld.align == LV_TEXT_ALIGN_RIGHT) {
+    lv_coord_t lw = lv_txt_get_width(s, n, ld.font, ld.letter_space, LV_TEXT_FLAG_NONE);
+    pos.x += ld.align == LV_TEXT_ALIGN_CENTER ? (width - lw) / 2 : width - lw;
+  }
+  uint32_t i = 0;
+  while (i < n) {
+    uint32_t letter, next;
+    _lv_txt_encoded_letter_next_2(s, &letter, &next, &i);
+    const int32_t w = lv_font_get_glyph_width(ld.font, letter, next);
+    if (letter >= 0x20) lv_draw_letter(ctx, &ld, &pos, letter);
+    if (w > 0) pos.x += w + ld.letter_space;
+  }
+}
+
+void drawMain(lv_obj_t* obj, lv_draw_ctx_t* ctx) {
+  TextPager* t = (TextPager*)obj;
+  if (!t->len) return;
+
+  lv_draw_label_dsc_t ld;
+  lv_draw_label_dsc_init(&ld);
+  lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &ld);
+  if (ld.opa <= LV_OPA_MIN || !ld.font) return;
+  if (ld.align == LV_TEXT_ALIGN_AUTO) ld.align = LV_TEXT_ALIGN_LEFT;
+
+  lv_area_t content;
+  lv_obj_get_content_coords(obj, &content);
+  lv_area_t clip;
+  if (!_lv_area_intersect(&clip, &content, ctx->clip_area)) return;
+
+  const Layout l = layout(t);
+  const lv_coord_t width = lv_area_get_width(&content);
+  const lv_coord_t fontHeight = lv_font_get_line_height(l.font);
+  const lv_area_t* clipOrig = ctx->clip_area;
+  ctx->clip_area = &clip;
+
+  const uint32_t first = (uint32_t)t->page * l.rows;
+  const uint32_t last = LV_MIN(first + l.rows, (uint32_t)t->lineCount);
+  lv_point_t pos = {content.x1, content.y1};
+  for (uint32_t i = first; i < last && pos.y <= clip.y2; ++i, pos.y += l.lineHeight) {
+    if (pos.y + fontHeight < clip.y1) continue;
+    drawLine(ctx, ld, &t->text[t->lines[i]], t->lines[i + 1] - t->lines[i], pos, width);
+  }
+
+  if (l.pages > 1) {
+    char buf[12];
+    lv_snprintf(buf, sizeof(buf), "%u/%u", (unsigned)(t->page + 1), (unsigned)l.pages);
+    lv_area_t row = content;
+    row.y1 = content.y1 + l.rows * l.lineHeight;
+    row.y2 = row.y1 + fontHeight - 1;
+    ld.align = LV_TEXT_ALIGN_RIGHT;
+    ld.opa = (lv_opa_t)((ld.opa * kIndicatorOpa) >> 8);
+    lv_draw_label(ctx, &ld, &row, buf, nullptr);
+  }
+  ctx->clip_area = clipOrig;
+}
+
+void constructorCb(const lv_obj_class_t* /*cls*/, lv_obj_t* obj) {
+  lv_obj_clear_flag(obj, (lv_obj_flag_t)(LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE));
+  TextPager* t = (TextPager*)obj;
+  t->text = nullptr;
+  t->len = 0;
+  t->lines = nullptr;
+  t->lineCount = 0;
+  t->lineCap = 0;
+  t->page = 0;
+  t->wrapWidth = -1;
+}
+
+void destructorCb(const lv_obj_class_t* /*cls*/, lv_obj_t* obj) {
+  TextPager* t = (TextPager*)obj;
+  memFree(t->text);
+  memFree(t->lines);
+  t->text = nullptr;
+  t->lines = nullptr;
+}
+
+void eventCb(const lv_obj_class_t* cls, lv_event_t* e);
+
+lv_obj_class_t makeClass() {
+  lv_obj_class_t c;
+  lv_memset_00(&c, sizeof(c));
+  c.base_class = &lv_obj_class;
+  c.constructor_cb = constructorCb;
+  c.destructor_cb = destructorCb;
+  c.event_cb = eventCb;
+  c.width_def = LV_PCT(100);
+  c.height_def = LV_PCT(100);
+  c.instance_size = sizeof(TextPager);
+  return c;
+}
+
+const lv_obj_class_t kTextPagerClass = makeClass();
+
+void eventCb(const lv_obj_class_t* /*cls*/, lv_event_t* e) {
+  if (lv_obj_event_base(&kTextPagerClass, e) != LV_RES_OK) return;
+
+  lv_obj_t* obj = lv_event_get_target(e);
+  switch (lv_event_get_code(e)) {
+    case LV_EVENT_STYLE_CHANGED:
+      ((TextPager*)obj)->wrapWidth = -1;  // the font or letter space may have changed
+      lv_obj_invalidate(obj);
+      break;
+    case LV_EVENT_DRAW_MAIN:
+      drawMain(obj, lv_event_get_draw_ctx(e));
+      break;
+    default:
+      break;
+  }
+}
+
+lv_obj_t* findPager(lv_obj_t* obj) {
+  if (textPagerIs(obj)) return obj;
+  const uint32_t n = lv_obj_get_child_cnt(obj);
+  for (uint32_t i = 0; i < n; ++i) {
+    if (lv_obj_t* p = findPager(lv_obj_get_child(obj, i))) return p;
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+lv_obj_t* textPagerReplace(lv_obj_t* label) {
+  if (!label || !lv_obj_is_valid(label)) return nullptr;
+  lv_obj_t* obj = lv_obj_class_create_obj(&kTextPagerClass, lv_obj_get_parent(label));
+  lv_obj_class_init_obj(obj);
+  lv_obj_set_style_text_font(obj, lv_obj_get_style_text_font(label, LV_PART_MAIN), LV_PART_MAIN);
+  lv_obj_set_style_text_color(obj, lv_obj_get_style_text_color(label, LV_PART_MAIN), LV_PART_MAIN);
+  lv_obj_set_style_text_align(obj, lv_obj_get_style_text_align(label, LV_PART_MAIN), LV_PART_MAIN);
+  lv_obj_set_size(obj, lv_obj_get_style_width(label, LV_PART_MAIN), lv_obj_get_style_height(label, LV_PART_MAIN));
+  lv_obj_set_align(obj, lv_obj_get_style_align(label, LV_PART_MAIN));
+  lv_obj_set_pos(obj, lv_obj_get_style_x(label, LV_PART_MAIN), lv_obj_get_style_y(label, LV_PART_MAIN));
+  lv_obj_add_flag(obj, (lv_obj_flag_t)(label->flags & (LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_IGNORE_LAYOUT |
+                                                       LV_OBJ_FLAG_FLOATING)));
+  textPagerSetText(obj, lv_label_get_text(label));
+  lv_obj_move_to_index(obj, lv_obj_get_index(label));
+  lv_obj_del(label);
+  return obj;
+}
+
+bool textPagerIs(const lv_obj_t* obj) { return obj && lv_obj_check_type(obj, &kTextPagerClass); }
+
+void textPagerSetText(lv_obj_t* obj, const char* text) {
+  if (!obj) return;
+  if (!textPagerIs(obj)) {
+    if (lv_obj_check_type(obj, &lv_label_class)) lv_label_set_text(obj, text);
+    return;
+  }
+  if (!text) text = "";
+
+  TextPager* t = (TextPager*)obj;
+  size_t len = strlen(text);
+  if (len > TEXT_PAGER_MAX_BYTES) {
+    len = TEXT_PAGER_MAX_BYTES;
+    while (len && ((uint8_t)text[len] & 0xC0) == 0x80) --len;  // don't split a UTF-8 sequence
+    Serial.printf("[PAGER] WARN: text cut to %u bytes.\n", (unsigned)len);
+  }
+  if (t->text && len == t->len && memcmp(t->text, text, len) == 0) return;
+
+  char* copy = (char*)memRealloc(MemTier::Psram, t->text, len + 1);
+  if (!copy) {
+    Serial.printf("[PAGER] WARN: no memory for %u bytes; keeping the old text.\n", (unsigned)len);
+    return;
+  }
+  memcpy(copy, text, len);
+  copy[len] = '\0';
+  t->text = copy;
+  t->len = (uint16_t)len;
+  t->page = 0;
+  t->wrapWidth = -1;
+  lv_obj_invalidate(obj);
+}
+
+const char* textPagerText(const lv_obj_t* obj) {
+  if (textPagerIs(obj)) {
+    const TextPager* t = (const TextPager*)obj;
+    return t->text ? t->text : "";
+  }
+  return obj && lv_obj_check_type(obj, &lv_label_class) ? lv_label_get_text(obj) : "";
+}
+
+uint16_t textPagerPage(lv_obj_t* obj) {
+  if (!textPagerIs(obj)) return 0;
+  layout((TextPager*)obj);
+  return ((TextPager*)obj)->page;
+}
+
+uint16_t textPagerPageCount(lv_obj_t* obj) { return textPagerIs(obj) ? layout((TextPager*)obj).pages : 1; }
+
+bool textPagerStep(lv_obj_t* obj, int8_t dir) {
+  if (!textPagerIs(obj) || !dir) return false;
+  TextPager* t = (TextPager*)obj;
+  const int32_t page = (int32_t)t->page + dir;
+  if (page < 0 || page >= layout(t).pages) return false;
+  t->page = (uint16_t)page;
+  lv_obj_invalidate(obj);
+  return true;
+}
+
+bool textPagerStepOn(lv_obj_t* screen, int8_t dir) {
+  if (!screen || !lv_obj_is_valid(screen)) return false;
+  return textPagerStep(findPager(screen), dir);
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <lvgl.h>
+
+// Paginated view for long MQTT-supplied text (email summary, daily quote).
+// The text is copied out of the LVGL heap (TEXT_PAGER_MAX_BYTES at most) and
+// wrapped once into a table of line starts, again only when the width or font
+// changes. Drawing walks the lines of the current page and nothing else, so
+// neither text length nor relayouts reach the frame time. When the text needs
+// more than one page, the bottom row shows "page/pages" instead of text.
+//
+// Lines are wrapped and drawn the way lv_label draws them, so text that fits
+// one page looks identical to the label it replaced.
+
+// Puts a pager where `label` was (parent, index, alignment, offset, size,
+// font and colour), with the label's text, and deletes `label`
+lv_obj_t* textPagerReplace(lv_obj_t* label);
+bool textPagerIs(const lv_obj_t* obj);
+
+// Shows `text` from its first page. Also accepts a plain lv_label.
+void textPagerSetText(lv_obj_t* obj, const char* text);
+const char* textPagerText(const lv_obj_t* obj);
+
+uint16_t textPagerPage(lv_obj_t* obj);
+uint16_t textPagerPageCount(lv_obj_t* obj);
+// Moves `dir` pages; false (and nothing redrawn) past the first or last page
+bool textPagerStep(lv_obj_t* obj, int8_t dir);
+// textPagerStep on the first pager under `screen`; false if there is none
+bool textPagerStepOn(lv_obj_t* screen, int8_t dir);
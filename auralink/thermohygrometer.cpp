@@ -2,6 +2,9 @@
 #include "User_Setup.h"
 #include "danger.h"
 #include "lv_functions.h"
+#include "memory_tiers.h"
+#include "num_label.h"
+#include "trace.h"
 
 #include <TFT_eSPI.h>
 #include <lvgl.h>
@@ -37,11 +40,9 @@ void updateThermohygrometerUI(bool force) {
     if (force || isnan(lastAvgTemp) || fabsf(avgTemp - lastAvgTemp) >= 0.1f) {
         ColorOpacity co = getDangerColorTemperature(avgTemp);
 
-        LV_SAFE(ui_TemperatureContainer, do {
-            lv_obj_set_style_bg_color(ui_TemperatureContainer, co.color, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_opa  (ui_TemperatureContainer, co.opacity, LV_PART_MAIN | LV_STATE_DEFAULT); } while (0));
+        LV_SAFE(ui_TemperatureContainer, setDangerTile(ui_TemperatureContainer, co));
 
-        LV_SAFE(ui_Temperature, lv_label_set_text_fmt(ui_Temperature, "%.1f", avgTemp));
+        LV_SAFE(ui_Temperature, numLabelSetFloat(ui_Temperature, avgTemp, 1));
 
         lastAvgTemp = avgTemp;
     }
@@ -50,11 +51,9 @@ void updateThermohygrometerUI(bool force) {
     if (force || isnan(lastAvgHum) || fabsf(avgHum - lastAvgHum) >= 0.1f) {
         ColorOpacity co = getDangerColorHumidity(avgHum);
 
-        LV_SAFE(ui_RelativeHumidityContainer, do {
-            lv_obj_set_style_bg_color(ui_RelativeHumidityContainer, co.color, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_opa  (ui_RelativeHumidityContainer, co.opacity, LV_PART_MAIN | LV_STATE_DEFAULT); } while (0));
+        LV_SAFE(ui_RelativeHumidityContainer, setDangerTile(ui_RelativeHumidityContainer, co));
 
-        LV_SAFE(ui_RelativeHumidity, lv_label_set_text_fmt(ui_RelativeHumidity, "%.1f", avgHum));
+        LV_SAFE(ui_RelativeHumidity, numLabelSetFloat(ui_RelativeHumidity, avgHum, 1));
 
         lastAvgHum = avgHum;
     }
@@ -64,15 +63,20 @@ void updateThermohygrometerUI(bool force) {
                   thermohygrometer.readImmediateHumidity(), avgHum);
 }
 
-Thermohygrometer::Thermohygrometer(size_t window) : _window(window) {
+// The DHT22 cannot be read faster than every 2 s; steady rooms back off to 30 s
+static const AdaptiveSampler::Params TEMPERATURE_SAMPLING = {2000, 30000, 0.05f, 0.3f};
+static const AdaptiveSampler::Params HUMIDITY_SAMPLING = {2000, 30000, 0.2f, 0.5f};
+
+Thermohygrometer::Thermohygrometer(size_t window)
+    : _window(window), _tempSampler("temperature", TEMPERATURE_SAMPLING), _humSampler("humidity", HUMIDITY_SAMPLING) {
     _buf = (_window > 0)
-               ? new TemperatureHumidity[_window]
-               : nullptr;  // CHANGED: TemperatureHumidity buffer, zero-init
+               ? (TemperatureHumidity*)memCalloc(MemTier::Psram, _window, sizeof(TemperatureHumidity))
+               : nullptr;
     reset();
 }
 
 Thermohygrometer::~Thermohygrometer() {
-    delete[] _buf;
+    memFree(_buf);
     _buf = nullptr;
 }
 
@@ -86,12 +90,37 @@ bool Thermohygrometer::begin(uint8_t pin, uint8_t type) {
 }
 
 void Thermohygrometer::read() {
+    uint32_t now = millis();
+    if (!_tempSampler.due(now) && !_humSampler.due(now)) return;
+
     TemperatureHumidity th = readImmediate();
+    if (sensorTrace.enabled()) traceFrame(th);
+    // Samples taken at the slow rate would hold the average back
+    bool woke = _tempSampler.update(th.temperature, now);
+    woke = _humSampler.update(th.humidity, now) || woke;
+    if (woke) reset();
     if (!isnan(th.temperature) && !isnan(th.humidity)) {
         add(th);
     }
 }
 
+// The DHT22 frame behind a reading: 0.1 %RH, sign-magnitude 0.1 °C, checksum.
+// A failed read is logged with a broken checksum.
+void Thermohygrometer::traceFrame(TemperatureHumidity th) {
+    uint8_t frame[5] = {0xFF, 0xFF, 0xFF, 0xFF, 0x00};
+    if (!isnan(th.temperature) && !isnan(th.humidity)) {
+        uint16_t h = (uint16_t)lroundf(th.humidity * 10.0f);
+        int16_t t = (int16_t)lroundf(th.temperature * 10.0f);
+        uint16_t tw = (t < 0) ? (uint16_t)(0x8000 | -t) : (uint16_t)t;
+        frame[0] = (uint8_t)(h >> 8);
+        frame[1] = (uint8_t)(h & 0xFF);
+        frame[2] = (uint8_t)(tw >> 8);
+        frame[3] = (uint8_t)(tw & 0xFF);
+        frame[4] = (uint8_t)(frame[0] + frame[1] + frame[2] + frame[3]);
+    }
+    sensorTrace.dht(_pin, frame);
+}
+
 void Thermohygrometer::readTemperature() {
     float t = _dht->readTemperature();
     if (!isnan(t)) {
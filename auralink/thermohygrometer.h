@@ -2,6 +2,8 @@
 #include <Arduino.h>
 #include <DHT.h>
 
+#include "sampler.h"
+
 struct TemperatureHumidity
 {
     float temperature;
@@ -16,6 +18,7 @@ class Thermohygrometer {
     ~Thermohygrometer();
 
     bool begin(uint8_t pin, uint8_t type);
+    // Samples only when either channel's adaptive policy says so
     void read();
     void readTemperature();
     void readHumidity();
@@ -26,6 +29,8 @@ class Thermohygrometer {
     TemperatureHumidity average() const;
     float averageTemperature() const;
     float averageHumidity() const;
+    const AdaptiveSampler& temperatureSampler() const { return _tempSampler; }
+    const AdaptiveSampler& humiditySampler() const { return _humSampler; }
 
    private:
     DHT* _dht = nullptr;
@@ -37,8 +42,11 @@ class Thermohygrometer {
     size_t _count = 0;   // how many valid samples in buffer
     double _sumTemp = 0;   // running sum of current window
     double _sumHum = 0;   // running sum of current window
+    AdaptiveSampler _tempSampler;
+    AdaptiveSampler _humSampler;
 
     void add(TemperatureHumidity v);
+    void traceFrame(TemperatureHumidity th);
 };
 
 extern Thermohygrometer thermohygrometer;
\ No newline at end of file
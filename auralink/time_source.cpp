@@ -5,14 +5,13 @@
 
 #include "User_Setup.h"
 #include "lv_functions.h"
+#include "num_label.h"
 
 TimeSource timeSource;
 
 void updateTimeSourceUI(bool force) {
     static uint32_t lastUpdate = 0;
-    static lv_obj_t* ui_sd_Time = nullptr;
-    static lv_obj_t* ui_dq_Time = nullptr;
-    static lv_obj_t* ui_es_Time = nullptr;
+    static lv_obj_t* ui_Time = nullptr;
     uint32_t now = millis();
 
     if ((now - lastUpdate) < UI_SENSOR_UPDATE_INTERVAL_MS && !force) return;
@@ -23,21 +22,18 @@ void updateTimeSourceUI(bool force) {
         return;
     }
 
-    LV_TRY_FIND(ui_sd_Time, ui_SDNotificationBar, UI_COMP_NOTIFICATIONBAR_TIMECONTAINER_TIME);
-    LV_TRY_FIND(ui_dq_Time, ui_DQNotificationBar, UI_COMP_NOTIFICATIONBAR_TIMECONTAINER_TIME);
-    LV_TRY_FIND(ui_es_Time, ui_ESNotificationBar, UI_COMP_NOTIFICATIONBAR_TIMECONTAINER_TIME);
-    if (!lv_obj_ok(ui_sd_Time) && !lv_obj_ok(ui_dq_Time) && !lv_obj_ok(ui_es_Time)) {
+    LV_TRY_FIND(ui_Time, ui_NotificationBar, UI_COMP_NOTIFICATIONBAR_TIMECONTAINER_TIME);
+    if (!lv_obj_ok(ui_Time)) {
         return;
     }
 
     time_t epoch = timeSource.getEpoch();
     struct tm* tm_info = localtime(&epoch);
-    char buffer[6];
-    strftime(buffer, sizeof(buffer), "%H:%M", tm_info);
+    const char buffer[6] = {
+        (char)('0' + tm_info->tm_hour / 10), (char)('0' + tm_info->tm_hour % 10), ':',
+        (char)('0' + tm_info->tm_min / 10), (char)('0' + tm_info->tm_min % 10), '\0'};
 
-    LV_SAFE(ui_sd_Time, { lv_label_set_text(ui_sd_Time, buffer); });
-    LV_SAFE(ui_dq_Time, { lv_label_set_text(ui_dq_Time, buffer); });
-    LV_SAFE(ui_es_Time, { lv_label_set_text(ui_es_Time, buffer); });    
+    LV_SAFE(ui_Time, { numLabelSetText(ui_Time, buffer); });
 }
 
 TimeSource::TimeSource() : _available(false) {
@@ -73,9 +69,20 @@ bool TimeSource::isAvailable() const {
     return _available;
 }
 
+bool TimeSource::read() {
+    if (!_available) return false;
+    DateTime now = _rtc.now();
+    if (!now.isValid()) return false;
+    _epoch = now.unixtime();
+    _epochReadAt = millis();
+    return true;
+}
+
 uint32_t TimeSource::getEpoch() {
     if (!_available) return 0;
-    return _rtc.now().unixtime();
+    if (_epochReadAt == 0 && !read()) return 0;
+    // Extrapolate from the last bus read instead of hitting the RTC every call
+    return _epoch + (millis() - _epochReadAt) / 1000;
 }
 
 void TimeSource::syncCurrentTime() {
@@ -89,6 +96,8 @@ void TimeSource::syncCurrentTime() {
 void TimeSource::setCurrentTime(time_t t) {
     if (!_available) return;
     _rtc.adjust(DateTime(t));
+    _epoch = (uint32_t)t;
+    _epochReadAt = millis();
 }
 
 void TimeSource::_updateFromNTPTime() {
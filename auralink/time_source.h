@@ -15,6 +15,7 @@ class TimeSource {
 
   bool begin(TwoWire* bus = &Wire, long gmtOffsetSec = 0, const String& ntpServer = "pool.ntp.org");
   bool isAvailable() const;
+  bool read();        // refresh the cached RTC time (one bus transaction)
   uint32_t getEpoch();
   void syncCurrentTime();
   void setCurrentTime(time_t t);
@@ -25,6 +26,8 @@ class TimeSource {
   String _ntpServer = "pool.ntp.org";
   long _gmtOffsetSec = 0;
   bool _ntpSynced = false;
+  uint32_t _epoch = 0;        // last RTC reading
+  uint32_t _epochReadAt = 0;  // millis() of that reading
 
   void _updateFromNTPTime();
 };
@@ -0,0 +1,190 @@
+#include "trace.h"
+
+SensorTrace sensorTrace;
+
+static const uint32_t TIME_RECORD_EVERY_MS = 60000;
+
+static void putU16(uint8_t* p, uint16_t v) {
+  p[0] = (uint8_t)(v & 0xFF);
+  p[1] = (uint8_t)(v >> 8);
+}
+
+static void putU32(uint8_t* p, uint32_t v) {
+  for (int i = 0; i < 4; ++i) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+static uint16_t getU16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+
+static uint32_t getU32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+uint8_t SensorTrace::crc8(const uint8_t* data, size_t len) {
+  uint8_t crc = 0;
+  while (len--) {
+    crc ^= *data++;
+    for (int i = 0; i < 8; ++i) crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+  }
+  return crc;
+}
+
+uint8_t SensorTrace::payloadSize(uint8_t type) {
+  switch (type) {
+    case Time:      return 4;
+    case AdcCounts: return 3;
+    case AdcMillis: return 3;
+    case Bh1750Raw: return 3;
+    case Bmp180:    return 7;
+    case DhtFrame:  return 6;
+    case Digital:   return 2;
+    default:        return 0;
+  }
+}
+
+void SensorTrace::begin(Print& out) {
+  _out = &out;
+  _lastMs = millis();
+  _lastTimeRecord = _lastMs;
+  uint8_t p[4];
+  putU32(p, _lastMs);
+  _emit(Time, p, sizeof(p));
+}
+
+void SensorTrace::_emit(uint8_t type, const uint8_t* payload, uint8_t len) {
+  if (!_out) return;
+
+  uint32_t now = millis();
+  if (type != Time && now - _lastTimeRecord >= TIME_RECORD_EVERY_MS) {
+    _lastTimeRecord = now;
+    uint8_t p[4];
+    putU32(p, now);
+    _emit(Time, p, sizeof(p));
+  }
+
+  // Time records carry the absolute clock; their delta is always 0
+  uint32_t dt = (type == Time) ? 0 : now - _lastMs;
+  _lastMs = now;
+
+  // sync + type + up to 5 LEB128 bytes + payload + crc, written in one go so
+  // text logs can only land between records
+  uint8_t buf[16];
+  size_t n = 0;
+  buf[n++] = kSync;
+  buf[n++] = type;
+  do {
+    uint8_t b = dt & 0x7F;
+    dt >>= 7;
+    buf[n++] = dt ? (uint8_t)(b | 0x80) : b;
+  } while (dt);
+  memcpy(&buf[n], payload, len);
+  n += len;
+  buf[n] = crc8(&buf[1], n - 1);
+  n++;
+
+  _out->write(buf, n);
+  _records++;
+  _bytes += n;
+}
+
+void SensorTrace::adc(uint8_t pin, uint16_t counts) {
+  if (!_out) return;
+  uint8_t p[3] = {pin};
+  putU16(&p[1], counts);
+  _emit(AdcCounts, p, sizeof(p));
+}
+
+void SensorTrace::millivolts(uint8_t pin, uint16_t mv) {
+  if (!_out) return;
+  uint8_t p[3] = {pin};
+  putU16(&p[1], mv);
+  _emit(AdcMillis, p, sizeof(p));
+}
+
+void SensorTrace::bh1750(uint8_t addr, uint16_t raw) {
+  if (!_out) return;
+  uint8_t p[3] = {addr};
+  putU16(&p[1], raw);
+  _emit(Bh1750Raw, p, sizeof(p));
+}
+
+void SensorTrace::bmp180(uint8_t addr, int32_t pa, int16_t centiC) {
+  if (!_out) return;
+  uint8_t p[7] = {addr};
+  putU32(&p[1], (uint32_t)pa);
+  putU16(&p[5], (uint16_t)centiC);
+  _emit(Bmp180, p, sizeof(p));
+}
+
+void SensorTrace::dht(uint8_t pin, const uint8_t frame[5]) {
+  if (!_out) return;
+  uint8_t p[6] = {pin};
+  memcpy(&p[1], frame, 5);
+  _emit(DhtFrame, p, sizeof(p));
+}
+
+void SensorTrace::digital(uint8_t pin, uint8_t level) {
+  if (!_out) return;
+  uint8_t p[2] = {pin, level};
+  _emit(Digital, p, sizeof(p));
+}
+
+// ---- reader ----
+
+bool SensorTraceReader::_decode(size_t at, SensorTraceRecord& r, size_t& used) const {
+  size_t i = at + 1;
+  if (i >= _len) return false;
+  uint8_t type = _data[i++];
+  uint8_t size = SensorTrace::payloadSize(type);
+  if (size == 0) return false;
+
+  uint32_t dt = 0;
+  for (int shift = 0;; shift += 7) {
+    if (i >= _len || shift > 28) return false;
+    uint8_t b = _data[i++];
+    dt |= (uint32_t)(b & 0x7F) << shift;
+    if (!(b & 0x80)) break;
+  }
+  if (i + size + 1 > _len) return false;
+  if (SensorTrace::crc8(&_data[at + 1], i + size - (at + 1)) != _data[i + size]) return false;
+
+  const uint8_t* p = &_data[i];
+  r = SensorTraceRecord{};
+  r.type = type;
+  if (type == SensorTrace::Time) {
+    r.timeMs = getU32(p);
+  } else {
+    r.timeMs = _timeMs + dt;
+    r.channel = p[0];
+    switch (type) {
+      case SensorTrace::Bmp180:
+        r.value = (int32_t)getU32(&p[1]);
+        r.value2 = (int16_t)getU16(&p[5]);
+        break;
+      case SensorTrace::DhtFrame:
+        memcpy(r.frame, &p[1], 5);
+        break;
+      case SensorTrace::Digital:
+        r.value = p[1];
+        break;
+      default:
+        r.value = getU16(&p[1]);
+        break;
+    }
+  }
+  used = i + size + 1 - at;
+  return true;
+}
+
+bool SensorTraceReader::next(SensorTraceRecord& r) {
+  while (_pos < _len) {
+    size_t used = 0;
+    if (_data[_pos] == SensorTrace::kSync && _decode(_pos, r, used)) {
+      _pos += used;
+      _timeMs = r.timeMs;
+      return true;
+    }
+    _pos++;
+    _skipped++;
+  }
+  return false;
+}
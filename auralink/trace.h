@@ -0,0 +1,86 @@
+#pragma once
+#include <Arduino.h>
+
+// Raw sensor trace for record-and-replay.
+//
+// When enabled, the sensor classes log the raw sample behind every reading
+// (ADC counts, BH1750 register word, BMP180 result, DHT22 frame, charger pin)
+// to any Print: Serial, an SD file, a host file. Records are small and
+// self-synchronising, so a trace can share Serial with the text logs:
+//
+//   0xA5 | type | dt (LEB128, ms since previous record) | payload | crc8
+//
+// crc8 (poly 0x07) covers type..payload. The payload size is fixed per type.
+// A Time record with the absolute millis() is written at begin() and every
+// minute so a reader that skipped damaged bytes gets back on track.
+class SensorTrace {
+public:
+  enum Type : uint8_t {
+    Time       = 0,  // u32 absolute ms
+    AdcCounts  = 1,  // u8 pin, u16 counts
+    AdcMillis  = 2,  // u8 pin, u16 calibrated mV
+    Bh1750Raw  = 3,  // u8 addr, u16 result register
+    Bmp180     = 4,  // u8 addr, i32 Pa, i16 centi-°C
+    DhtFrame   = 5,  // u8 pin, 5-byte frame (bad checksum = failed read)
+    Digital    = 6,  // u8 pin, u8 level
+  };
+
+  static constexpr uint8_t kSync = 0xA5;
+
+  void begin(Print& out);
+  void end() { _out = nullptr; }
+  bool enabled() const { return _out != nullptr; }
+
+  void adc(uint8_t pin, uint16_t counts);
+  void millivolts(uint8_t pin, uint16_t mv);
+  void bh1750(uint8_t addr, uint16_t raw);
+  void bmp180(uint8_t addr, int32_t pa, int16_t centiC);
+  void dht(uint8_t pin, const uint8_t frame[5]);
+  void digital(uint8_t pin, uint8_t level);
+
+  uint32_t records() const { return _records; }
+  uint32_t bytes()   const { return _bytes; }
+
+  static uint8_t crc8(const uint8_t* data, size_t len);
+  static uint8_t payloadSize(uint8_t type);
+
+private:
+  void _emit(uint8_t type, const uint8_t* payload, uint8_t len);
+
+  Print*   _out = nullptr;
+  uint32_t _lastMs = 0;
+  uint32_t _lastTimeRecord = 0;
+  uint32_t _records = 0;
+  uint32_t _bytes = 0;
+};
+
+extern SensorTrace sensorTrace;
+
+// One decoded record
+struct SensorTraceRecord {
+  uint8_t  type = 0;
+  uint32_t timeMs = 0;
+  uint8_t  channel = 0;     // pin or I2C address
+  int32_t  value = 0;       // counts, mV, raw register, Pa, level
+  int16_t  value2 = 0;      // centi-°C for Bmp180
+  uint8_t  frame[5] = {};   // DhtFrame
+};
+
+// Walks a captured byte stream; anything that is not a valid record (text
+// logs, line noise) is skipped.
+class SensorTraceReader {
+public:
+  SensorTraceReader(const uint8_t* data, size_t len) : _data(data), _len(len) {}
+
+  bool next(SensorTraceRecord& r);
+  size_t skippedBytes() const { return _skipped; }
+
+private:
+  bool _decode(size_t at, SensorTraceRecord& r, size_t& used) const;
+
+  const uint8_t* _data;
+  size_t   _len;
+  size_t   _pos = 0;
+  size_t   _skipped = 0;
+  uint32_t _timeMs = 0;
+};
@@ -0,0 +1,564 @@
+#include "ui_bench.h"
+
+#include <draw/sw/lv_draw_sw.h>
+#include <ui.h>
+
+#include "battery.h"
+#include "danger.h"
+#include "display_manager.h"
+#include "lv_functions.h"
+#include "memory_tiers.h"
+#include "num_label.h"
+#include "text_pager.h"
+#include "update_ui.h"
+
+namespace {
+
+struct Frame {
+    uint32_t scriptCyc, timersCyc, renderCyc, flushCyc;
+    uint32_t blendCyc, labelCyc, imgCyc;
+    uint32_t area, blends;
+    uint16_t labels, imgs, flushes;
+    uint32_t changed;
+    uint32_t styleLookups, styleHits;
+};
+
+struct Totals {
+    uint16_t frames = 0, rendered = 0, overruns = 0;
+    uint32_t renderMax = 0;
+    uint64_t scriptCyc = 0, timersCyc = 0, renderCyc = 0, flushCyc = 0;
+    uint64_t blendCyc = 0, labelCyc = 0, imgCyc = 0;
+    uint64_t area = 0, blends = 0, labels = 0, imgs = 0, flushes = 0, changed = 0;
+    uint64_t styleLookups = 0, styleHits = 0;
+
+    void add(const Frame& f, bool overrun) {
+        frames++;
+        if (f.renderCyc) rendered++;
+        if (overrun) overruns++;
+        if (f.renderCyc > renderMax) renderMax = f.renderCyc;
+        scriptCyc += f.scriptCyc; timersCyc += f.timersCyc;
+        renderCyc += f.renderCyc; flushCyc += f.flushCyc;
+        blendCyc += f.blendCyc; labelCyc += f.labelCyc; imgCyc += f.imgCyc;
+        area += f.area; blends += f.blends; labels += f.labels; imgs += f.imgs;
+        flushes += f.flushes; changed += f.changed;
+        styleLookups += f.styleLookups; styleHits += f.styleHits;
+    }
+};
+
+struct Phase {
+    const char* name;
+    uint16_t    frames;
+    void (*step)(uint16_t frame, DisplayManager& dm);
+};
+
+// Live counters for the frame being measured; the LVGL hooks below are plain
+// C callbacks, so they reach it through file scope.
+Frame    gFrame;
+uint32_t gDrawStart = 0;
+
+// Damage tracking: what the panel shows, to count the flushed pixels that
+// actually change. Its own time is kept out of the render column.
+uint16_t* gShadow = nullptr;
+uint32_t  gDamageCyc = 0;
+
+lv_timer_cb_t gRefrCb = nullptr;
+void (*gFlushCb)(lv_disp_drv_t*, const lv_area_t*, lv_color_t*) = nullptr;
+void (*gMonitorCb)(lv_disp_drv_t*, uint32_t, uint32_t) = nullptr;
+void (*gBlendCb)(lv_draw_ctx_t*, const lv_draw_sw_blend_dsc_t*) = nullptr;
+
+inline uint32_t cycles() { return ESP.getCycleCount(); }
+
+void refrHook(lv_timer_t* t) {
+    gDamageCyc = 0;
+    uint32_t c0 = cycles();
+    gRefrCb(t);
+    gFrame.renderCyc += cycles() - c0 - gDamageCyc;
+}
+
+// Counts the pixels of a flushed area that differ from the panel and updates
+// the shadow to match
+void trackDamage(lv_disp_drv_t* drv, const lv_area_t* area, const lv_color_t* color_p) {
+    uint32_t c0 = cycles();
+    for (lv_coord_t y = area->y1; y <= area->y2; ++y) {
+        uint16_t* row = gShadow + (size_t)y * drv->hor_res;
+        for (lv_coord_t x = area->x1; x <= area->x2; ++x, ++color_p) {
+            if (row[x] != color_p->full) {
+                row[x] = color_p->full;
+                gFrame.changed++;
+            }
+        }
+    }
+    gDamageCyc += cycles() - c0;
+}
+
+void flushHook(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_p) {
+    if (gShadow) trackDamage(drv, area, color_p);
+    gFrame.flushes++;
+    uint32_t c0 = cycles();
+    gFlushCb(drv, area, color_p);
+    gFrame.flushCyc += cycles() - c0;
+}
+
+// px: pixels redrawn after LVGL joined the invalidated areas
+void monitorHook(lv_disp_drv_t* drv, uint32_t time, uint32_t px) {
+    gFrame.area += px;
+    if (gMonitorCb) gMonitorCb(drv, time, px);
+}
+
+void blendHook(lv_draw_ctx_t* ctx, const lv_draw_sw_blend_dsc_t* dsc) {
+    uint32_t c0 = cycles();
+    gBlendCb(ctx, dsc);
+    gFrame.blendCyc += cycles() - c0;
+    gFrame.blends++;
+}
+
+// Labels and images have no children, so MAIN_BEGIN..MAIN_END brackets
+// exactly their own drawing
+void drawBeginHook(lv_event_t* e) {
+    (void)e;
+    gDrawStart = cycles();
+}
+
+void drawEndHook(lv_event_t* e) {
+    uint32_t dt = cycles() - gDrawStart;
+    if (lv_event_get_user_data(e)) {
+        gFrame.imgCyc += dt;
+        gFrame.imgs++;
+    } else {
+        gFrame.labelCyc += dt;
+        gFrame.labels++;
+    }
+}
+
+void watchTree(lv_obj_t* obj, bool add) {
+    bool isImg = lv_obj_check_type(obj, &lv_img_class);
+    bool isText = lv_obj_check_type(obj, &lv_label_class) || numLabelIs(obj) || textPagerIs(obj);
+    if (isImg || isText) {
+        if (add) {
+            lv_obj_add_event_cb(obj, drawBeginHook, LV_EVENT_DRAW_MAIN_BEGIN, nullptr);
+            lv_obj_add_event_cb(obj, drawEndHook, LV_EVENT_DRAW_MAIN_END, isImg ? (void*)1 : nullptr);
+        } else {
+            lv_obj_remove_event_cb(obj, drawBeginHook);
+            lv_obj_remove_event_cb(obj, drawEndHook);
+        }
+    }
+    uint32_t n = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < n; ++i) watchTree(lv_obj_get_child(obj, i), add);
+}
+
+void watchDisplay(lv_disp_t* disp, bool add) {
+    for (uint32_t i = 0; i < disp->screen_cnt; ++i) watchTree(disp->screens[i], add);
+    watchTree(disp->top_layer, add);
+    watchTree(disp->sys_layer, add);
+}
+
+void hook(lv_disp_t* disp) {
+    lv_timer_t* refr = _lv_disp_get_refr_timer(disp);
+    gRefrCb = refr->timer_cb;
+    lv_timer_set_cb(refr, refrHook);
+
+    gFlushCb = disp->driver->flush_cb;
+    disp->driver->flush_cb = flushHook;
+    gMonitorCb = disp->driver->monitor_cb;
+    disp->driver->monitor_cb = monitorHook;
+
+    lv_draw_sw_ctx_t* sw = (lv_draw_sw_ctx_t*)disp->driver->draw_ctx;
+    gBlendCb = sw->blend;
+    sw->blend = blendHook;
+
+    watchDisplay(disp, true);
+}
+
+void unhook(lv_disp_t* disp) {
+    watchDisplay(disp, false);
+    ((lv_draw_sw_ctx_t*)disp->driver->draw_ctx)->blend = gBlendCb;
+    disp->driver->monitor_cb = gMonitorCb;
+    disp->driver->flush_cb = gFlushCb;
+    lv_timer_set_cb(_lv_disp_get_refr_timer(disp), gRefrCb);
+}
+
+// ---- script ----
+
+void setTile(lv_obj_t* container, lv_obj_t* label, uint8_t decimals, float v, ColorOpacity co) {
+    LV_SAFE_DO(container, { setDangerTile(_o, co); });
+    LV_SAFE_DO(label, { numLabelSetFloat(_o, v, decimals); });
+}
+
+void stepIdle(uint16_t, DisplayManager&) {}
+
+void stepFullRedraw(uint16_t, DisplayManager&) { lv_obj_invalidate(lv_scr_act()); }
+
+// Every tile changes each frame, with values sweeping through the danger
+// bands: the worst case of all sensors publishing on the same UI tick
+void stepSensorTick(uint16_t f, DisplayManager&) {
+    float aqi = 30.0f + 6.0f * f;
+    float t   = 16.0f + 0.35f * f;
+    float rh  = 25.0f + 1.1f * f;
+    float hpa = 990.0f + 0.9f * f;
+    float lux = 20.0f * powf(1.2f, (float)f);
+    float uvi = 0.25f * f;
+    setTile(ui_AirQualityContainer, ui_AirQuality, 0, aqi, getDangerColorAirQuality(aqi));
+    setTile(ui_TemperatureContainer, ui_Temperature, 1, t, getDangerColorTemperature(t));
+    setTile(ui_RelativeHumidityContainer, ui_RelativeHumidity, 1, rh, getDangerColorHumidity(rh));
+    setTile(ui_PressureContainer, ui_Pressure, 2, hpa, getDangerColorPressure(hpa));
+    setTile(ui_IlluminationContainer, ui_Illumination, 2, lux, getDangerColorIllumination(lux));
+    setTile(ui_UVContainer, ui_UVV, 2, uvi, getDangerColorUVIndex(uvi));
+}
+
+// Every readout moves by its last digit each frame, within its danger band:
+// the usual sensor update, where only a character or two change
+void stepReadoutTick(uint16_t f, DisplayManager&) {
+    float aqi = 40.0f + f;
+    float t   = 21.0f + 0.1f * f;
+    float rh  = 45.0f + 0.1f * f;
+    float hpa = 1013.0f + 0.01f * f;
+    float lux = 300.0f + 0.01f * f;
+    float uvi = 1.0f + 0.01f * f;
+    setTile(ui_AirQualityContainer, ui_AirQuality, 0, aqi, getDangerColorAirQuality(aqi));
+    setTile(ui_TemperatureContainer, ui_Temperature, 1, t, getDangerColorTemperature(t));
+    setTile(ui_RelativeHumidityContainer, ui_RelativeHumidity, 1, rh, getDangerColorHumidity(rh));
+    setTile(ui_PressureContainer, ui_Pressure, 2, hpa, getDangerColorPressure(hpa));
+    setTile(ui_IlluminationContainer, ui_Illumination, 2, lux, getDangerColorIllumination(lux));
+    setTile(ui_UVContainer, ui_UVV, 2, uvi, getDangerColorUVIndex(uvi));
+}
+
+// A new charge level every 12 frames on the notification bar
+void stepBattery(uint16_t f, DisplayManager&) {
+    static const int8_t LEVELS[] = {100, 64, 35, 12, 80};
+    if (f % 12 == 0) showBatteryUI(LEVELS[(f / 12) % sizeof(LEVELS)]);
+}
+
+// An email summary several pages long
+const char* longSummary() {
+    static const char PARA[] =
+        "Standup moved to 10:30 tomorrow; the vendor call is now Thursday. Invoice #2291 was approved "
+        "and paid. Two build failures on main overnight, both fixed by the morning. ";
+    static char text[6 * sizeof(PARA)];
+    if (!text[0]) {
+        for (int i = 0; i < 6; ++i) memcpy(text + i * (sizeof(PARA) - 1), PARA, sizeof(PARA));
+    }
+    return text;
+}
+
+// Slides to EmailSummary, shows a summary several pages long and pages
+// through it, then puts the old text back and slides home
+void stepPages(uint16_t f, DisplayManager& dm) {
+    static String saved;
+    if (f == 0) dm.prev();
+    if (f == 12) {
+        saved = textPagerText(ui_EmailSummaryLabel);
+        updateEmailSummary(longSummary());
+    }
+    if (f > 12 && f < 32 && f % 4 == 0) textPagerStepOn(lv_scr_act(), +1);
+    if (f == 32) {
+        updateEmailSummary(saved.c_str());
+        dm.next();
+    }
+}
+
+// SensorData -> DailyQuote -> EmailSummary -> SensorData, letting each
+// slide animation finish
+void stepRotate(uint16_t f, DisplayManager& dm) {
+    if (f % 20 == 0) dm.next();
+}
+
+void printPhase(Print& out, const char* name, const Totals& t, uint32_t mhz) {
+    uint32_t n = t.frames ? t.frames : 1;
+    uint32_t d = t.rendered ? t.rendered : 1;
+    auto us = [mhz](uint64_t cyc) { return (unsigned long)(cyc / mhz); };
+    // Everything but script/timers (per frame) is per drawn frame
+    out.printf("[UIBENCH] %-12s %6u %6u %7lu %7lu %7lu %7lu %7lu %7lu %7lu %7lu %6lu %6lu %6lu %7lu %5lu\n", name,
+               t.frames, t.rendered, us(t.renderCyc / d), us(t.renderMax), (unsigned long)(t.area / d),
+               (unsigned long)(t.changed / d), us(t.blendCyc / d), us(t.labelCyc / d), us(t.imgCyc / d),
+               us(t.flushCyc / d), (unsigned long)(t.flushes / d), us(t.scriptCyc / n), us(t.timersCyc / n),
+               (unsigned long)(t.styleLookups / d),
+               (unsigned long)(t.styleLookups ? t.styleHits * 100 / t.styleLookups : 0));
+}
+
+struct StyleStat {
+    uint32_t lookups = 0, hits = 0;
+};
+
+StyleStat styleStat() {
+    StyleStat s;
+#if LV_OBJ_STYLE_CACHE
+    lv_obj_style_cache_stat_t st;
+    lv_obj_get_style_cache_stat(&st);
+    s.lookups = st.lookups;
+    s.hits = st.hits;
+#endif
+    return s;
+}
+
+// Resolves what drawing asks of every object's main part (rect, label and
+// image descriptors), like a full redraw of every screen minus the drawing
+void resolveTree(lv_obj_t* obj) {
+    lv_draw_rect_dsc_t rect;
+    lv_draw_rect_dsc_init(&rect);
+    lv_obj_init_draw_rect_dsc(obj, LV_PART_MAIN, &rect);
+    lv_draw_label_dsc_t label;
+    lv_draw_label_dsc_init(&label);
+    lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &label);
+    lv_draw_img_dsc_t img;
+    lv_draw_img_dsc_init(&img);
+    lv_obj_init_draw_img_dsc(obj, LV_PART_MAIN, &img);
+    uint32_t n = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < n; ++i) resolveTree(lv_obj_get_child(obj, i));
+}
+
+// Cycles for one resolveTree pass over the shown screen (what a frame draws),
+// averaged over `passes`
+uint32_t resolvePass(lv_disp_t* disp, uint16_t passes) {
+    uint32_t c0 = cycles();
+    for (uint16_t p = 0; p < passes; ++p) {
+        resolveTree(lv_disp_get_scr_act(disp));
+        resolveTree(disp->top_layer);
+    }
+    return (cycles() - c0) / passes;
+}
+
+// Cycles to break `text` into lines the way the pager on `obj` does when its
+// text changes (text_pager.cpp wrap()), averaged over `passes`
+uint32_t layoutPass(lv_obj_t* obj, const char* text, uint16_t passes) {
+    const lv_font_t* font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    const lv_coord_t letterSpace = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
+    const lv_coord_t width = lv_obj_get_content_width(obj);
+    const uint32_t len = strlen(text);
+    uint32_t c0 = cycles();
+    for (uint16_t p = 0; p < passes; ++p) {
+        uint32_t start = 0;
+        while (start < len) {
+            uint32_t n = _lv_txt_get_next_line(&text[start], font, letterSpace, width, nullptr, LV_TEXT_FLAG_NONE);
+            if (n == 0) break;
+            start += n;
+        }
+    }
+    return (cycles() - c0) / passes;
+}
+
+// Cycles for one round of looking up every child of the notification bar
+// component the way LV_CHILD does, averaged over `passes`
+uint32_t compChildPass(uint16_t passes) {
+    uint32_t c0 = cycles();
+    for (uint16_t p = 0; p < passes; ++p) {
+        for (uint32_t id = 0; id < _UI_COMP_NOTIFICATIONBAR_NUM; ++id) ui_comp_get_child(ui_NotificationBar, id);
+    }
+    return (cycles() - c0) / passes;
+}
+
+// Sends a component child lookup to `obj` and everything under it; all but
+// the components have no callback for it. Returns the number of objects.
+uint32_t lookupTree(lv_obj_t* obj) {
+    ui_comp_get_child(obj, 0);
+    uint32_t cnt = 1;
+    uint32_t n = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < n; ++i) cnt += lookupTree(lv_obj_get_child(obj, i));
+    return cnt;
+}
+
+const Phase PHASES[] = {
+    {"idle", 20, stepIdle},
+    {"full_redraw", 10, stepFullRedraw},
+    {"sensor_tick", 40, stepSensorTick},
+    {"readout_tick", 40, stepReadoutTick},
+    {"battery_bar", 60, stepBattery},
+    {"pages", 44, stepPages},
+    {"rotate", 60, stepRotate},
+};
+
+}  // namespace
+
+UiBench::UiBench() : UiBench(Params{}) {}
+
+UiBench::UiBench(const Params& p) : _p(p) {}
+
+bool UiBench::run(lv_disp_t* disp, DisplayManager& dm, Print& out) {
+    if (!disp || !disp->driver->draw_ctx) return false;
+
+    const uint32_t mhz = ESP.getCpuFreqMHz();
+    auto us = [mhz](uint64_t cyc) { return (unsigned long)(cyc / mhz); };
+
+    // Start from a settled first screen with no automatic rotation
+    dm.setAutoRotate(false);
+    if (dm.active() != 0) dm.setActive(0);
+    for (uint16_t i = 0; i < 20; ++i) {
+        lv_timer_handler();
+        delay(_p.frameMs);
+    }
+
+    // Render on every handler call instead of waiting for the refresh timer
+    lv_timer_t* refr = _lv_disp_get_refr_timer(disp);
+    uint32_t refrPeriod = refr->period;
+    lv_timer_set_period(refr, 1);
+    hook(disp);
+    if (_p.damage) {
+        // Redraw everything once to learn what the panel shows
+        gShadow = (uint16_t*)memAlloc(MemTier::Psram,
+                                      (size_t)disp->driver->hor_res * disp->driver->ver_res * sizeof(uint16_t));
+        if (gShadow) {
+            lv_obj_invalidate(lv_scr_act());
+            lv_refr_now(disp);
+        } else {
+            out.printf("[UIBENCH] no memory for damage tracking\n");
+        }
+    }
+#if LV_OBJ_STYLE_CACHE
+    lv_obj_enable_style_cache(_p.styleCache);
+#endif
+    lv_draw_sw_rect_enable_mask_cache(_p.maskCache);
+    lv_font_fmt_txt_enable_lut(_p.fontLut);
+    lv_draw_sw_letter_enable_cache(_p.glyphCache);
+    lv_obj_enable_event_mask(_p.eventMask);
+    lv_draw_img_enable_transform_cache(_p.imgCache);
+    numLabelEnableDiff(_p.labelDiff);
+    lv_draw_sw_glyph_cache_stat_t g0;
+    lv_draw_sw_letter_get_cache_stat(&g0);
+    lv_draw_img_cache_stat_t i0;
+    lv_draw_img_get_transform_cache_stat(&i0);
+
+    out.printf("[UIBENCH] %ux%u, %u ms frames, %lu MHz; times in us, averaged over drawn frames\n",
+               (unsigned)disp->driver->hor_res, (unsigned)disp->driver->ver_res, _p.frameMs, (unsigned long)mhz);
+    out.printf("[UIBENCH] %-12s %6s %6s %7s %7s %7s %7s %7s %7s %7s %7s %6s %6s %6s %7s %5s\n", "phase", "frames",
+               "drawn", "render", "max", "area", "changed", "blend", "label", "img", "flush", "areas", "script",
+               "timers", "styles", "hit%");
+
+    Totals all;
+    uint32_t budget = (uint32_t)_p.frameMs * mhz * 1000u;
+    for (const Phase& ph : PHASES) {
+        Totals t;
+        for (uint16_t f = 0; f < ph.frames; ++f) {
+            uint32_t start = millis();
+            gFrame = Frame{};
+
+            StyleStat s0 = styleStat();
+            uint32_t c0 = cycles();
+            ph.step(f, dm);
+            uint32_t c1 = cycles();
+            lv_anim_refr_now();
+            lv_timer_handler();
+            uint32_t c2 = cycles();
+            StyleStat s1 = styleStat();
+
+            gFrame.styleLookups = s1.lookups - s0.lookups;
+            gFrame.styleHits = s1.hits - s0.hits;
+            gFrame.scriptCyc = c1 - c0;
+            gFrame.timersCyc = (c2 - c1) - gFrame.renderCyc;
+            bool overrun = (c2 - c0) > budget;
+            t.add(gFrame, overrun);
+            all.add(gFrame, overrun);
+
+            if (_p.perFrame) {
+                out.printf("[UIBENCH] %s[%u] render=%lu area=%lu changed=%lu blend=%lu/%lu label=%lu/%u img=%lu/%u "
+                           "flush=%lu/%u script=%lu timers=%lu styles=%lu/%lu\n",
+                           ph.name, f, us(gFrame.renderCyc), (unsigned long)gFrame.area,
+                           (unsigned long)gFrame.changed, us(gFrame.blendCyc), (unsigned long)gFrame.blends,
+                           us(gFrame.labelCyc), gFrame.labels, us(gFrame.imgCyc), gFrame.imgs, us(gFrame.flushCyc),
+                           gFrame.flushes, us(gFrame.scriptCyc), us(gFrame.timersCyc),
+                           (unsigned long)gFrame.styleHits, (unsigned long)gFrame.styleLookups);
+            }
+
+            uint32_t spent = millis() - start;
+            if (spent < _p.frameMs) delay(_p.frameMs - spent);
+        }
+        printPhase(out, ph.name, t, mhz);
+    }
+
+    lv_draw_sw_glyph_cache_stat_t g1;
+    lv_draw_sw_letter_get_cache_stat(&g1);
+    lv_draw_img_cache_stat_t i1;
+    lv_draw_img_get_transform_cache_stat(&i1);
+    unhook(disp);
+    if (gShadow) {
+        memFree(gShadow);
+        gShadow = nullptr;
+    }
+    lv_timer_set_period(refr, refrPeriod);
+#if LV_OBJ_STYLE_CACHE
+    lv_obj_enable_style_cache(true);
+#endif
+    lv_draw_sw_rect_enable_mask_cache(true);
+    lv_font_fmt_txt_enable_lut(true);
+    lv_draw_sw_letter_enable_cache(true);
+    lv_obj_enable_event_mask(true);
+    lv_draw_img_enable_transform_cache(true);
+    numLabelEnableDiff(true);
+    dm.setAutoRotate(true);
+
+    printPhase(out, "total", all, mhz);
+    if (_p.damage && all.area) {
+        out.printf("[UIBENCH] damage: %lu px flushed, %lu px changed (%lu%%)\n", (unsigned long)all.area,
+                   (unsigned long)all.changed, (unsigned long)(all.changed * 100 / all.area));
+    }
+    if (g1.hits + g1.misses != g0.hits + g0.misses) {
+        uint32_t hits = g1.hits - g0.hits, misses = g1.misses - g0.misses;
+        out.printf("[UIBENCH] glyph cache: %lu glyphs drawn, %lu%% from the cache, %lu decoded, %lu B held\n",
+                   (unsigned long)(hits + misses), (unsigned long)(hits * 100 / (hits + misses)),
+                   (unsigned long)misses, (unsigned long)g1.size);
+    }
+    if (all.imgs) {
+        out.printf("[UIBENCH] images: %lu drawn, %.2f us per image", (unsigned long)all.imgs,
+                   (double)all.imgCyc / mhz / all.imgs);
+        uint32_t hits = i1.hits - i0.hits, misses = i1.misses - i0.misses;
+        if (hits + misses) {
+            out.printf("; %lu zoomed, %lu%% from the transform cache, %lu B held", (unsigned long)(hits + misses),
+                       (unsigned long)(hits * 100 / (hits + misses)), (unsigned long)i1.size);
+        }
+        out.printf("\n");
+    }
+
+#if LV_OBJ_STYLE_CACHE
+    // Style resolution on its own, with and without the cache
+    resolvePass(disp, 1);
+    StyleStat r0 = styleStat();
+    uint32_t cached = resolvePass(disp, 10);
+    StyleStat r1 = styleStat();
+    lv_obj_enable_style_cache(false);
+    uint32_t uncached = resolvePass(disp, 10);
+    lv_obj_enable_style_cache(true);
+    out.printf("[UIBENCH] style resolve: %lu lookups per pass over the shown screen, %lu us cached (%lu%% hits), "
+               "%lu us uncached\n",
+               (unsigned long)((r1.lookups - r0.lookups) / 10), us(cached),
+               (unsigned long)((r1.hits - r0.hits) * 100 / LV_MAX(1u, r1.lookups - r0.lookups)), us(uncached));
+#endif
+
+#if LV_FONT_FMT_TXT_LUT
+    // Line breaking of the long summary on its own, with and without the
+    // glyph tables
+    layoutPass(ui_EmailSummaryLabel, longSummary(), 1);
+    uint32_t lut = layoutPass(ui_EmailSummaryLabel, longSummary(), 10);
+    lv_font_fmt_txt_enable_lut(false);
+    uint32_t search = layoutPass(ui_EmailSummaryLabel, longSummary(), 10);
+    lv_font_fmt_txt_enable_lut(true);
+    out.printf("[UIBENCH] text layout: %u letters of email summary, %lu us with the glyph tables, %lu us searched\n",
+               (unsigned)strlen(longSummary()), us(lut), us(search));
+#endif
+
+#if LV_OBJ_EVENT_MASK
+    // Component child lookups on their own, on the notification bar and on
+    // every object of the shown screen, with and without the code masks
+    auto ns = [mhz](uint64_t cyc) { return (unsigned long)(cyc * 1000 / mhz); };
+    lv_obj_t* scr = lv_disp_get_scr_act(disp);
+    compChildPass(1);
+    uint32_t objs = lookupTree(scr);
+    uint32_t barMasked = compChildPass(100);
+    uint32_t c0 = cycles();
+    for (uint16_t p = 0; p < 100; ++p) lookupTree(scr);
+    uint32_t treeMasked = (cycles() - c0) / 100;
+    lv_obj_enable_event_mask(false);
+    uint32_t barScanned = compChildPass(100);
+    c0 = cycles();
+    for (uint16_t p = 0; p < 100; ++p) lookupTree(scr);
+    uint32_t treeScanned = (cycles() - c0) / 100;
+    lv_obj_enable_event_mask(true);
+    out.printf("[UIBENCH] comp child: %u lookups on the notification bar %lu ns masked, %lu ns scanned; "
+               "on all %lu objects %lu ns masked, %lu ns scanned\n",
+               (unsigned)_UI_COMP_NOTIFICATIONBAR_NUM, ns(barMasked), ns(barScanned), (unsigned long)objs,
+               ns(treeMasked), ns(treeScanned));
+#endif
+
+    if (all.overruns) {
+        out.printf("[UIBENCH] WARN: %u of %u frames overran the %u ms budget\n", all.overruns, all.frames,
+                   _p.frameMs);
+    }
+    return all.overruns == 0;
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <Arduino.h>
+#include <lvgl.h>
+
+class DisplayManager;
+
+// Frame-time benchmark over the real SquareLine screens. Plays a fixed script
+// (idle, full redraw, sensor values sweeping through the danger bands and
+// ticking by their last digit, battery bar animation, paging a long email
+// summary, screen rotation through DisplayManager::next) one frame per
+// refresh period and reports, per phase, the render time, the
+// redrawn area and the number of areas flushed, the time spent in
+// lv_draw_sw_blend, text and image drawing, plus the style lookups and their
+// cache hit rate, how many glyphs came from the glyph raster cache, the time
+// per image and how many zoomed images came from the transform cache. With
+// `damage` it also keeps a copy of the panel to count how many of the flushed
+// pixels actually changed. Timing uses the CPU cycle counter, so the same
+// code measures on the device and on the host.
+// With LV_OBJ_STYLE_CACHE it closes with the cost of resolving the draw
+// styles of every object on the shown screen, with the cache and without,
+// with LV_FONT_FMT_TXT_LUT with the cost of breaking the long email summary
+// into lines, with the glyph tables and without, and with LV_OBJ_EVENT_MASK
+// with the cost of SquareLine component child lookups, with the event code
+// masks and without.
+//
+// Text (label column) and image times include the blending they trigger.
+// LVGL is hooked only for the duration of run().
+class UiBench {
+   public:
+    struct Params {
+        uint16_t frameMs    = LV_DISP_DEF_REFR_PERIOD;  // script step and frame budget
+        bool     perFrame   = false;                    // also print one line per frame
+        bool     styleCache = true;                     // LV_OBJ_STYLE_CACHE on during the script
+        bool     maskCache  = true;                     // LV_RECT_MASK_CACHE_SIZE on during the script
+        bool     fontLut    = true;                     // LV_FONT_FMT_TXT_LUT on during the script
+        bool     glyphCache = true;                     // LV_GLYPH_CACHE_SIZE on during the script
+        bool     eventMask  = true;                     // LV_OBJ_EVENT_MASK on during the script
+        bool     imgCache   = true;                     // LV_IMG_TRANSFORM_CACHE_SIZE on during the script
+        bool     labelDiff  = true;                     // numeric labels redraw only changed characters
+        bool     damage     = false;                    // count changed pixels (a panel-sized PSRAM buffer)
+    };
+
+    UiBench();
+    explicit UiBench(const Params& p);
+    ~UiBench() = default;
+
+    // Runs the whole script on `disp` and prints the report to `out`. Ends on
+    // the first screen with auto-rotation re-enabled. Returns false if any
+    // frame (script + timers + render) overran frameMs.
+    bool run(lv_disp_t* disp, DisplayManager& dm, Print& out);
+
+   private:
+    Params _p;
+};
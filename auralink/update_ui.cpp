@@ -2,6 +2,8 @@
 #include "lv_functions.h"
 #include "User_Setup.h"
 #include "danger.h"
+#include "num_label.h"
+#include "text_pager.h"
 
 #include <Arduino.h>
 #include <lvgl.h>
@@ -9,13 +11,13 @@
 
 void updateEmailSummary(const char* summary) {
     LV_SAFE(ui_EmailSummaryLabel, {
-        lv_label_set_text(ui_EmailSummaryLabel, summary);
+        textPagerSetText(ui_EmailSummaryLabel, summary);
     });
 }
 
 void updateDailyQuote(const char* quote) {
     LV_SAFE(ui_QuoteLabel, {
-        lv_label_set_text(ui_QuoteLabel, quote);
+        textPagerSetText(ui_QuoteLabel, quote);
     });
 }
 
@@ -30,14 +32,41 @@ void updateUVIndexUI(UV& instance, bool force) {
     
     ColorOpacity co = getDangerColorUVIndex(uv_avg);
 
-    LV_SAFE(ui_UVContainer, {
-        lv_obj_set_style_bg_color(ui_UVContainer, co.color, LV_PART_MAIN | LV_STATE_DEFAULT);
-        lv_obj_set_style_bg_opa(ui_UVContainer, co.opacity, LV_PART_MAIN | LV_STATE_DEFAULT);
-    });
+    LV_SAFE(ui_UVContainer, setDangerTile(ui_UVContainer, co));
 
     LV_SAFE(ui_UVV, {
-        lv_label_set_text_fmt(ui_UVV, "%.2f", uv_avg);
+        numLabelSetFloat(ui_UVV, uv_avg, 2);
     });
 
     Serial.printf("[UVINDEX]: imm=%.2f avg=%.2f\n", uv_imm, uv_avg);
-}
\ No newline at end of file
+}
+
+namespace {
+
+void replaceChild(lv_obj_t* component, uint32_t id, const char* widest) {
+    if (!lv_obj_ok(component)) return;
+    lv_obj_t** children = (lv_obj_t**)lv_obj_get_event_user_data(component, get_component_child_event_cb);
+    if (!children || !lv_obj_ok(children[id])) return;
+    // The component's child table still points at the label until patched
+    children[id] = numLabelReplace(children[id], widest);
+}
+
+}  // namespace
+
+void installNumericLabels() {
+    // Widest text each readout will show, so the widget never resizes
+    ui_AirQuality       = numLabelReplace(ui_AirQuality, "000");
+    ui_Temperature      = numLabelReplace(ui_Temperature, "-00.0");
+    ui_RelativeHumidity = numLabelReplace(ui_RelativeHumidity, "100.0");
+    ui_Pressure         = numLabelReplace(ui_Pressure, "0000.00");
+    ui_Illumination     = numLabelReplace(ui_Illumination, "00000.00");
+    ui_UVV              = numLabelReplace(ui_UVV, "00.00");
+
+    replaceChild(ui_NotificationBar, UI_COMP_NOTIFICATIONBAR_BATTERYCONTAINER_BATTERYTEXT, "100%");
+    replaceChild(ui_NotificationBar, UI_COMP_NOTIFICATIONBAR_TIMECONTAINER_TIME, "00:00");
+}
+
+void installTextPagers() {
+    ui_EmailSummaryLabel = uic_EmailSummaryLabel = textPagerReplace(ui_EmailSummaryLabel);
+    ui_QuoteLabel        = uic_QuoteLabel        = textPagerReplace(ui_QuoteLabel);
+}
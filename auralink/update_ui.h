@@ -5,4 +5,12 @@
 void updateEmailSummary(const char* summary);
 void updateDailyQuote(const char* quote);
 
-void updateUVIndexUI(UV& instance, bool force = false);
\ No newline at end of file
+void updateUVIndexUI(UV& instance, bool force = false);
+
+// Swaps the email summary and quote labels for paged views (text_pager.h).
+// Call once after ui_init().
+void installTextPagers();
+
+// Swaps the sensor readouts, battery percentage and clock for atlas-drawn
+// numeric labels (num_label.h). Call once after ui_init().
+void installNumericLabels();
\ No newline at end of file
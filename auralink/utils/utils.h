@@ -1,11 +1,13 @@
 #ifndef UTILS_H
 #define UTILS_H
 #include <stdint.h>
-// Convert hexadecimal 16-bit color to 565 format
+// Convert hexadecimal 24-bit color to 565 format, byte-swapped like
+// lv_color_t.full so it can be stored in LVGL buffers or sent to the panel as is
 inline uint16_t hex565(uint32_t hexcolor) {
     uint8_t r = (hexcolor >> 16) & 0xFF;
     uint8_t g = (hexcolor >> 8) & 0xFF;
     uint8_t b = hexcolor & 0xFF;
-    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+    uint16_t c = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+    return (uint16_t)((c << 8) | (c >> 8));
 }
 #endif // UTILS_H
\ No newline at end of file
@@ -1,13 +1,19 @@
 #include "uv.h"
 
+#include "memory_tiers.h"
+#include "trace.h"
+
+// 10 Hz while the index moves, down to one sample every 5 s when steady
+static const AdaptiveSampler::Params UV_SAMPLING = {100, 5000, 0.5f, 0.3f};
+
 UV::UV(size_t window)
-    : _window(window) {
-    _buf = (_window > 0) ? new float[_window]() : nullptr;
+    : _window(window), _sampler("uv", UV_SAMPLING) {
+    _buf = (_window > 0) ? (float*)memCalloc(MemTier::Psram, _window, sizeof(float)) : nullptr;
     reset();
 }
 
 UV::~UV() {
-    delete[] _buf;
+    memFree(_buf);
     _buf = nullptr;
 }
 
@@ -31,13 +37,18 @@ bool UV::begin(uint8_t pin) {
 
 void UV::read() {
     if (!_ok) return;
+    uint32_t now = millis();
+    if (!_sampler.due(now)) return;
 
     (void)analogRead(_pin);
     delayMicroseconds(50);
 
     uint16_t raw_adc = analogRead(_pin);
+    sensorTrace.adc(_pin, raw_adc);
     float uvi = _calculateUVIndex(raw_adc);
 
+    // Samples taken at the slow rate would hold the average back
+    if (_sampler.update(uvi, now)) reset();
     _add(uvi);
 }
 
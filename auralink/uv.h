@@ -2,6 +2,8 @@
 
 #include <Arduino.h>
 
+#include "sampler.h"
+
 // UV sensor with 0-1V output connected to an analog pin
 
 class UV {
@@ -11,9 +13,11 @@ class UV {
 
     bool begin( uint8_t pin);
     void reset();
+    // Samples only when the adaptive policy says so; cheap to call every loop
     void read();
     float readImmediate();
     float average() const;
+    const AdaptiveSampler& sampler() const { return _sampler; }
 
    private:
     uint8_t _pin = 0xFF;
@@ -23,6 +27,7 @@ class UV {
     size_t _count = 0;
     float _sum = 0.0f;
     float* _buf = nullptr;
+    AdaptiveSampler _sampler;
     void _add(float v);
     float _calculateUVIndex(uint16_t raw_adc) const;
 };
\ No newline at end of file
@@ -7,14 +7,10 @@
 #include <ui.h>
 
 void updateWifiUI(bool force, bool isConnected, int32_t rssi) {
-    static lv_obj_t* ui_sd_WifiIcon = nullptr;
-    static lv_obj_t* ui_dq_WifiIcon = nullptr;
-    static lv_obj_t* ui_es_WifiIcon = nullptr;
-
-    LV_TRY_FIND(ui_sd_WifiIcon, ui_SDNotificationBar, UI_COMP_NOTIFICATIONBAR_WIFICONTAINER_WIFIICON);
-    LV_TRY_FIND(ui_dq_WifiIcon, ui_DQNotificationBar, UI_COMP_NOTIFICATIONBAR_WIFICONTAINER_WIFIICON);
-    LV_TRY_FIND(ui_es_WifiIcon, ui_ESNotificationBar, UI_COMP_NOTIFICATIONBAR_WIFICONTAINER_WIFIICON);
-    if (!lv_obj_ok(ui_sd_WifiIcon) && !lv_obj_ok(ui_dq_WifiIcon) && !lv_obj_ok(ui_es_WifiIcon)) {
+    static lv_obj_t* ui_WifiIcon = nullptr;
+
+    LV_TRY_FIND(ui_WifiIcon, ui_NotificationBar, UI_COMP_NOTIFICATIONBAR_WIFICONTAINER_WIFIICON);
+    if (!lv_obj_ok(ui_WifiIcon)) {
         return;
     }
 
@@ -41,9 +37,7 @@ void updateWifiUI(bool force, bool isConnected, int32_t rssi) {
     }
 
     // Apply safely; no crashes if an icon vanished mid-update
-    LV_SAFE(ui_sd_WifiIcon, { lv_obj_set_style_img_recolor(ui_sd_WifiIcon, color, LV_PART_MAIN); });
-    LV_SAFE(ui_dq_WifiIcon, { lv_obj_set_style_img_recolor(ui_dq_WifiIcon, color, LV_PART_MAIN); });
-    LV_SAFE(ui_es_WifiIcon, { lv_obj_set_style_img_recolor(ui_es_WifiIcon, color, LV_PART_MAIN); });
+    LV_SAFE(ui_WifiIcon, { lv_obj_set_style_img_recolor(ui_WifiIcon, color, LV_PART_MAIN); });
 }
 
 WifiConnector::WifiConnector()